@@ -0,0 +1,123 @@
+#include "AssetStore.hpp"
+
+#include "defines.hpp"
+
+#include <Arduino.h>
+#include <cstring>
+#include <esp_partition.h>
+
+constexpr const char *ASSET_PARTITION_LABEL = "assets";
+constexpr auto        ASSET_PARTITION_SUBTYPE
+  = static_cast<esp_partition_subtype_t>(0x40); // First custom data subtype
+
+static const uint8_t              *packBase  = nullptr;
+static uint16_t                    packCount = 0;
+static esp_partition_mmap_handle_t packHandle;
+
+static auto entries() -> const AssetPackEntry * {
+    return reinterpret_cast<const AssetPackEntry *>(packBase + sizeof(AssetPackHeader));
+}
+
+static auto inPack(uint32_t offset, uint32_t bytes, size_t size) -> bool {
+    return offset <= size && bytes <= size - offset;
+}
+
+// Reject a pack whose directory points outside the pack, so lookups can trust the entries
+static auto validEntry(const AssetPackEntry &entry, size_t size) -> bool {
+    if (memchr(entry.name, '\0', ASSET_NAME_LENGTH) == nullptr
+        || entry.format > static_cast<uint8_t>(ImageFormat::RLE_MASK)) {
+        return false;
+    }
+    if (entry.paletteSize != 0
+        && ((entry.paletteOffset % alignof(uint16_t)) != 0
+            || !inPack(entry.paletteOffset, entry.paletteSize * sizeof(uint16_t), size))) {
+        return false;
+    }
+    return inPack(entry.dataOffset, entry.dataSize, size);
+}
+
+auto openAssetPack(const uint8_t *pack, size_t size) -> bool {
+    packBase  = nullptr;
+    packCount = 0;
+
+    if (pack == nullptr || size < sizeof(AssetPackHeader)) {
+        return false;
+    }
+    const auto *header = reinterpret_cast<const AssetPackHeader *>(pack);
+    if (header->magic != ASSET_PACK_MAGIC || header->version != ASSET_PACK_VERSION
+        || header->size > size
+        || !inPack(sizeof(AssetPackHeader), header->count * sizeof(AssetPackEntry),
+                   header->size)) {
+        warnln("No valid asset pack");
+        return false;
+    }
+
+    const auto *directory
+      = reinterpret_cast<const AssetPackEntry *>(pack + sizeof(AssetPackHeader));
+    for (uint16_t i = 0; i < header->count; i++) {
+        if (!validEntry(directory[i], header->size)) {
+            warnf("Asset pack entry %u is corrupt\n", i);
+            return false;
+        }
+    }
+
+    packBase  = pack;
+    packCount = header->count;
+    return true;
+}
+
+auto initAssetStore() -> bool {
+    const esp_partition_t *partition = esp_partition_find_first(
+      ESP_PARTITION_TYPE_DATA, ASSET_PARTITION_SUBTYPE, ASSET_PARTITION_LABEL);
+    if (partition == nullptr) {
+        warnln("No assets partition, using the built-in images");
+        return false;
+    }
+
+    // Only map what the pack uses; an erased partition fails the magic check
+    AssetPackHeader header;
+    if (esp_partition_read(partition, 0, &header, sizeof(header)) != ESP_OK
+        || header.magic != ASSET_PACK_MAGIC || header.size > partition->size) {
+        warnln("Assets partition holds no asset pack, using the built-in images");
+        return false;
+    }
+
+    const void *mapped = nullptr;
+    if (esp_partition_mmap(partition, 0, header.size, ESP_PARTITION_MMAP_DATA, &mapped,
+                           &packHandle)
+        != ESP_OK) {
+        errorln("Failed to map the assets partition");
+        return false;
+    }
+    if (!openAssetPack(static_cast<const uint8_t *>(mapped), header.size)) {
+        esp_partition_munmap(packHandle);
+        return false;
+    }
+
+    infof("Asset pack: %u images, %lu bytes mapped\n", packCount, (unsigned long)header.size);
+    return true;
+}
+
+auto findAsset(const char *name, ImageAsset &image) -> bool {
+    for (uint16_t i = 0; i < packCount; i++) {
+        const AssetPackEntry &entry = entries()[i];
+        if (strncmp(entry.name, name, ASSET_NAME_LENGTH) != 0) {
+            continue;
+        }
+
+        image.width          = entry.width;
+        image.height         = entry.height;
+        image.format         = static_cast<ImageFormat>(entry.format);
+        image.transparentKey = entry.transparentKey;
+        image.foreground     = entry.foreground;
+        image.palette        = nullptr;
+        image.paletteSize    = entry.paletteSize;
+        image.data           = packBase + entry.dataOffset;
+        image.size           = entry.dataSize;
+        if (entry.paletteSize != 0) {
+            image.palette = reinterpret_cast<const uint16_t *>(packBase + entry.paletteOffset);
+        }
+        return true;
+    }
+    return false;
+}
@@ -0,0 +1,63 @@
+#ifndef ASSETSTORE_H_
+#define ASSETSTORE_H_
+
+#include "ImageAsset.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+/*
+   AssetStore - images served from the `assets` flash partition
+
+   scripts/image_assets.py --pack writes an asset pack that is flashed into the `assets` data
+   partition, separate from the app. At boot the partition is memory-mapped, and every image is
+   an ImageAsset whose palette and data point straight into the mapping, so images are decoded
+   from flash without copying. Replacing the images only needs the partition to be reflashed.
+
+   Pack layout, little-endian, all offsets from the start of the pack and 4-byte aligned:
+
+     AssetPackHeader
+     AssetPackEntry[count]
+     palettes and image data
+*/
+
+constexpr uint32_t ASSET_PACK_MAGIC   = 0x50414451; // "QDAP"
+constexpr uint16_t ASSET_PACK_VERSION = 2;
+constexpr size_t   ASSET_NAME_LENGTH  = 24; // Including the terminating zero
+
+struct AssetPackHeader {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t count; // Entries in the directory
+    uint32_t size;  // Bytes in the whole pack
+    uint32_t reserved;
+};
+
+struct AssetPackEntry {
+    char     name[ASSET_NAME_LENGTH];
+    uint16_t width;
+    uint16_t height;
+    uint8_t  format; // ImageFormat
+    uint8_t  reserved;
+    uint16_t transparentKey;
+    uint16_t paletteSize;
+    uint16_t foreground;
+    uint32_t paletteOffset;
+    uint32_t dataOffset;
+    uint32_t dataSize;
+};
+
+static_assert(sizeof(AssetPackHeader) == 16, "Pack header must match scripts/image_assets.py");
+static_assert(sizeof(AssetPackEntry) == 48, "Pack entry must match scripts/image_assets.py");
+
+// Map the assets partition. Returns false when there is no partition or no valid pack in it;
+// findAsset() then finds nothing and the built-in images are used.
+auto initAssetStore() -> bool;
+
+// Use a pack that is already in memory, for example a file-backed image of the partition
+auto openAssetPack(const uint8_t *pack, size_t size) -> bool;
+
+// Look up an image by name. The descriptor points into the mapped pack.
+auto findAsset(const char *name, ImageAsset &image) -> bool;
+
+#endif /* ASSETSTORE_H_ */
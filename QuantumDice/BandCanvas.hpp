@@ -0,0 +1,41 @@
+#ifndef BANDCANVAS_H_
+#define BANDCANVAS_H_
+
+#include "Screenfunctions.hpp"
+
+#include <Adafruit_GFX.h>
+
+/*
+   BandCanvas - Adafruit_GFX drawing into one display band
+
+   Wraps a band buffer from acquireBand() so the regular GFX text and shape calls can be used
+   in full-screen coordinates. Only the pixels that fall inside the band's rows are written;
+   everything else is dropped. Drawing a screen therefore means replaying the same calls for
+   every band, which is cheap for text compared to holding a full canvas in RAM.
+*/
+
+class BandCanvas : public Adafruit_GFX {
+  public:
+    BandCanvas(uint16_t *pixels, int16_t firstRow, int16_t rows)
+        : Adafruit_GFX(WIDTH, HEIGHT), pixels(pixels), firstRow(firstRow), rows(rows) {}
+
+    void drawPixel(int16_t x, int16_t y, uint16_t color) override {
+        if (x < 0 || x >= WIDTH || y < firstRow || y >= firstRow + rows) {
+            return;
+        }
+        pixels[((y - firstRow) * WIDTH) + x] = color;
+    }
+
+    void fillScreen(uint16_t color) override {
+        for (int32_t i = 0; i < (int32_t)WIDTH * rows; i++) {
+            pixels[i] = color;
+        }
+    }
+
+  private:
+    uint16_t *pixels;
+    int16_t   firstRow;
+    int16_t   rows;
+};
+
+#endif /* BANDCANVAS_H_ */
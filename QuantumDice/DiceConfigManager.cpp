@@ -90,6 +90,8 @@ auto DiceConfigManager::load(const String &filename) -> bool {
             _config.y_background = (uint16_t) strtoul(value.c_str(), nullptr, 0);
         } else if (key == "z_background") {
             _config.z_background = (uint16_t) strtoul(value.c_str(), nullptr, 0);
+        } else if (key == "qrUrl") {
+            _config.qrUrl = value;
         } else if (key == "entang_colors") {
             // Parse comma-separated color values
             _config.entang_colors_count = 0;
@@ -195,6 +197,9 @@ void DiceConfigManager::initDefaultConfig() {
     _config.y_background = 0x0; // Black
     _config.z_background = 0x0; // Black
 
+    // QR code face
+    _config.qrUrl = DEFAULT_QR_URL;
+
     // Default entanglement colors: Yellow, Green, Cyan, Magenta
     _config.entang_colors[0]    = 0xFFE0; // Yellow
     _config.entang_colors[1]    = 0x07E0; // Green
@@ -245,6 +250,7 @@ void printGlobalConfig() {
     infof("X Background: 0x%04X (%u)\n", currentConfig.x_background, currentConfig.x_background);
     infof("Y Background: 0x%04X (%u)\n", currentConfig.y_background, currentConfig.y_background);
     infof("Z Background: 0x%04X (%u)\n", currentConfig.z_background, currentConfig.z_background);
+    infof("QR URL: %s\n", currentConfig.qrUrl.c_str());
     String colours = "";
     for (uint8_t i = 0; i < currentConfig.entang_colors_count; i++) {
         colours += String(currentConfig.entang_colors[i], HEX);
@@ -374,6 +380,8 @@ auto createDefaultConfigFile() -> bool {
     file.println("x_background=0");
     file.println("y_background=0");
     file.println("z_background=0");
+    file.print("qrUrl=");
+    file.println(DEFAULT_QR_URL);
     file.println("entang_colors=65504,2016,2047,63519");
     file.println("colorFlashTimeout=250");
     file.println("rssiLimit=-35");
@@ -5,6 +5,7 @@
 #include <array>
 
 constexpr uint8_t MAX_ENTANGLEMENT_COLORS = 8;
+constexpr const char *DEFAULT_QR_URL = "https://www.utwente.nl/en/mesaplus/education/quantum-dice/";
 
 // Configuration structure
 struct DiceConfig {
@@ -12,6 +13,7 @@ struct DiceConfig {
     uint16_t x_background; // Display background colors
     uint16_t y_background;
     uint16_t z_background;
+    String   qrUrl;        // Encoded in the QR code face, at most 106 characters
     std::array<uint16_t, MAX_ENTANGLEMENT_COLORS> entang_colors;    // Available entanglement colors (RGB565)
     uint8_t  entang_colors_count; // Number of colors in array
     uint16_t colorFlashTimeout;   // Color flash duration in milliseconds
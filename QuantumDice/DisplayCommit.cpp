@@ -0,0 +1,205 @@
+#include "DisplayCommit.hpp"
+
+#include "defines.hpp"
+#include "RoundDisplay.hpp"
+#include "Screenfunctions.hpp"
+
+#include <Adafruit_GC9A01A.h>
+#include <Arduino.h>
+#include <esp_heap_caps.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+
+extern Adafruit_GC9A01A tft;
+
+constexpr uint32_t   DISPLAY_TASK_STACK    = 4096;
+constexpr UBaseType_t DISPLAY_TASK_PRIORITY = 1;
+constexpr BaseType_t DISPLAY_TASK_CORE     = 0; // Arduino loop() runs on core 1
+
+// Pushes that may be queued or in flight at once; one per band buffer
+constexpr UBaseType_t COMMIT_SLOTS = BAND_COUNT;
+
+enum class CommitType : uint8_t {
+    FRAME,
+    BAND,
+    FILL
+};
+
+struct CommitJob {
+    CommitType type;
+    uint16_t  *pixels;
+    uint16_t   firstRow;
+    uint16_t   rows;
+    uint16_t   color;
+};
+
+static uint16_t          *bandBuffers[BAND_COUNT] = {nullptr, nullptr};
+static uint8_t            nextBand                = 0;
+static bool               bandReserved            = false;
+static QueueHandle_t      commitQueue             = nullptr;
+static SemaphoreHandle_t  commitSlots             = nullptr;
+static DisplayCommitStats stats                   = {0, 0, 0, 0, 0, 0};
+// Guards the counters the display task updates: 64-bit adds are not atomic on the ESP32, and
+// the main loop may be reading them at the same time
+static portMUX_TYPE statsLock = portMUX_INITIALIZER_UNLOCKED;
+
+static_assert(WIDTH == ROUND_PANEL_SIZE && HEIGHT == ROUND_PANEL_SIZE,
+              "Chord table does not match the panel size");
+static_assert(HEIGHT % BAND_ROWS == 0, "Bands must tile the panel");
+
+static void countPush(uint32_t pixelsPushed, uint32_t pixelsSkipped, uint32_t pushMicros) {
+    taskENTER_CRITICAL(&statsLock);
+    stats.bytesPushed    += pixelsPushed * sizeof(uint16_t);
+    stats.bytesSkipped   += pixelsSkipped * sizeof(uint16_t);
+    stats.lastPushMicros  = pushMicros;
+    taskEXIT_CRITICAL(&statsLock);
+}
+
+// Push only the visible chord of every scanline, one address window per row. `pixels` holds
+// full-width rows starting at `firstRow`. Returns the number of pixels pushed.
+static auto pushRoundRows(const uint16_t *pixels, uint16_t firstRow, uint16_t rows) -> uint32_t {
+    uint32_t pushed = 0;
+    tft.startWrite();
+    for (uint16_t row = 0; row < rows; row++) {
+        const ScanlineChord &chord = ROUND_CHORDS[firstRow + row];
+        tft.setAddrWindow(chord.start, firstRow + row, chord.width, 1);
+        tft.writePixels(const_cast<uint16_t *>(pixels) + (row * WIDTH) + chord.start,
+                        chord.width);
+        pushed += chord.width;
+    }
+    tft.endWrite();
+    return pushed;
+}
+
+static auto fillRound(uint16_t color) -> uint32_t {
+    tft.startWrite();
+    for (uint16_t y = 0; y < HEIGHT; y++) {
+        const ScanlineChord &chord = ROUND_CHORDS[y];
+        tft.writeFastHLine(chord.start, y, chord.width, color);
+    }
+    tft.endWrite();
+    return ROUND_VISIBLE_PIXELS;
+}
+
+static void push(const CommitJob &job) {
+    uint32_t start  = micros();
+    uint32_t pushed = 0;
+    switch (job.type) {
+        case CommitType::FRAME: pushed = pushRoundRows(job.pixels, 0, HEIGHT); break;
+        case CommitType::BAND:  pushed = pushRoundRows(job.pixels, job.firstRow, job.rows); break;
+        case CommitType::FILL:  pushed = fillRound(job.color); break;
+    }
+    countPush(pushed, ((uint32_t)WIDTH * job.rows) - pushed, micros() - start);
+}
+
+static void displayCommitTask(void * /*parameter*/) {
+    CommitJob job;
+    for (;;) {
+        if (xQueueReceive(commitQueue, &job, portMAX_DELAY) != pdTRUE) {
+            continue;
+        }
+
+        push(job);
+        xSemaphoreGive(commitSlots);
+    }
+}
+
+void initDisplayCommit() {
+    for (auto &band : bandBuffers) {
+        band = static_cast<uint16_t *>(heap_caps_malloc(
+          (size_t)WIDTH * BAND_ROWS * sizeof(uint16_t), MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL));
+        if (band == nullptr) {
+            errorln("Failed to allocate display band buffer");
+        }
+    }
+
+    commitQueue = xQueueCreate(COMMIT_SLOTS, sizeof(CommitJob));
+    commitSlots = xSemaphoreCreateCounting(COMMIT_SLOTS, COMMIT_SLOTS);
+    xTaskCreatePinnedToCore(displayCommitTask, "displayCommit", DISPLAY_TASK_STACK, nullptr,
+                            DISPLAY_TASK_PRIORITY, nullptr, DISPLAY_TASK_CORE);
+
+    infof("Round clipping pushes %lu of %lu pixels per frame\n",
+          (unsigned long)ROUND_VISIBLE_PIXELS, (unsigned long)WIDTH * HEIGHT);
+}
+
+static void takeSlot() {
+    uint32_t start = micros();
+    xSemaphoreTake(commitSlots, portMAX_DELAY);
+    stats.fenceWaitMicros += micros() - start;
+}
+
+static void submit(const CommitJob &job) {
+    if (commitQueue == nullptr) {
+        // Display task not running (yet) - push synchronously
+        push(job);
+        return;
+    }
+
+    xQueueSend(commitQueue, &job, portMAX_DELAY);
+}
+
+auto acquireBand() -> uint16_t * {
+    if (bandBuffers[nextBand] == nullptr) {
+        return nullptr;
+    }
+    if (commitSlots != nullptr) {
+        // Pushes complete in order, so once a slot is free the band used BAND_COUNT bands ago
+        // has been clocked out
+        takeSlot();
+    }
+    bandReserved   = true;
+    uint16_t *band = bandBuffers[nextBand];
+    nextBand       = (nextBand + 1) % BAND_COUNT;
+    return band;
+}
+
+void commitBand(uint16_t *band, uint16_t firstRow, uint16_t rows) {
+    if (!bandReserved || band == nullptr) {
+        errorln("commitBand() without acquireBand()");
+        return;
+    }
+    bandReserved = false;
+    stats.bandsCommitted++;
+    submit(CommitJob{CommitType::BAND, band, firstRow, rows, 0});
+}
+
+void commitFrame(uint16_t *frame) {
+    if (commitSlots != nullptr) {
+        takeSlot();
+    }
+    stats.framesCommitted++;
+    submit(CommitJob{CommitType::FRAME, frame, 0, HEIGHT, 0});
+}
+
+void commitFill(uint16_t color) {
+    if (commitSlots != nullptr) {
+        takeSlot();
+    }
+    stats.framesCommitted++;
+    submit(CommitJob{CommitType::FILL, nullptr, 0, HEIGHT, color});
+}
+
+void displayFence() {
+    if (commitSlots == nullptr) {
+        return;
+    }
+
+    // Holding every slot means nothing is queued or in flight. A band that is still being
+    // composed already holds its slot.
+    UBaseType_t slots = bandReserved ? COMMIT_SLOTS - 1 : COMMIT_SLOTS;
+    for (UBaseType_t i = 0; i < slots; i++) {
+        takeSlot();
+    }
+    for (UBaseType_t i = 0; i < slots; i++) {
+        xSemaphoreGive(commitSlots);
+    }
+}
+
+auto getDisplayCommitStats() -> DisplayCommitStats {
+    taskENTER_CRITICAL(&statsLock);
+    DisplayCommitStats snapshot = stats;
+    taskEXIT_CRITICAL(&statsLock);
+    return snapshot;
+}
@@ -0,0 +1,46 @@
+#ifndef DISPLAYCOMMIT_H_
+#define DISPLAYCOMMIT_H_
+
+#include <cstdint>
+
+/*
+   DisplayCommit - asynchronous push to the GC9A01A panels
+
+   Pushes are handed to a display task that clocks them out over SPI while the caller keeps
+   running. Full frames (the pre-rendered face sprites) are pushed straight from their own
+   buffer. Everything else is composed a band of BAND_ROWS scanlines at a time into one of
+   BAND_COUNT small ping-pong buffers: while one band is on the bus the next one is being
+   composed, and no full-screen canvas has to live in internal RAM.
+
+   Every acquireBand() must be followed by a commitBand() - acquiring reserves a push slot.
+
+   Anything that touches the shared SPI bus or the chip-select lines must call displayFence()
+   first. selectScreens() does this, so every draw path that selects its screens is ordered
+   behind the pushes that are still in flight.
+
+   Frames, bands and fills are clipped to the visible circle of the round panels (see
+   RoundDisplay.hpp). The hidden corners keep whatever was last written there.
+*/
+
+constexpr uint8_t BAND_ROWS  = 16;
+constexpr uint8_t BAND_COUNT = 2;
+
+struct DisplayCommitStats {
+    uint32_t framesCommitted; // Number of frames/fills handed to the display task
+    uint32_t bandsCommitted;  // Number of bands handed to the display task
+    uint32_t lastPushMicros;  // Duration of the last push on the display task
+    uint32_t fenceWaitMicros; // Total time the caller spent waiting for the display task
+    uint64_t bytesPushed;     // Pixel bytes clocked out for commits
+    uint64_t bytesSkipped;    // Pixel bytes saved by clipping the corners
+};
+
+void initDisplayCommit();
+auto acquireBand() -> uint16_t *;
+void commitBand(uint16_t *band, uint16_t firstRow, uint16_t rows);
+void commitFrame(uint16_t *frame);
+void commitFill(uint16_t color);
+void displayFence();
+// A consistent snapshot, safe to take while the display task is pushing
+auto getDisplayCommitStats() -> DisplayCommitStats;
+
+#endif /* DISPLAYCOMMIT_H_ */
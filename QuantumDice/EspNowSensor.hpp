@@ -4,12 +4,48 @@
 #define ESPNOW_WIFI_CHANNEL 6
 
 #include "defines.hpp"
-#include "Queue.hpp"
+#include "SendResult.hpp"
+#include "SpscRing.hpp"
+#include "WireFormat.hpp"
 
+#include <array>
+#include <atomic>
+#include <cassert>
 #include <esp_now.h>
 #include <sys/_stdint.h>
 #include <WiFi.h>
 
+// Messages sent and not yet reported on by the send callback, or waiting to be retransmitted.
+// A power of two.
+#define ESPNOW_SEND_POOL_SIZE 8
+// Received messages waiting for Poll(), a power of two
+#define ESPNOW_RECEIVE_RING_SIZE 16
+// Peers whose sequence numbers are tracked; the one heard from least recently is replaced
+#define ESPNOW_PEER_TABLE_SIZE 8
+// A unicast frame the send callback reports as failed is sent again up to ESPNOW_MAX_RETRIES
+// times, after ESPNOW_RETRY_BASE_MS and then twice as long for each further attempt
+#define ESPNOW_MAX_RETRIES 4
+#define ESPNOW_RETRY_BASE_MS 20
+
+// Every frame starts with a link byte: 0 for a broadcast, otherwise the sender's sequence number
+// for that peer, which lets the receiver drop retransmitted copies it already has
+constexpr uint8_t ESPNOW_UNSEQUENCED = 0;
+// Sequence numbers behind the newest one from a peer that are still checked for duplicates
+constexpr uint8_t ESPNOW_DEDUP_WINDOW = 32;
+// A peer silent for longer than this has restarted or lost track; its next number is accepted
+// as is. All retransmissions of a frame happen well within this time.
+constexpr unsigned long ESPNOW_DEDUP_TIMEOUT_MS = 1000;
+
+// Air time estimate of a frame at the default ESP-NOW rate of 1 Mbps: long preamble and PLCP
+// header, then MAC header, vendor-specific action header and FCS around the payload
+constexpr uint32_t ESPNOW_PREAMBLE_US    = 192;
+constexpr uint32_t ESPNOW_FRAME_OVERHEAD = 24 + 15 + 4; // Bytes
+constexpr uint32_t ESPNOW_US_PER_BYTE    = 8;
+
+constexpr auto espNowAirtime(size_t payload) -> uint32_t {
+    return ESPNOW_PREAMBLE_US + ((ESPNOW_FRAME_OVERHEAD + payload) * ESPNOW_US_PER_BYTE);
+}
+
 template<typename T>
 struct temp {
     T message;
@@ -17,7 +53,45 @@ struct temp {
     int32_t rssi;
 };
 
+enum class SlotState : uint8_t {
+    FREE,
+    IN_FLIGHT,     // Handed to the radio, the send callback has not reported on it yet
+    WAITING_RETRY, // Reported as failed, sent again once millis() reaches retryAt
+};
+
+template<typename T>
+struct sendSlot {
+    uint8_t       frame[1 + WireFormat<T>::MAX_SIZE]; // Link byte, then the encoded message
+    uint8_t       length;
+    uint8_t       target[6];
+    SlotState     state;
+    uint8_t       retries; // Retransmissions so far
+    unsigned long retryAt;
+};
+
+struct peerSequence {
+    uint8_t       addr[6];
+    bool          used;
+    uint8_t       sequence; // Last one sent to, or newest one received from, this peer
+    uint32_t      seen;     // Received only: bit i is set once sequence - i has arrived
+    unsigned long lastTime; // millis() of the last frame to or from this peer
+};
+
+struct SendPoolStats {
+    uint8_t  inFlight;    // Slots in use now, including those waiting to be retransmitted
+    uint8_t  highWater;   // Most slots in use at once
+    uint32_t delivered;
+    uint32_t failed;      // Refused by esp_now_send(), or reported as failed after the last retry
+    uint32_t wouldBlock;  // Sends turned away because every slot was in use
+    uint32_t retransmits; // Unicast frames sent again after a failure report
+    uint32_t frames;      // Handed to the radio, retransmissions included
+    uint64_t airtimeUs;   // Estimated air time of those frames, see espNowAirtime()
+};
+
 template<typename T> class EspNowSensor {
+    static_assert(1 + WireFormat<T>::MAX_SIZE <= ESP_NOW_MAX_DATA_LEN,
+                  "Message too large for ESP-NOW");
+
     private:
         static EspNowSensor *instance;
 
@@ -28,9 +102,18 @@ template<typename T> class EspNowSensor {
         void printMacAddress();
         void getMacAddress(uint8_t *addr);
 
-        auto send(T message, uint8_t *target) -> bool;
+        auto send(const T &message, uint8_t *target) -> SendResult;
         auto poll(T *message, uint8_t *source, int32_t *rssi) -> bool;
 
+        auto transmit(uint8_t index) -> bool;
+        void reclaim();
+        void retransmit();
+
+        auto nextSequence(const uint8_t *target) -> uint8_t;
+        auto acceptSequence(const uint8_t *source, uint8_t sequence) -> bool;
+        static auto findPeer(std::array<peerSequence, ESPNOW_PEER_TABLE_SIZE> &table,
+                const uint8_t *addr, unsigned long now) -> peerSequence &;
+
         void onDataRecv(const esp_now_recv_info_t *mac, const unsigned char *incomingData, int len);
         void onDataSend(const wifi_tx_info_t *tx_info, esp_now_send_status_t status);
 
@@ -68,18 +151,66 @@ template<typename T> class EspNowSensor {
             instance->getMacAddress(addr);
         }
 
-        static auto Send(T message, uint8_t *target) -> bool {
+        static auto Send(const T &message, uint8_t *target) -> SendResult {
             assert(instance);
             return instance->send(message, target);
         }
 
+        // Messages lost because the receive ring was full
+        static auto GetReceiveDrops() -> uint32_t {
+            assert(instance);
+            return instance->_messageQueue.drops();
+        }
+
+        // Frames that WireFormat<T> could not decode
+        static auto GetReceiveRejects() -> uint32_t {
+            assert(instance);
+            return instance->_rejected.load();
+        }
+
+        // Retransmitted frames that had already been received
+        static auto GetReceiveDuplicates() -> uint32_t {
+            assert(instance);
+            return instance->_duplicates.load();
+        }
+
+        static auto GetSendPoolStats() -> SendPoolStats {
+            assert(instance);
+            return {instance->_inFlight, instance->_inFlightHighWater, instance->_delivered,
+                    instance->_failed, instance->_wouldBlock, instance->_retransmits,
+                    instance->_frames, instance->_airtimeUs};
+        }
+
         static auto Poll(T *message, uint8_t *source, int32_t *rssi) -> bool {
             assert(instance);
             return instance->poll(message, source, rssi);
         }
 
     private:
-        Queue<struct temp<T>> _messageQueue;
+        // Filled by the receive callback in the Wi-Fi task, emptied by Poll() in the main loop
+        SpscRing<struct temp<T>, ESPNOW_RECEIVE_RING_SIZE> _messageQueue;
+        std::atomic<uint32_t> _rejected   = 0;
+        std::atomic<uint32_t> _duplicates = 0;
+        // Only touched by the receive callback
+        std::array<peerSequence, ESPNOW_PEER_TABLE_SIZE> _receivePeers = {};
+
+        // The send callback only pushes its reports, true for delivered, into _sendResults.
+        // ESP-NOW reports sends in the order they were made, so reclaim() matches them with the
+        // slot indices in _sentOrder. Everything else here belongs to the main loop.
+        SpscRing<bool, ESPNOW_SEND_POOL_SIZE> _sendResults;
+        std::array<struct sendSlot<T>, ESPNOW_SEND_POOL_SIZE> _sendPool = {};
+        std::array<uint8_t, ESPNOW_SEND_POOL_SIZE> _sentOrder = {};
+        uint8_t  _sentHead          = 0;
+        uint8_t  _sentCount         = 0;
+        uint8_t  _inFlight          = 0;
+        uint8_t  _inFlightHighWater = 0;
+        uint32_t _delivered         = 0;
+        uint32_t _failed            = 0;
+        uint32_t _wouldBlock        = 0;
+        uint32_t _retransmits       = 0;
+        uint32_t _frames            = 0;
+        uint64_t _airtimeUs         = 0;
+        std::array<peerSequence, ESPNOW_PEER_TABLE_SIZE> _sendPeers = {};
 };
 
 // ================================================================================
@@ -166,24 +297,180 @@ template<typename T> void EspNowSensor<T>::getMacAddress(uint8_t *addr) {
     WiFi.macAddress(addr);
 }
 
-template<typename T> auto EspNowSensor<T>::send(T message, uint8_t *target) -> bool {
-    T *toSend = (T *) malloc(sizeof(T));
-    if (toSend == nullptr) {
+template<typename T> auto EspNowSensor<T>::send(const T &message, uint8_t *target) -> SendResult {
+    reclaim();
+
+    uint8_t index = 0;
+    while (index < ESPNOW_SEND_POOL_SIZE && _sendPool[index].state != SlotState::FREE) {
+        index++;
+    }
+    if (index == ESPNOW_SEND_POOL_SIZE) {
+        _wouldBlock++;
+        return SendResult::WOULD_BLOCK;
+    }
+
+    struct sendSlot<T> &slot = _sendPool[index];
+    size_t length = WireFormat<T>::encode(message, slot.frame + 1);
+    if (length == 0) {
+        _failed++;
+        return SendResult::FAILED;
+    }
+    memcpy(slot.target, target, 6);
+
+    // Only unicast frames are acknowledged by the receiving MAC, so only those are sequenced and
+    // retransmitted. The watchdog broadcast is repeated by the state machine anyway.
+    bool broadcast = true;
+    for (uint8_t i = 0; i < 6; i++) {
+        broadcast = broadcast && target[i] == 0xFF;
+    }
+    slot.frame[0] = broadcast ? ESPNOW_UNSEQUENCED : nextSequence(target);
+    slot.length   = length + 1;
+    slot.retries  = 0;
+
+    if (!transmit(index)) {
+        _failed++;
+        return SendResult::FAILED;
+    }
+    _inFlight++;
+    if (_inFlight > _inFlightHighWater) {
+        _inFlightHighWater = _inFlight;
+    }
+    return SendResult::SENT;
+}
+
+// Hands a slot to the radio. Unless this returns false, the send callback reports on it later.
+template<typename T> auto EspNowSensor<T>::transmit(uint8_t index) -> bool {
+    struct sendSlot<T> &slot = _sendPool[index];
+    if (esp_now_send(slot.target, slot.frame, slot.length) != ESP_OK) {
         return false;
     }
 
-    memcpy(toSend, &message, sizeof(T));
+    // The report may already be in _sendResults, but only reclaim() reads it, on this task
+    _sentOrder[(_sentHead + _sentCount) % ESPNOW_SEND_POOL_SIZE] = index;
+    _sentCount++;
+    slot.state = SlotState::IN_FLIGHT;
+    _frames++;
+    _airtimeUs += espNowAirtime(slot.length);
+    return true;
+}
+
+// Frees the slots the send callback has reported on, or schedules their retransmission
+template<typename T> void EspNowSensor<T>::reclaim() {
+    bool delivered = false;
+    // A report with no frame to match it with stays in the ring
+    while (_sentCount > 0 && _sendResults.pop(delivered)) {
+        struct sendSlot<T> &slot = _sendPool[_sentOrder[_sentHead]];
+        _sentHead = (_sentHead + 1) % ESPNOW_SEND_POOL_SIZE;
+        _sentCount--;
+
+        if (!delivered && slot.frame[0] != ESPNOW_UNSEQUENCED
+            && slot.retries < ESPNOW_MAX_RETRIES) {
+            slot.retryAt = millis() + (ESPNOW_RETRY_BASE_MS << slot.retries);
+            slot.retries++;
+            slot.state = SlotState::WAITING_RETRY;
+            continue;
+        }
+
+        if (delivered) {
+            _delivered++;
+        } else {
+            _failed++;
+        }
+        slot.state = SlotState::FREE;
+        _inFlight--;
+    }
+}
+
+// Sends the frames whose retry time has come. A retransmission may overtake frames sent to the
+// same peer after the original; the receiver accepts it as long as it has not seen it.
+template<typename T> void EspNowSensor<T>::retransmit() {
+    unsigned long now = millis();
+    for (uint8_t index = 0; index < ESPNOW_SEND_POOL_SIZE; index++) {
+        struct sendSlot<T> &slot = _sendPool[index];
+        if (slot.state != SlotState::WAITING_RETRY
+            || static_cast<long>(now - slot.retryAt) < 0) {
+            continue;
+        }
+
+        if (transmit(index)) {
+            _retransmits++;
+        } else {
+            _failed++;
+            slot.state = SlotState::FREE;
+            _inFlight--;
+        }
+    }
+}
+
+// Returns the entry for addr, taking over the least recently used one when addr is not in the
+// table. A taken-over entry has used cleared; the caller initialises it and sets lastTime.
+template<typename T>
+auto EspNowSensor<T>::findPeer(std::array<peerSequence, ESPNOW_PEER_TABLE_SIZE> &table,
+        const uint8_t *addr, unsigned long now) -> peerSequence & {
+    peerSequence *oldest = &table[0];
+    for (peerSequence &peer : table) {
+        if (peer.used && memcmp(peer.addr, addr, 6) == 0) {
+            return peer;
+        }
+        if (!peer.used || (oldest->used && now - peer.lastTime > now - oldest->lastTime)) {
+            oldest = &peer;
+        }
+    }
+
+    memcpy(oldest->addr, addr, 6);
+    oldest->used = false;
+    return *oldest;
+}
+
+template<typename T> auto EspNowSensor<T>::nextSequence(const uint8_t *target) -> uint8_t {
+    unsigned long now  = millis();
+    peerSequence &peer = findPeer(_sendPeers, target, now);
+    if (!peer.used) {
+        // A random start makes it unlikely that the numbers after a restart were seen recently
+        peer.used     = true;
+        peer.sequence = static_cast<uint8_t>(random(1, 256));
+    }
+    peer.lastTime = now;
+    // 0 is ESPNOW_UNSEQUENCED
+    peer.sequence = peer.sequence == 255 ? 1 : peer.sequence + 1;
+    return peer.sequence;
+}
 
-    esp_err_t result = esp_now_send(target, (uint8_t *)toSend, sizeof(T));
-    return result == ESP_OK;
+// Returns false for a sequence number already received from source. Runs in the receive callback.
+template<typename T>
+auto EspNowSensor<T>::acceptSequence(const uint8_t *source, uint8_t sequence) -> bool {
+    unsigned long now   = millis();
+    peerSequence &peer  = findPeer(_receivePeers, source, now);
+    int8_t        ahead = static_cast<int8_t>(sequence - peer.sequence);
+    bool          fresh = true;
+
+    if (!peer.used || now - peer.lastTime > ESPNOW_DEDUP_TIMEOUT_MS
+        || ahead <= -ESPNOW_DEDUP_WINDOW) {
+        peer.used     = true;
+        peer.sequence = sequence;
+        peer.seen     = 1;
+    } else if (ahead > 0) {
+        peer.seen     = ahead < ESPNOW_DEDUP_WINDOW ? (peer.seen << ahead) | 1 : 1;
+        peer.sequence = sequence;
+    } else {
+        // At or behind the newest number, within the window
+        uint8_t behind = -ahead;
+        fresh          = (peer.seen & (1UL << behind)) == 0;
+        peer.seen     |= 1UL << behind;
+    }
+    peer.lastTime = now;
+    return fresh;
 }
 
 template<typename T> auto EspNowSensor<T>::poll(T *message, uint8_t *source, int32_t *rssi) -> bool {
-    if (_messageQueue.isEmpty()) {
+    reclaim();
+    retransmit();
+
+    struct temp<T> _temp;
+    if (!_messageQueue.pop(_temp)) {
         return false;
     }
 
-    struct temp<T> _temp = _messageQueue.pop();
     memcpy(message, &_temp.message, sizeof(T));
     memcpy(source, _temp.source, 6);
     *rssi = _temp.rssi;
@@ -192,16 +479,27 @@ template<typename T> auto EspNowSensor<T>::poll(T *message, uint8_t *source, int
 
 template<typename T>
 void EspNowSensor<T>::onDataRecv(const esp_now_recv_info_t *mac, const unsigned char *incomingData,
-        int  /*len*/) {
+        int len) {
     struct temp<T> _temp;
-    memcpy(&_temp.message, incomingData, sizeof(T));
+    if (len < 1 || !WireFormat<T>::decode(incomingData + 1, len - 1, _temp.message)) {
+        _rejected++; // Truncated, corrupt or from other firmware
+        return;
+    }
+    if (incomingData[0] != ESPNOW_UNSEQUENCED && !acceptSequence(mac->src_addr, incomingData[0])) {
+        _duplicates++; // Our acknowledgement was lost and the sender tried again
+        return;
+    }
     memcpy(_temp.source, mac->src_addr, 6);
     _temp.rssi = mac->rx_ctrl->rssi;
-    _messageQueue.push(_temp);
+    _messageQueue.push(_temp); // Dropped and counted when the main loop falls behind
 }
 
 template<typename T>
 void EspNowSensor<T>::onDataSend(const wifi_tx_info_t *tx_info, esp_now_send_status_t status) {
+    // For a unicast frame, success means the receiving MAC acknowledged it. Never fills up, as
+    // there is at most one report per slot.
+    _sendResults.push(status == ESP_NOW_SEND_SUCCESS);
+
     static bool prevStatus = false;
     if (status != static_cast<int>(prevStatus)) {
         debug("Last Packet Send Status: ");
@@ -0,0 +1,205 @@
+#include "FaceSprites.hpp"
+
+#include "defines.hpp"
+#include "DisplayCommit.hpp"
+#include "Rgb565.hpp"
+#include "Screenfunctions.hpp"
+
+#include <Adafruit_GC9A01A.h>
+#include <Arduino.h>
+#include <array>
+#include <esp_heap_caps.h>
+
+// Dot position in units of DOT_OFFSET from the centre, with its opacity in 1/32 steps
+struct Dot {
+    int8_t  column;
+    int8_t  row;
+    uint8_t alpha;
+};
+
+constexpr uint8_t OPAQUE = RGB565_ALPHA_ONE;
+
+struct FaceLayout {
+    uint8_t            count;
+    std::array<Dot, 7> dots;
+};
+
+static const std::array<FaceLayout, 8> faceLayouts = {{
+  // N1
+  {1, {{{0, 0, OPAQUE}}}},
+  // N2
+  {2, {{{-1, 1, OPAQUE}, {1, -1, OPAQUE}}}},
+  // N3
+  {3, {{{-1, 1, OPAQUE}, {0, 0, OPAQUE}, {1, -1, OPAQUE}}}},
+  // N4
+  {4, {{{-1, -1, OPAQUE}, {1, -1, OPAQUE}, {-1, 1, OPAQUE}, {1, 1, OPAQUE}}}},
+  // N5
+  {5, {{{-1, -1, OPAQUE}, {1, -1, OPAQUE}, {0, 0, OPAQUE}, {-1, 1, OPAQUE}, {1, 1, OPAQUE}}}},
+  // N6
+  {6,
+   {{{-1, -1, OPAQUE},
+     {1, -1, OPAQUE},
+     {-1, 0, OPAQUE},
+     {1, 0, OPAQUE},
+     {-1, 1, OPAQUE},
+     {1, 1, OPAQUE}}}},
+  // MIX1TO6
+  {7,
+   {{{-1, -1, rgb565AlphaFromFloat((3 * 0.16) + 0.2)},
+     {1, -1, rgb565AlphaFromFloat((5 * 0.16) + 0.2)},
+     {-1, 0, rgb565AlphaFromFloat((1 * 0.16) + 0.2)},
+     {1, 0, rgb565AlphaFromFloat(1 * 0.2)},
+     {-1, 1, rgb565AlphaFromFloat((5 * 0.16) + 0.2)},
+     {1, 1, rgb565AlphaFromFloat((3 * 0.16) + 0.2)},
+     {0, 0, rgb565AlphaFromFloat(3 * 0.2)}}}},
+  // MIX1TO6_ENTANGLED
+  {7,
+   {{{-1, -1, rgb565AlphaFromFloat((3 * 0.16) + 0.2)},
+     {1, -1, rgb565AlphaFromFloat((5 * 0.16) + 0.2)},
+     {-1, 0, rgb565AlphaFromFloat((1 * 0.16) + 0.2)},
+     {1, 0, rgb565AlphaFromFloat((1 * 0.16) + 0.2)},
+     {-1, 1, rgb565AlphaFromFloat((5 * 0.16) + 0.2)},
+     {1, 1, rgb565AlphaFromFloat((3 * 0.16) + 0.2)},
+     {0, 0, rgb565AlphaFromFloat((3 * 0.16) + 0.2)}}}},
+}};
+
+struct SpriteSlot {
+    uint16_t  *pixels;
+    FaceSprite sprite;
+    uint16_t   dotColor;
+    uint16_t   backgroundColor;
+    uint32_t   lastUsed;
+    bool       valid;
+};
+
+static std::array<SpriteSlot, SPRITE_CACHE_SLOTS> spriteSlots = {};
+static uint32_t                                   spriteUseCounter = 0;
+static bool                                       psramAvailable   = true;
+
+// Vertical line into a WIDTH x HEIGHT frame, clipped to the frame
+static void frameVLine(uint16_t *frame, int16_t x, int16_t y, int16_t h, uint16_t color) {
+    if (x < 0 || x >= WIDTH) {
+        return;
+    }
+    int16_t yEnd = std::min<int16_t>(y + h, HEIGHT);
+    for (int16_t row = std::max<int16_t>(y, 0); row < yEnd; row++) {
+        frame[(row * WIDTH) + x] = color;
+    }
+}
+
+// Same pixel coverage as Adafruit_GFX::fillCircle, so cached faces match the direct drawing
+static void frameFillCircle(uint16_t *frame, int16_t x0, int16_t y0, int16_t r, uint16_t color) {
+    frameVLine(frame, x0, y0 - r, (2 * r) + 1, color);
+
+    int16_t f     = 1 - r;
+    int16_t ddF_x = 1;
+    int16_t ddF_y = -2 * r;
+    int16_t x     = 0;
+    int16_t y     = r;
+    int16_t px    = x;
+    int16_t py    = y;
+
+    while (x < y) {
+        if (f >= 0) {
+            y--;
+            ddF_y += 2;
+            f += ddF_y;
+        }
+        x++;
+        ddF_x += 2;
+        f += ddF_x;
+        if (x < (y + 1)) {
+            frameVLine(frame, x0 + x, y0 - y, (2 * y) + 1, color);
+            frameVLine(frame, x0 - x, y0 - y, (2 * y) + 1, color);
+        }
+        if (y != py) {
+            frameVLine(frame, x0 + py, y0 - px, (2 * px) + 1, color);
+            frameVLine(frame, x0 - py, y0 - px, (2 * px) + 1, color);
+            py = y;
+        }
+        px = x;
+    }
+}
+
+static void renderSprite(const SpriteSlot &slot) {
+    const FaceLayout &layout = faceLayouts[static_cast<uint8_t>(slot.sprite)];
+
+    std::fill(slot.pixels, slot.pixels + ((size_t)WIDTH * HEIGHT), slot.backgroundColor);
+    for (uint8_t i = 0; i < layout.count; i++) {
+        const Dot &dot = layout.dots[i];
+        frameFillCircle(slot.pixels, (WIDTH / 2) + (dot.column * DOT_OFFSET),
+                        (HEIGHT / 2) + (dot.row * DOT_OFFSET), DOT_RADIUS,
+                        blendRgb565(slot.dotColor, slot.backgroundColor, dot.alpha));
+    }
+}
+
+void initFaceSprites() {
+    // Pre-render the classic faces and the plain superposition so the first throw result is a
+    // single push
+    for (uint8_t sprite = 0; sprite <= static_cast<uint8_t>(FaceSprite::MIX1TO6); sprite++) {
+        if (getFaceSprite(static_cast<FaceSprite>(sprite), GC9A01A_WHITE, GC9A01A_BLACK)
+            == nullptr) {
+            warnln("No PSRAM for face sprites - drawing faces directly");
+            return;
+        }
+    }
+    infoln("Face sprites pre-rendered in PSRAM");
+}
+
+auto getFaceSprite(FaceSprite sprite, uint16_t dotColor, uint16_t backgroundColor) -> uint16_t * {
+    if (!psramAvailable) {
+        return nullptr;
+    }
+
+    // Hit: same face with the same colours
+    SpriteSlot *victim = &spriteSlots[0];
+    for (SpriteSlot &slot : spriteSlots) {
+        if (slot.valid && slot.sprite == sprite && slot.dotColor == dotColor
+            && slot.backgroundColor == backgroundColor) {
+            slot.lastUsed = ++spriteUseCounter;
+            return slot.pixels;
+        }
+        if (!slot.valid) {
+            if (victim->valid) {
+                victim = &slot;
+            }
+        } else if (victim->valid && slot.lastUsed < victim->lastUsed) {
+            victim = &slot;
+        }
+    }
+
+    // Miss: render into a free or the least recently used slot
+    if (victim->pixels == nullptr) {
+        victim->pixels = static_cast<uint16_t *>(
+          heap_caps_malloc((size_t)WIDTH * HEIGHT * sizeof(uint16_t), MALLOC_CAP_SPIRAM));
+        if (victim->pixels == nullptr) {
+            psramAvailable = false;
+            return nullptr;
+        }
+    }
+
+    // The slot may still be on its way to the displays
+    displayFence();
+
+    victim->sprite          = sprite;
+    victim->dotColor        = dotColor;
+    victim->backgroundColor = backgroundColor;
+    victim->lastUsed        = ++spriteUseCounter;
+    victim->valid           = true;
+    renderSprite(*victim);
+
+    return victim->pixels;
+}
+
+void drawFaceDirect(RenderTarget &target, FaceSprite sprite, uint16_t dotColor,
+                    uint16_t backgroundColor) {
+    const FaceLayout &layout = faceLayouts[static_cast<uint8_t>(sprite)];
+
+    target.fill(backgroundColor);
+    for (uint8_t i = 0; i < layout.count; i++) {
+        const Dot &dot = layout.dots[i];
+        target.circle((WIDTH / 2) + (dot.column * DOT_OFFSET),
+                      (HEIGHT / 2) + (dot.row * DOT_OFFSET), DOT_RADIUS,
+                      blendRgb565(dotColor, backgroundColor, dot.alpha));
+    }
+}
@@ -0,0 +1,38 @@
+#ifndef FACESPRITES_H_
+#define FACESPRITES_H_
+
+#include "RenderTarget.hpp"
+
+#include <cstdint>
+
+/*
+   FaceSprites - pre-rendered dice faces in PSRAM
+
+   The dice faces (N1..N6 and the two superposition patterns) are rendered once per dot and
+   background colour into full 240x240 RGB565 frames in PSRAM. Showing a face is then a single
+   bulk push of the cached frame instead of a fillScreen followed by a fillCircle per dot.
+
+   Sprites are keyed by their colours, so a change of currentConfig colours or of
+   entanglement_color_self renders a fresh sprite on first use. Without PSRAM the faces are drawn
+   directly on the render target as before.
+*/
+
+enum class FaceSprite : uint8_t {
+    N1,
+    N2,
+    N3,
+    N4,
+    N5,
+    N6,
+    MIX1TO6,
+    MIX1TO6_ENTANGLED
+};
+
+constexpr uint8_t SPRITE_CACHE_SLOTS = 12;
+
+void initFaceSprites();
+auto getFaceSprite(FaceSprite sprite, uint16_t dotColor, uint16_t backgroundColor) -> uint16_t *;
+void drawFaceDirect(RenderTarget &target, FaceSprite sprite, uint16_t dotColor,
+                    uint16_t backgroundColor);
+
+#endif /* FACESPRITES_H_ */
@@ -0,0 +1,136 @@
+#include "ImageAsset.hpp"
+
+#include "Rgb565.hpp"
+
+#include <algorithm>
+#include <Arduino.h>
+
+constexpr uint8_t TOKEN_LITERAL   = 0x80;
+constexpr uint8_t TOKEN_COLOR_RUN = 0x40;
+constexpr uint8_t LITERAL_MASK    = 0x7F;
+constexpr uint8_t RUN_MASK        = 0x3F;
+
+ImageDecoder::ImageDecoder(const ImageAsset &asset, uint16_t backgroundColor)
+    : ImageDecoder(asset, backgroundColor, asset.foreground) {}
+
+ImageDecoder::ImageDecoder(const ImageAsset &asset, uint16_t backgroundColor,
+                           uint16_t foregroundColor)
+    : asset(asset), backgroundColor(backgroundColor) {
+    // Blend once per coverage level, so a mask decodes with table lookups only
+    for (uint8_t level = 0; level < MASK_LEVELS; level++) {
+        uint16_t coverage = 0;
+        if (asset.format == ImageFormat::MASK_1BPP) {
+            coverage = (level != 0) ? RGB565_ALPHA_ONE : 0;
+        } else if (level < asset.paletteSize) {
+            coverage = std::min<uint16_t>(pgm_read_word(&asset.palette[level]), RGB565_ALPHA_ONE);
+        }
+        tints[level] = blendRgb565(foregroundColor, backgroundColor, coverage);
+    }
+}
+
+auto ImageDecoder::readColor() -> uint16_t {
+    if (asset.format == ImageFormat::RLE_MASK) {
+        if (position >= asset.size) {
+            return backgroundColor;
+        }
+        uint8_t level = pgm_read_byte(&asset.data[position++]);
+        return (level < MASK_LEVELS) ? tints[level] : backgroundColor;
+    }
+
+    if (asset.format == ImageFormat::RLE_INDEXED) {
+        if (position >= asset.size) {
+            return backgroundColor;
+        }
+        uint8_t index = pgm_read_byte(&asset.data[position++]);
+        return (index < asset.paletteSize) ? pgm_read_word(&asset.palette[index])
+                                           : backgroundColor;
+    }
+
+    // RLE_DIRECT
+    if (position + 1 >= asset.size) {
+        position = asset.size;
+        return backgroundColor;
+    }
+    uint16_t color = pgm_read_byte(&asset.data[position])
+                     | (pgm_read_byte(&asset.data[position + 1]) << 8);
+    position += 2;
+    return color;
+}
+
+auto ImageDecoder::decodeRows(uint16_t *output, uint16_t rows) -> bool {
+    uint32_t count = (uint32_t)asset.width * rows;
+    switch (asset.format) {
+        case ImageFormat::RAW:         return decodeRaw(output, count);
+        case ImageFormat::MASK_1BPP:
+        case ImageFormat::MASK_2BPP:   return decodeMask(output, count);
+        case ImageFormat::RLE_INDEXED:
+        case ImageFormat::RLE_DIRECT:
+        case ImageFormat::RLE_MASK:    return decodeRuns(output, count);
+    }
+    std::fill_n(output, count, backgroundColor);
+    return false;
+}
+
+auto ImageDecoder::decodeRuns(uint16_t *output, uint32_t remaining) -> bool {
+    while (remaining > 0) {
+        if (runLength == 0) {
+            if (position >= asset.size) {
+                std::fill_n(output, remaining, backgroundColor);
+                return false;
+            }
+
+            uint8_t token = pgm_read_byte(&asset.data[position++]);
+            if ((token & TOKEN_LITERAL) != 0) {
+                literal   = true;
+                runLength = (token & LITERAL_MASK) + 1;
+            } else {
+                literal   = false;
+                runLength = (token & RUN_MASK) + 1;
+                runColor  = ((token & TOKEN_COLOR_RUN) != 0) ? readColor() : backgroundColor;
+            }
+        }
+
+        uint16_t count = std::min<uint32_t>(runLength, remaining);
+        if (literal) {
+            for (uint16_t i = 0; i < count; i++) {
+                output[i] = readColor();
+            }
+        } else {
+            std::fill_n(output, count, runColor);
+        }
+        output += count;
+        runLength -= count;
+        remaining -= count;
+    }
+    return true;
+}
+
+auto ImageDecoder::decodeRaw(uint16_t *output, uint32_t count) -> bool {
+    for (uint32_t i = 0; i < count; i++) {
+        if (position + 1 >= asset.size) {
+            std::fill_n(output + i, count - i, backgroundColor);
+            return false;
+        }
+        uint16_t color = pgm_read_byte(&asset.data[position])
+                         | (pgm_read_byte(&asset.data[position + 1]) << 8);
+        position += 2;
+        output[i] = (color != asset.transparentKey) ? color : backgroundColor;
+    }
+    return true;
+}
+
+auto ImageDecoder::decodeMask(uint16_t *output, uint32_t count) -> bool {
+    uint8_t bitsPerPixel  = (asset.format == ImageFormat::MASK_1BPP) ? 1 : 2;
+    uint8_t pixelsPerByte = 8 / bitsPerPixel;
+    uint8_t levelMask     = (1 << bitsPerPixel) - 1;
+    for (uint32_t i = 0; i < count; i++, position++) {
+        if ((position / pixelsPerByte) >= asset.size) {
+            std::fill_n(output + i, count - i, backgroundColor);
+            return false;
+        }
+        uint8_t bits  = pgm_read_byte(&asset.data[position / pixelsPerByte]);
+        uint8_t shift = 8 - (bitsPerPixel * ((position % pixelsPerByte) + 1));
+        output[i]     = tints[(bits >> shift) & levelMask];
+    }
+    return true;
+}
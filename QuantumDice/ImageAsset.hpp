@@ -0,0 +1,81 @@
+#ifndef IMAGEASSET_H_
+#define IMAGEASSET_H_
+
+#include <cstdint>
+
+/*
+   ImageAsset - packed RGB565 images
+
+   The headers in ImageLibrary/ are generated from the PNG files in assets/images by
+   scripts/image_assets.py, which picks the smallest of these formats per image:
+
+     RAW           Little-endian RGB565, one value per pixel
+     RLE_INDEXED   Run tokens with one-byte palette indices as colours
+     RLE_DIRECT    Run tokens with little-endian RGB565 values as colours
+     MASK_1BPP     One bit per pixel (MSB first), set bits take the foreground colour
+     MASK_2BPP     Two bits per pixel (MSB first), each a coverage level from the palette
+     RLE_MASK      Run tokens with one-byte coverage levels as colours
+
+   Run tokens are scanned left to right and top to bottom, and may cross row boundaries:
+
+     00nnnnnn                n+1 transparent pixels
+     01nnnnnn <colour>       n+1 pixels of one colour
+     1nnnnnnn <colour> ...   n+1 literal pixels, one colour each
+
+   The mask formats hold single-colour glyphs. The palette of MASK_2BPP and RLE_MASK lists up to
+   MASK_LEVELS coverage values (0 - RGB565_ALPHA_ONE), and the glyph is blended over the background
+   in a foreground colour chosen when drawing, so one asset serves every colour.
+
+   The descriptors are constexpr, so size and format are known at compile time.
+*/
+
+enum class ImageFormat : uint8_t {
+    RAW,
+    RLE_INDEXED,
+    RLE_DIRECT,
+    MASK_1BPP,
+    MASK_2BPP,
+    RLE_MASK
+};
+
+constexpr uint8_t MASK_LEVELS = 4;
+
+struct ImageAsset {
+    uint16_t        width;
+    uint16_t        height;
+    ImageFormat     format;
+    uint16_t        transparentKey; // Pixels with this colour show the background
+    uint16_t        foreground;     // Mask formats: colour used when the caller picks none
+    const uint16_t *palette;        // RLE_INDEXED colours, MASK_2BPP and RLE_MASK coverage
+    uint16_t        paletteSize;
+    const uint8_t  *data;
+    uint32_t        size; // Bytes in data
+};
+
+// Streams an asset row by row, replacing transparent pixels by a background colour
+class ImageDecoder {
+  public:
+    ImageDecoder(const ImageAsset &asset, uint16_t backgroundColor);
+    // Mask formats are tinted in foregroundColor instead of asset.foreground
+    ImageDecoder(const ImageAsset &asset, uint16_t backgroundColor, uint16_t foregroundColor);
+
+    // Decode the next rows into output, asset.width pixels per row. Returns false when the data
+    // runs out early; the remaining pixels are then filled with the background colour.
+    auto decodeRows(uint16_t *output, uint16_t rows) -> bool;
+
+  private:
+    auto decodeRuns(uint16_t *output, uint32_t count) -> bool;
+    auto decodeRaw(uint16_t *output, uint32_t count) -> bool;
+    auto decodeMask(uint16_t *output, uint32_t count) -> bool;
+    auto readColor() -> uint16_t;
+
+    const ImageAsset &asset;
+    uint16_t          backgroundColor;
+    uint32_t          position  = 0;     // Next byte in asset.data (next pixel for MASK_*BPP)
+    uint16_t          runLength = 0;     // Pixels left in the current run
+    bool              literal   = false; // Current run reads one colour per pixel
+    uint16_t          runColor  = 0;
+    uint16_t          tints[MASK_LEVELS]; // Mask formats: foreground blended at every level
+};
+
+#endif /* IMAGEASSET_H_ */
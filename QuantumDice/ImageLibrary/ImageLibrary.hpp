@@ -1,16 +1,14 @@
-#ifndef IMAGELIBRARY_H
-#define IMAGELIBRARY_H
-
-#include "cross.hpp"
-#include "circle.hpp"
-#include "crossCircle.hpp"
-#include "entangled.hpp"
-#include "God_does_not_play_dice.hpp"
-#include "lowBattery.hpp"
-#include "new_die.hpp"
-#include "quantum_labs_twente_RGB.hpp"
-#include "UTwente_logo.hpp"
-#include "QRCode.hpp"
-// Add more includes as needed
-
-#endif
\ No newline at end of file
+// Generated by scripts/image_assets.py - do not edit
+// Add an image by dropping a PNG into assets/images and running the script.
+
+#ifndef IMAGELIBRARY_H
+#define IMAGELIBRARY_H
+
+#include "entangled.hpp"
+#include "God_does_not_play_dice.hpp"
+#include "low_battery.hpp"
+#include "new_die.hpp"
+#include "quantum_labs_twente_RGB.hpp"
+#include "UTwente_logo.hpp"
+
+#endif
@@ -1,3617 +1,261 @@
-// Generated by   : ImageConverter 565 Online
-// Generated from : entangled.png
-// Time generated : Mon, 05 Aug 24 09:43:11 +0200  (Server timezone: CET)
-// Image Size     : 240x240 pixels
-// Memory usage   : 115200 bytes
+// Generated by scripts/image_assets.py from assets/images/entangled.png - do not edit
+// Image Size     : 240x240 pixels, RLE_MASK
+// Memory usage   : 3787 bytes (raw 115200 bytes)
 
+#ifndef IMAGELIBRARY_ENTANGLED_H_
+#define IMAGELIBRARY_ENTANGLED_H_
 
-#if defined(__AVR__)
-    #include <avr/pgmspace.h>
-#elif defined(__PIC32MX__)
-    #define PROGMEM
-#elif defined(__arm__)
-    #define PROGMEM
-#endif
+#include "../ImageAsset.hpp"
 
-const unsigned short entangled[57600] PROGMEM={
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0010 (16) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0020 (32) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0030 (48) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0040 (64) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0050 (80) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0060 (96) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0070 (112) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0080 (128) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0090 (144) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x00A0 (160) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x00B0 (176) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x00C0 (192) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x00D0 (208) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x00E0 (224) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x00F0 (240) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0100 (256) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0110 (272) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0120 (288) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0130 (304) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0140 (320) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0150 (336) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0160 (352) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0170 (368) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0180 (384) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0190 (400) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x01A0 (416) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x01B0 (432) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x01C0 (448) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x01D0 (464) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x01E0 (480) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x01F0 (496) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0200 (512) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0210 (528) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0220 (544) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0230 (560) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0240 (576) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0250 (592) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0260 (608) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0270 (624) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0280 (640) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0290 (656) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x02A0 (672) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x02B0 (688) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x02C0 (704) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x02D0 (720) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x02E0 (736) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x02F0 (752) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0300 (768) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0310 (784) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0320 (800) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0330 (816) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0340 (832) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0350 (848) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0360 (864) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0370 (880) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0380 (896) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0390 (912) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x03A0 (928) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x03B0 (944) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x03C0 (960) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x03D0 (976) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x03E0 (992) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x03F0 (1008) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0400 (1024) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0410 (1040) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0420 (1056) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0430 (1072) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0440 (1088) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0450 (1104) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0460 (1120) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0470 (1136) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0480 (1152) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0490 (1168) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x04A0 (1184) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x04B0 (1200) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x04C0 (1216) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x04D0 (1232) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x04E0 (1248) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x04F0 (1264) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0500 (1280) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0510 (1296) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0520 (1312) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0530 (1328) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0540 (1344) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0550 (1360) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0560 (1376) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0570 (1392) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0580 (1408) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0590 (1424) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x05A0 (1440) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x05B0 (1456) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x05C0 (1472) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x05D0 (1488) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x05E0 (1504) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x05F0 (1520) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0600 (1536) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0610 (1552) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0620 (1568) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0630 (1584) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0640 (1600) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0650 (1616) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0660 (1632) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0670 (1648) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0680 (1664) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0690 (1680) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x06A0 (1696) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x06B0 (1712) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x06C0 (1728) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x06D0 (1744) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x06E0 (1760) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x06F0 (1776) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0700 (1792) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0710 (1808) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0720 (1824) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0730 (1840) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0740 (1856) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0750 (1872) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0760 (1888) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0770 (1904) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0780 (1920) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0790 (1936) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x07A0 (1952) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x07B0 (1968) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x07C0 (1984) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x07D0 (2000) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x07E0 (2016) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x07F0 (2032) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0800 (2048) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0810 (2064) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0820 (2080) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0830 (2096) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0840 (2112) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0850 (2128) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0860 (2144) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0870 (2160) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0880 (2176) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0890 (2192) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x08A0 (2208) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x08B0 (2224) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x08C0 (2240) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x08D0 (2256) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x08E0 (2272) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x08F0 (2288) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0900 (2304) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0910 (2320) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0920 (2336) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0930 (2352) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0940 (2368) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0950 (2384) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0960 (2400) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0970 (2416) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0980 (2432) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0990 (2448) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x09A0 (2464) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x09B0 (2480) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x09C0 (2496) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x09D0 (2512) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x09E0 (2528) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x09F0 (2544) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0A00 (2560) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0A10 (2576) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0A20 (2592) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0A30 (2608) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0A40 (2624) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0A50 (2640) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0A60 (2656) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0A70 (2672) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0A80 (2688) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0A90 (2704) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0AA0 (2720) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0AB0 (2736) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0AC0 (2752) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0AD0 (2768) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0AE0 (2784) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0AF0 (2800) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0B00 (2816) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0B10 (2832) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0B20 (2848) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0B30 (2864) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0B40 (2880) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0B50 (2896) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0B60 (2912) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0B70 (2928) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0B80 (2944) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0B90 (2960) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0BA0 (2976) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0BB0 (2992) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0BC0 (3008) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0BD0 (3024) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0BE0 (3040) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0BF0 (3056) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0C00 (3072) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0C10 (3088) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0C20 (3104) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0C30 (3120) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0C40 (3136) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0C50 (3152) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0C60 (3168) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0C70 (3184) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0C80 (3200) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0C90 (3216) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0CA0 (3232) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0CB0 (3248) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0CC0 (3264) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0CD0 (3280) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0CE0 (3296) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0CF0 (3312) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0D00 (3328) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0D10 (3344) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0D20 (3360) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0D30 (3376) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0D40 (3392) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0D50 (3408) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0D60 (3424) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0D70 (3440) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0D80 (3456) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0D90 (3472) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0DA0 (3488) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0DB0 (3504) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0DC0 (3520) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0DD0 (3536) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0DE0 (3552) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0DF0 (3568) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0E00 (3584) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0E10 (3600) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0E20 (3616) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0E30 (3632) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0E40 (3648) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0E50 (3664) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0E60 (3680) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0E70 (3696) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1080, 0x18E1, 0x2941, 0x31A2, 0x41E2,   // 0x0E80 (3712) pixels
-0x4A43, 0x5AA3, 0x62E4, 0x6B24, 0x7364, 0x7385, 0x7B85, 0x7BA5, 0x7BA5, 0x7BA5, 0x7B85, 0x7365, 0x6B44, 0x6304, 0x5AA3, 0x5263,   // 0x0E90 (3728) pixels
-0x4203, 0x39A2, 0x2942, 0x20E1, 0x1080, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0EA0 (3744) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0EB0 (3760) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0EC0 (3776) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0ED0 (3792) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0EE0 (3808) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0EF0 (3824) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0F00 (3840) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0F10 (3856) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0F20 (3872) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0F30 (3888) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0F40 (3904) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0F50 (3920) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0F60 (3936) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x18C1, 0x3162, 0x4A23, 0x62E4, 0x7BA5, 0x8C26, 0xA4C6, 0xAD07, 0xB567, 0xBD88, 0xBDA8,   // 0x0F70 (3952) pixels
-0xC5A8, 0xC5A8, 0xC5C8, 0xC5C8, 0xC5C8, 0xC5C8, 0xC5C8, 0xC5C8, 0xC5C8, 0xC5C8, 0xC5C8, 0xC5C8, 0xC5C8, 0xC5C8, 0xC5A8, 0xC5A8,   // 0x0F80 (3968) pixels
-0xC5A8, 0xBD88, 0xBD67, 0xAD27, 0xA4C7, 0x9446, 0x83C5, 0x6B04, 0x4A43, 0x3182, 0x18E1, 0x0860, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0F90 (3984) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0FA0 (4000) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0FB0 (4016) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0FC0 (4032) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0FD0 (4048) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0FE0 (4064) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0FF0 (4080) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1000 (4096) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1010 (4112) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1020 (4128) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1030 (4144) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1040 (4160) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,   // 0x1050 (4176) pixels
-0x18A1, 0x3182, 0x5283, 0x7B85, 0x9466, 0xAD07, 0xBD67, 0xC5A8, 0xC5C8, 0xC5C8, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x1060 (4192) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x1070 (4208) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8, 0xC5C8, 0xC5C8, 0xC5A8, 0xBD87, 0xAD27, 0x9CA6, 0x83C5, 0x5AC4, 0x39C2, 0x18E1,   // 0x1080 (4224) pixels
-0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1090 (4240) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x10A0 (4256) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x10B0 (4272) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x10C0 (4288) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x10D0 (4304) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x10E0 (4320) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x10F0 (4336) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1100 (4352) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1110 (4368) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1120 (4384) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1130 (4400) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x18C1, 0x39C2, 0x6304, 0x8C06,   // 0x1140 (4416) pixels
-0xA4E7, 0xBD87, 0xC5A8, 0xC5C8, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x1150 (4432) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x1160 (4448) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8, 0xC5C8, 0xC5A8, 0xBD88, 0xAD07,   // 0x1170 (4464) pixels
-0x9446, 0x6B44, 0x4202, 0x20E1, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1180 (4480) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1190 (4496) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x11A0 (4512) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x11B0 (4528) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x11C0 (4544) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x11D0 (4560) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x11E0 (4576) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x11F0 (4592) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1200 (4608) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1210 (4624) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1220 (4640) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x2941, 0x5AA3, 0x83E5, 0xACE7, 0xBD88, 0xC5C8, 0xC5C8,   // 0x1230 (4656) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x1240 (4672) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x1250 (4688) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x1260 (4704) pixels
-0xC5C8, 0xC5C8, 0xBD88, 0xAD27, 0x8C26, 0x62E4, 0x3182, 0x1060, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1270 (4720) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1280 (4736) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1290 (4752) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x12A0 (4768) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x12B0 (4784) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x12C0 (4800) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x12D0 (4816) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x12E0 (4832) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x12F0 (4848) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1300 (4864) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1310 (4880) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x3162, 0x62E4, 0x9446, 0xB547, 0xC5A8, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x1320 (4896) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x1330 (4912) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x1340 (4928) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x1350 (4944) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8, 0xC5C8, 0xBD67, 0x9CA6, 0x6B44, 0x39C2, 0x1080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1360 (4960) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1370 (4976) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1380 (4992) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1390 (5008) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x13A0 (5024) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x13B0 (5040) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x13C0 (5056) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x13D0 (5072) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x13E0 (5088) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x13F0 (5104) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1400 (5120) pixels
-0x0000, 0x0000, 0x0020, 0x2921, 0x5AC4, 0x9466, 0xB567, 0xC5C8, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x1410 (5136) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x1420 (5152) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x1430 (5168) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x1440 (5184) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8, 0xC5C8, 0xBD88, 0x9CA6, 0x6B24, 0x3182, 0x0860, 0x0000, 0x0000,   // 0x1450 (5200) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1460 (5216) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1470 (5232) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1480 (5248) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1490 (5264) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x14A0 (5280) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x14B0 (5296) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x14C0 (5312) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x14D0 (5328) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x14E0 (5344) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x14F0 (5360) pixels
-0x18A1, 0x4A23, 0x8C05, 0xB547, 0xC5A8, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x1500 (5376) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x1510 (5392) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x1520 (5408) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x1530 (5424) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8, 0xBD67, 0x9466, 0x5A83, 0x2101,   // 0x1540 (5440) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1550 (5456) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1560 (5472) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1570 (5488) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1580 (5504) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1590 (5520) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x15A0 (5536) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x15B0 (5552) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x15C0 (5568) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x15D0 (5584) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x2921, 0x6B04,   // 0x15E0 (5600) pixels
-0xA4C7, 0xBDA8, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x15F0 (5616) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x1600 (5632) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x1610 (5648) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x1620 (5664) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8, 0xC5A8, 0xAD07,   // 0x1630 (5680) pixels
-0x7B85, 0x3182, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1640 (5696) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1650 (5712) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1660 (5728) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1670 (5744) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1680 (5760) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1690 (5776) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x16A0 (5792) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x16B0 (5808) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x16C0 (5824) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x39A2, 0x7BC5, 0xB547, 0xC5A8,   // 0x16D0 (5840) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x16E0 (5856) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x16F0 (5872) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x1700 (5888) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x1710 (5904) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x1720 (5920) pixels
-0xC5C8, 0xBD67, 0x8C26, 0x4A23, 0x1080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1730 (5936) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1740 (5952) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1750 (5968) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1760 (5984) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1770 (6000) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1780 (6016) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1790 (6032) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x17A0 (6048) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x17B0 (6064) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0860, 0x41E2, 0x8C26, 0xBD67, 0xC5C8, 0xC5A8, 0xC5A8,   // 0x17C0 (6080) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x17D0 (6096) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x17E0 (6112) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x17F0 (6128) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x1800 (6144) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x1810 (6160) pixels
-0xC5A8, 0xC5A8, 0xC5C8, 0xBD88, 0x9C86, 0x5263, 0x10A0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1820 (6176) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1830 (6192) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1840 (6208) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1850 (6224) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1860 (6240) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1870 (6256) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1880 (6272) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1890 (6288) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x18A0 (6304) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x4203, 0x9446, 0xBD88, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x18B0 (6320) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x18C0 (6336) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x18D0 (6352) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x18E0 (6368) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x18F0 (6384) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x1900 (6400) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8, 0xC5A8, 0x9CA6, 0x5A83, 0x1080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1910 (6416) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1920 (6432) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1930 (6448) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1940 (6464) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1950 (6480) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1960 (6496) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1970 (6512) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1980 (6528) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1990 (6544) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x41E2, 0x8C26, 0xBD88, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x19A0 (6560) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x19B0 (6576) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x19C0 (6592) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x19D0 (6608) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x19E0 (6624) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x19F0 (6640) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8, 0xC5A8, 0x9CA6, 0x5263, 0x1060, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1A00 (6656) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1A10 (6672) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1A20 (6688) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1A30 (6704) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1A40 (6720) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1A50 (6736) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1A60 (6752) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1A70 (6768) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1A80 (6784) pixels
-0x0000, 0x0000, 0x0000, 0x0020, 0x3162, 0x83E5, 0xBD67, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x1A90 (6800) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x1AA0 (6816) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x1AB0 (6832) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x1AC0 (6848) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x1AD0 (6864) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x1AE0 (6880) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8, 0xBDA8, 0x9466, 0x4202, 0x0840, 0x0000, 0x0000, 0x0000,   // 0x1AF0 (6896) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1B00 (6912) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1B10 (6928) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1B20 (6944) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1B30 (6960) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1B40 (6976) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1B50 (6992) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1B60 (7008) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1B70 (7024) pixels
-0x0000, 0x0000, 0x20E1, 0x7344, 0xB547, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x1B80 (7040) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x1B90 (7056) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x1BA0 (7072) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x1BB0 (7088) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x1BC0 (7104) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x1BD0 (7120) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8, 0xBD88, 0x83E5, 0x3162, 0x0000, 0x0000,   // 0x1BE0 (7136) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1BF0 (7152) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1C00 (7168) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1C10 (7184) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1C20 (7200) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1C30 (7216) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1C40 (7232) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1C50 (7248) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1C60 (7264) pixels
-0x0860, 0x5283, 0xACE7, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x1C70 (7280) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x1C80 (7296) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x1C90 (7312) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x1CA0 (7328) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x1CB0 (7344) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x1CC0 (7360) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8, 0xB547, 0x6B24, 0x18C1,   // 0x1CD0 (7376) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1CE0 (7392) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1CF0 (7408) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1D00 (7424) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1D10 (7440) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1D20 (7456) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1D30 (7472) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1D40 (7488) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3162,   // 0x1D50 (7504) pixels
-0x8C26, 0xBDA8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x1D60 (7520) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x1D70 (7536) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x1D80 (7552) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x1D90 (7568) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x1DA0 (7584) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x1DB0 (7600) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xA4A6,   // 0x1DC0 (7616) pixels
-0x4203, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1DD0 (7632) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1DE0 (7648) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1DF0 (7664) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1E00 (7680) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1E10 (7696) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1E20 (7712) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1E30 (7728) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1080, 0x6304, 0xB547,   // 0x1E40 (7744) pixels
-0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x1E50 (7760) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x1E60 (7776) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x1E70 (7792) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x1E80 (7808) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x1E90 (7824) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x1EA0 (7840) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8,   // 0x1EB0 (7856) pixels
-0xBD87, 0x7BA5, 0x20E1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1EC0 (7872) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1ED0 (7888) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1EE0 (7904) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1EF0 (7920) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1F00 (7936) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1F10 (7952) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1F20 (7968) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2921, 0x6B24, 0x9C86, 0xC5A8, 0xC5A8,   // 0x1F30 (7984) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x1F40 (8000) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x1F50 (8016) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x1F60 (8032) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x1F70 (8048) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x1F80 (8064) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x1F90 (8080) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x1FA0 (8096) pixels
-0xC5A8, 0xC5A8, 0xA4E7, 0x7364, 0x39C2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1FB0 (8112) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1FC0 (8128) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1FD0 (8144) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1FE0 (8160) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1FF0 (8176) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2000 (8192) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2010 (8208) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3182, 0xBD88, 0xEF0A, 0xE6A9, 0xC5C8, 0xC5A8,   // 0x2020 (8224) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x2030 (8240) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x2040 (8256) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x2050 (8272) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x2060 (8288) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x2070 (8304) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x2080 (8320) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x2090 (8336) pixels
-0xC5A8, 0xC5A8, 0xDE69, 0xF70A, 0xD628, 0x4A43, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x20A0 (8352) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x20B0 (8368) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x20C0 (8384) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x20D0 (8400) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x20E0 (8416) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x20F0 (8432) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2100 (8448) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x39C2, 0xC5C8, 0xF70A, 0xF70A, 0xF70A, 0xDE89, 0xC5C8,   // 0x2110 (8464) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x2120 (8480) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x2130 (8496) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x2140 (8512) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x2150 (8528) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x2160 (8544) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x2170 (8560) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x2180 (8576) pixels
-0xC5A8, 0xDE69, 0xEF0A, 0xF70A, 0xF70A, 0xDE69, 0x5AA3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2190 (8592) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x21A0 (8608) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x21B0 (8624) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x21C0 (8640) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x21D0 (8656) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x21E0 (8672) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x21F0 (8688) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5263, 0xD628, 0xF72A, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xDE89,   // 0x2200 (8704) pixels
-0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x2210 (8720) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x2220 (8736) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x2230 (8752) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x2240 (8768) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x2250 (8784) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x2260 (8800) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x2270 (8816) pixels
-0xDE69, 0xEF0A, 0xF70A, 0xEF0A, 0xEF0A, 0xF70A, 0xE6A9, 0x6B44, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2280 (8832) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2290 (8848) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x22A0 (8864) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x22B0 (8880) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x22C0 (8896) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x22D0 (8912) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x22E0 (8928) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0860, 0x7344, 0xE689, 0xF72A, 0xEF0A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xF70A,   // 0x22F0 (8944) pixels
-0xDE89, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x2300 (8960) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x2310 (8976) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x2320 (8992) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x2330 (9008) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x2340 (9024) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x2350 (9040) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xDE69,   // 0x2360 (9056) pixels
-0xEF0A, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEEEA, 0x8C46, 0x18C1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2370 (9072) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2380 (9088) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2390 (9104) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x23A0 (9120) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x23B0 (9136) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x23C0 (9152) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x23D0 (9168) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18C1, 0x8C26, 0xE6C9, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A,   // 0x23E0 (9184) pixels
-0xF70A, 0xDE89, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x23F0 (9200) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x2400 (9216) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x2410 (9232) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x2420 (9248) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x2430 (9264) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x2440 (9280) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xDE69, 0xEF0A,   // 0x2450 (9296) pixels
-0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEF0A, 0xAD07, 0x2962, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2460 (9312) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2470 (9328) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2480 (9344) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2490 (9360) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x24A0 (9376) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x24B0 (9392) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x24C0 (9408) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x2941, 0xA4E7, 0xEEEA, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A,   // 0x24D0 (9424) pixels
-0xF70A, 0xF70A, 0xDE89, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x24E0 (9440) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x24F0 (9456) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x2500 (9472) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x2510 (9488) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x2520 (9504) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x2530 (9520) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xDE69, 0xEF0A, 0xF70A,   // 0x2540 (9536) pixels
-0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEF0A, 0xBD88, 0x4203, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2550 (9552) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2560 (9568) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2570 (9584) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2580 (9600) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2590 (9616) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x25A0 (9632) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x25B0 (9648) pixels
-0x0000, 0x0000, 0x0000, 0x41E2, 0xB547, 0xEEEA, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x25C0 (9664) pixels
-0xEF0A, 0xF70A, 0xF70A, 0xDE89, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x25D0 (9680) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x25E0 (9696) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x25F0 (9712) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x2600 (9728) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x2610 (9744) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x2620 (9760) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xDE69, 0xEF0A, 0xF70A, 0xEF0A,   // 0x2630 (9776) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEF0A, 0xC5E8, 0x5AA3, 0x0020, 0x0000, 0x0000,   // 0x2640 (9792) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2650 (9808) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2660 (9824) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2670 (9840) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2680 (9856) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2690 (9872) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x26A0 (9888) pixels
-0x0000, 0x0020, 0x5263, 0xBD88, 0xEEEA, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x26B0 (9904) pixels
-0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xDE89, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x26C0 (9920) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x26D0 (9936) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x26E0 (9952) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x26F0 (9968) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x2700 (9984) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x2710 (10000) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xDE49, 0xEF0A, 0xF70A, 0xEF0A, 0xF70A,   // 0x2720 (10016) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEEEA, 0xCE08, 0x6B24, 0x0860, 0x0000,   // 0x2730 (10032) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2740 (10048) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2750 (10064) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2760 (10080) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2770 (10096) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2780 (10112) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2790 (10128) pixels
-0x0820, 0x62C4, 0xC5C8, 0xEEEA, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x27A0 (10144) pixels
-0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xDE89, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x27B0 (10160) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x27C0 (10176) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x27D0 (10192) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x27E0 (10208) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x27F0 (10224) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x2800 (10240) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xDE69, 0xEF0A, 0xF70A, 0xEF0A, 0xF70A, 0xF70A,   // 0x2810 (10256) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEEEA, 0xD628, 0x7BA5, 0x1080,   // 0x2820 (10272) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2830 (10288) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2840 (10304) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2850 (10320) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2860 (10336) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2870 (10352) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840,   // 0x2880 (10368) pixels
-0x6B24, 0xCDE8, 0xEEE9, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x2890 (10384) pixels
-0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xDE89, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x28A0 (10400) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x28B0 (10416) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x28C0 (10432) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x28D0 (10448) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x28E0 (10464) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x28F0 (10480) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xDE69, 0xEF0A, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A,   // 0x2900 (10496) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEEEA, 0xD629, 0x83E5,   // 0x2910 (10512) pixels
-0x18A1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2920 (10528) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2930 (10544) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2940 (10560) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2950 (10576) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2960 (10592) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0860, 0x7364,   // 0x2970 (10608) pixels
-0xCDE8, 0xEEC9, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x2980 (10624) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xDE89, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x2990 (10640) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x29A0 (10656) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x29B0 (10672) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x29C0 (10688) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x29D0 (10704) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x29E0 (10720) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xD649, 0xEF0A, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x29F0 (10736) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEEEA, 0xD629,   // 0x2A00 (10752) pixels
-0x8C26, 0x18C1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2A10 (10768) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2A20 (10784) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2A30 (10800) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2A40 (10816) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2A50 (10832) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0860, 0x7365, 0xCDE8,   // 0x2A60 (10848) pixels
-0xEEC9, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x2A70 (10864) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xDE89, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x2A80 (10880) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x2A90 (10896) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x2AA0 (10912) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x2AB0 (10928) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x2AC0 (10944) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x2AD0 (10960) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xDE49, 0xEF0A, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x2AE0 (10976) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEEEA,   // 0x2AF0 (10992) pixels
-0xD629, 0x9446, 0x18E1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2B00 (11008) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2B10 (11024) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2B20 (11040) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2B30 (11056) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2B40 (11072) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0860, 0x7B85, 0xCDE8, 0xEEC9,   // 0x2B50 (11088) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x2B60 (11104) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xDE89, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x2B70 (11120) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x2B80 (11136) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x2B90 (11152) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x2BA0 (11168) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x2BB0 (11184) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x2BC0 (11200) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xDE69, 0xEF0A, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x2BD0 (11216) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A,   // 0x2BE0 (11232) pixels
-0xEEEA, 0xD629, 0x9446, 0x18C1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2BF0 (11248) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2C00 (11264) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2C10 (11280) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2C20 (11296) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2C30 (11312) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0860, 0x7365, 0xCDE8, 0xEEC9, 0xF70A,   // 0x2C40 (11328) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x2C50 (11344) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xDE89, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x2C60 (11360) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x2C70 (11376) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x2C80 (11392) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x2C90 (11408) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x2CA0 (11424) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x2CB0 (11440) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xDE49, 0xEF0A, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x2CC0 (11456) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A,   // 0x2CD0 (11472) pixels
-0xF70A, 0xEEEA, 0xD629, 0x9446, 0x18C1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2CE0 (11488) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2CF0 (11504) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2D00 (11520) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2D10 (11536) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2D20 (11552) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x6B44, 0xCDE8, 0xEEC9, 0xF70A, 0xF70A,   // 0x2D30 (11568) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x2D40 (11584) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEF0A, 0xDE89, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x2D50 (11600) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x2D60 (11616) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x2D70 (11632) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x2D80 (11648) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x2D90 (11664) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x2DA0 (11680) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xD649, 0xEF0A, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x2DB0 (11696) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x2DC0 (11712) pixels
-0xEF0A, 0xF70A, 0xEEEA, 0xD629, 0x8C26, 0x10A0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2DD0 (11728) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2DE0 (11744) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2DF0 (11760) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2E00 (11776) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2E10 (11792) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x6304, 0xCDE8, 0xEEC9, 0xF70A, 0xF70A, 0xF70A,   // 0x2E20 (11808) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x2E30 (11824) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xDE89, 0xC5C8, 0xC5A8, 0xC5A8,   // 0x2E40 (11840) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x2E50 (11856) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x2E60 (11872) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x2E70 (11888) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x2E80 (11904) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x2E90 (11920) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xD649, 0xEF0A, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x2EA0 (11936) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x2EB0 (11952) pixels
-0xF70A, 0xEF0A, 0xF70A, 0xEEEA, 0xD629, 0x83E5, 0x1080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2EC0 (11968) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2ED0 (11984) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2EE0 (12000) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2EF0 (12016) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2F00 (12032) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5AA3, 0xC5C8, 0xEEC9, 0xF70A, 0xEF0A, 0xF70A, 0xF70A,   // 0x2F10 (12048) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x2F20 (12064) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xDE89, 0xC5C8, 0xC5A8,   // 0x2F30 (12080) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x2F40 (12096) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8,   // 0x2F50 (12112) pixels
-0xC5C8, 0xC5C8, 0xC5C8, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xBDA8, 0xBDA8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8, 0xC5C8, 0xC5C8, 0xC5C8,   // 0x2F60 (12128) pixels
-0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x2F70 (12144) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x2F80 (12160) pixels
-0xC5A8, 0xC5A8, 0xD649, 0xEF0A, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x2F90 (12176) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x2FA0 (12192) pixels
-0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEEEA, 0xD629, 0x7B85, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2FB0 (12208) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2FC0 (12224) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2FD0 (12240) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2FE0 (12256) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2FF0 (12272) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4A23, 0xC5A8, 0xEEE9, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A,   // 0x3000 (12288) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x3010 (12304) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xDE89, 0xC5C8,   // 0x3020 (12320) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x3030 (12336) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8, 0xC5C8, 0xC5A8, 0xBD88, 0xB547, 0xAD07, 0x9CA6,   // 0x3040 (12352) pixels
-0x8C26, 0x7BA5, 0x6B24, 0x62C4, 0x5283, 0x4A43, 0x4A23, 0x4203, 0x4203, 0x4A23, 0x4A43, 0x5283, 0x5AC4, 0x6B24, 0x7B85, 0x8C05,   // 0x3050 (12368) pixels
-0x9C86, 0xACE7, 0xB547, 0xBD88, 0xC5A8, 0xC5C8, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x3060 (12384) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x3070 (12400) pixels
-0xC5A8, 0xD649, 0xEF0A, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x3080 (12416) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x3090 (12432) pixels
-0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEEEA, 0xD628, 0x6B04, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x30A0 (12448) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x30B0 (12464) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x30C0 (12480) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x30D0 (12496) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x30E0 (12512) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x39A2, 0xBD88, 0xEEE9, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x30F0 (12528) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x3100 (12544) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEF0A, 0xDE89,   // 0x3110 (12560) pixels
-0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x3120 (12576) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8, 0xC5C8, 0xBDA8, 0xB527, 0x9CA6, 0x7BA5, 0x5AC4, 0x41E2, 0x2921, 0x18C1, 0x0860,   // 0x3130 (12592) pixels
-0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,   // 0x3140 (12608) pixels
-0x0860, 0x10A1, 0x2121, 0x39C2, 0x5AA3, 0x7B85, 0x9C86, 0xAD27, 0xBD88, 0xC5C8, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x3150 (12624) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x3160 (12640) pixels
-0xD649, 0xEF0A, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x3170 (12656) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x3180 (12672) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEEEA, 0xCE08, 0x5283, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3190 (12688) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x31A0 (12704) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x31B0 (12720) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x31C0 (12736) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x31D0 (12752) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2101, 0xAD07, 0xEEEA, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x31E0 (12768) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x31F0 (12784) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEF0A,   // 0x3200 (12800) pixels
-0xDE89, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x3210 (12816) pixels
-0xC5A8, 0xC5A8, 0xC5C8, 0xC5A8, 0xB547, 0x9C86, 0x7344, 0x4203, 0x2101, 0x0860, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3220 (12832) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3230 (12848) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0860, 0x20E1, 0x41E2, 0x6B24, 0x9446, 0xB547, 0xC5A8, 0xC5C8, 0xC5A8, 0xC5A8,   // 0x3240 (12864) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xD649,   // 0x3250 (12880) pixels
-0xEF0A, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x3260 (12896) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x3270 (12912) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEEEA, 0xC5C8, 0x41E2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3280 (12928) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3290 (12944) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x32A0 (12960) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x32B0 (12976) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x32C0 (12992) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A0, 0x9C86, 0xEEEA, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x32D0 (13008) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x32E0 (13024) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A,   // 0x32F0 (13040) pixels
-0xEF0A, 0xDE89, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8,   // 0x3300 (13056) pixels
-0xC5A8, 0xB527, 0x8C26, 0x5A83, 0x2941, 0x0860, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3310 (13072) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3320 (13088) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x2121, 0x5263, 0x83E5, 0xAD07, 0xC5A8,   // 0x3330 (13104) pixels
-0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xD649, 0xEF0A,   // 0x3340 (13120) pixels
-0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x3350 (13136) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x3360 (13152) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEF0A, 0xBD67, 0x2941, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3370 (13168) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3380 (13184) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3390 (13200) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x33A0 (13216) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x33B0 (13232) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x83C5, 0xEEC9, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x33C0 (13248) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x33D0 (13264) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A,   // 0x33E0 (13280) pixels
-0xF70A, 0xEF0A, 0xDE89, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8, 0xBD67, 0x9446,   // 0x33F0 (13296) pixels
-0x5AA3, 0x2121, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3400 (13312) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3410 (13328) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x20E1, 0x5263,   // 0x3420 (13344) pixels
-0x8C05, 0xB547, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xD649, 0xEF0A, 0xF70A,   // 0x3430 (13360) pixels
-0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x3440 (13376) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x3450 (13392) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEF0A, 0xA4C7, 0x10A1, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3460 (13408) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3470 (13424) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3480 (13440) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3490 (13456) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x34A0 (13472) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x62E4, 0xE6A9, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x34B0 (13488) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x34C0 (13504) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x34D0 (13520) pixels
-0xEF0A, 0xF70A, 0xEF0A, 0xDE89, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xAD07, 0x7365, 0x3182, 0x0840,   // 0x34E0 (13536) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x34F0 (13552) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3500 (13568) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3510 (13584) pixels
-0x0820, 0x2941, 0x6B24, 0xA4C7, 0xC5A8, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xD649, 0xEF0A, 0xF70A, 0xEF0A,   // 0x3520 (13600) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x3530 (13616) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x3540 (13632) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEF0A, 0x8C05, 0x0840, 0x0000, 0x0000, 0x0000,   // 0x3550 (13648) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3560 (13664) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3570 (13680) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3580 (13696) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3590 (13712) pixels
-0x0000, 0x0000, 0x0000, 0x41E2, 0xDE69, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x35A0 (13728) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x35B0 (13744) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x35C0 (13760) pixels
-0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xDE89, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xA4C6, 0x62C4, 0x18E1, 0x0000, 0x0000, 0x0000,   // 0x35D0 (13776) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x35E0 (13792) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x35F0 (13808) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3600 (13824) pixels
-0x0000, 0x0000, 0x0000, 0x18A1, 0x5283, 0x9C86, 0xBD88, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xD649, 0xEF0A, 0xF70A, 0xEF0A, 0xF70A,   // 0x3610 (13840) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x3620 (13856) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x3630 (13872) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEEC9, 0x6304, 0x0000, 0x0000, 0x0000,   // 0x3640 (13888) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3650 (13904) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3660 (13920) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3670 (13936) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3680 (13952) pixels
-0x0000, 0x0000, 0x3162, 0xCDE8, 0xF72A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x3690 (13968) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x36A0 (13984) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x36B0 (14000) pixels
-0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEF0A, 0xDE89, 0xC5C8, 0xBDA8, 0xA4A6, 0x5283, 0x10A0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x36C0 (14016) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x36D0 (14032) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x36E0 (14048) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x36F0 (14064) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1060, 0x4A23, 0x9466, 0xBD88, 0xC5A8, 0xD649, 0xEF0A, 0xF70A, 0xEF0A, 0xF70A, 0xF70A,   // 0x3700 (14080) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x3710 (14096) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x3720 (14112) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xDE89, 0x5263, 0x0000, 0x0000,   // 0x3730 (14128) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3740 (14144) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3750 (14160) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3760 (14176) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3770 (14192) pixels
-0x0000, 0x2941, 0xBD88, 0xF72A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x3780 (14208) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x3790 (14224) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x37A0 (14240) pixels
-0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xD629, 0x6304, 0x1080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x37B0 (14256) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x37C0 (14272) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x37D0 (14288) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x37E0 (14304) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0860, 0x5263, 0xC5C8, 0xEF0A, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A,   // 0x37F0 (14320) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x3800 (14336) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x3810 (14352) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF72A, 0xD649, 0x4A23, 0x0000,   // 0x3820 (14368) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3830 (14384) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3840 (14400) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3850 (14416) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3860 (14432) pixels
-0x10A0, 0xAD27, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x3870 (14448) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x3880 (14464) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x3890 (14480) pixels
-0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xEEEA, 0xDE69, 0xC5C8, 0x7B85, 0x0860, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x38A0 (14496) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x38B0 (14512) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x38C0 (14528) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x38D0 (14544) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x5AA3, 0xBDA8, 0xDE49, 0xEEEA, 0xF70A, 0xF70A, 0xEF0A, 0xF70A,   // 0x38E0 (14560) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x38F0 (14576) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x3900 (14592) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xCDE8, 0x2941,   // 0x3910 (14608) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3920 (14624) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3930 (14640) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3940 (14656) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3950 (14672) pixels
-0x3182, 0xDE69, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x3960 (14688) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x3970 (14704) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x3980 (14720) pixels
-0xF70A, 0xF70A, 0xEF0A, 0xE6A9, 0xCE08, 0xC5A8, 0xC5A8, 0xC5A8, 0x7B85, 0x0860, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3990 (14736) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x39A0 (14752) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x39B0 (14768) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x39C0 (14784) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x5AA3, 0xBD87, 0xC5A8, 0xC5A8, 0xCDE8, 0xDE89, 0xEF0A, 0xF70A, 0xF70A,   // 0x39D0 (14800) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x39E0 (14816) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x39F0 (14832) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEEEA, 0x5AA3,   // 0x3A00 (14848) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3A10 (14864) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3A20 (14880) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3A30 (14896) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840,   // 0x3A40 (14912) pixels
-0x83C5, 0xCE08, 0xEEC9, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x3A50 (14928) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x3A60 (14944) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A,   // 0x3A70 (14960) pixels
-0xF70A, 0xEEE9, 0xD649, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0x7385, 0x0860, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3A80 (14976) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3A90 (14992) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3AA0 (15008) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3AB0 (15024) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x5AA3, 0xBD67, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xD628, 0xE6C9, 0xF70A,   // 0x3AC0 (15040) pixels
-0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x3AD0 (15056) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x3AE0 (15072) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEEEA, 0xD629, 0x9CA6,   // 0x3AF0 (15088) pixels
-0x18C1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3B00 (15104) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3B10 (15120) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3B20 (15136) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5263,   // 0x3B30 (15152) pixels
-0xBD88, 0xC5A8, 0xCDE8, 0xE6C9, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x3B40 (15168) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x3B50 (15184) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEF0A,   // 0x3B60 (15200) pixels
-0xE6A9, 0xCDE8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0x7B85, 0x0860, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3B70 (15216) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3B80 (15232) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3B90 (15248) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3BA0 (15264) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x5AA3, 0xBD87, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8, 0xDE89,   // 0x3BB0 (15280) pixels
-0xEF0A, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x3BC0 (15296) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x3BD0 (15312) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEEEA, 0xD628, 0xC5A8, 0xC5A8,   // 0x3BE0 (15328) pixels
-0x7344, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3BF0 (15344) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3C00 (15360) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3C10 (15376) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2101, 0xA4E7,   // 0x3C20 (15392) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xCDE8, 0xEEC9, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x3C30 (15408) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x3C40 (15424) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEEEA, 0xD649,   // 0x3C50 (15440) pixels
-0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0x7B85, 0x0860, 0x0000, 0x0000, 0x0000,   // 0x3C60 (15456) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3C70 (15472) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3C80 (15488) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3C90 (15504) pixels
-0x0000, 0x0000, 0x0000, 0x0020, 0x5AA3, 0xBD87, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x3CA0 (15520) pixels
-0xD629, 0xEEE9, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x3CB0 (15536) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x3CC0 (15552) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEEEA, 0xD628, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x3CD0 (15568) pixels
-0xB567, 0x39C2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3CE0 (15584) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3CF0 (15600) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3D00 (15616) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x7B85, 0xC5C8,   // 0x3D10 (15632) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xCDE8, 0xEEC9, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x3D20 (15648) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x3D30 (15664) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xE6C9, 0xCE08, 0xC5A8,   // 0x3D40 (15680) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0x7385, 0x0860, 0x0000, 0x0000,   // 0x3D50 (15696) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3D60 (15712) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3D70 (15728) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3D80 (15744) pixels
-0x0000, 0x0000, 0x0020, 0x5AA3, 0xBD67, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x3D90 (15760) pixels
-0xC5A8, 0xCDE8, 0xE6A9, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x3DA0 (15776) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x3DB0 (15792) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEEEA, 0xD628, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x3DC0 (15808) pixels
-0xC5C8, 0x9466, 0x1080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3DD0 (15824) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3DE0 (15840) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3DF0 (15856) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x39C2, 0xBD67, 0xC5A8,   // 0x3E00 (15872) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xCE08, 0xEEC9, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x3E10 (15888) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x3E20 (15904) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEF0A, 0xE689, 0xC5E8, 0xC5A8, 0xC5A8,   // 0x3E30 (15920) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0x7385, 0x0860, 0x0000,   // 0x3E40 (15936) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3E50 (15952) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3E60 (15968) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3E70 (15984) pixels
-0x0000, 0x0020, 0x5AA3, 0xBD67, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x3E80 (16000) pixels
-0xC5A8, 0xC5A8, 0xC5C8, 0xDE69, 0xEF0A, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x3E90 (16016) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x3EA0 (16032) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEEEA, 0xD628, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x3EB0 (16048) pixels
-0xC5A8, 0xC5A8, 0x5AC4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3EC0 (16064) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3ED0 (16080) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3EE0 (16096) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1080, 0x9466, 0xC5C8, 0xC5A8,   // 0x3EF0 (16112) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xCDE8, 0xEEC9, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x3F00 (16128) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x3F10 (16144) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEF0A, 0xDE69, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x3F20 (16160) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0x7B85, 0x0860,   // 0x3F30 (16176) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3F40 (16192) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3F50 (16208) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3F60 (16224) pixels
-0x0020, 0x5AA3, 0xBD67, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x3F70 (16240) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xD649, 0xEEEA, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x3F80 (16256) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x3F90 (16272) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEEEA, 0xD628, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x3FA0 (16288) pixels
-0xC5A8, 0xC5A8, 0xAD07, 0x2121, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3FB0 (16304) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3FC0 (16320) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3FD0 (16336) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5283, 0xBDA8, 0xC5A8, 0xC5A8,   // 0x3FE0 (16352) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xCE08, 0xEEC9, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x3FF0 (16368) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x4000 (16384) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEEEA, 0xD649, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4010 (16400) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0x7385,   // 0x4020 (16416) pixels
-0x0860, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4030 (16432) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4040 (16448) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,   // 0x4050 (16464) pixels
-0x5AA3, 0xBD67, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4060 (16480) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xD628, 0xEEEA, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x4070 (16496) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x4080 (16512) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEEEA, 0xD628, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4090 (16528) pixels
-0xC5A8, 0xC5A8, 0xC5C8, 0x7B85, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x40A0 (16544) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x40B0 (16560) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x40C0 (16576) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18E1, 0xA4C7, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x40D0 (16592) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xCE08, 0xEEC9, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x40E0 (16608) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x40F0 (16624) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEEEA, 0xD628, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4100 (16640) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4110 (16656) pixels
-0x7385, 0x0860, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4120 (16672) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4130 (16688) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x5AA3,   // 0x4140 (16704) pixels
-0xBD67, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4150 (16720) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xCE08, 0xEEC9, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x4160 (16736) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x4170 (16752) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEEEA, 0xD628, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4180 (16768) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xB567, 0x39A2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4190 (16784) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x41A0 (16800) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x41B0 (16816) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6B04, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x41C0 (16832) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xCE08, 0xEEC9, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x41D0 (16848) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x41E0 (16864) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEEEA, 0xD628, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x41F0 (16880) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4200 (16896) pixels
-0xC5A8, 0x7365, 0x0860, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4210 (16912) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4220 (16928) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x5AA3, 0xBD67,   // 0x4230 (16944) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4240 (16960) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xCE08, 0xE6C9, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x4250 (16976) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x4260 (16992) pixels
-0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEEEA, 0xD628, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4270 (17008) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8, 0x8C05, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4280 (17024) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4290 (17040) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x42A0 (17056) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2121, 0xAD07, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x42B0 (17072) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xCE08, 0xEEC9, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x42C0 (17088) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x42D0 (17104) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEEEA, 0xCE08, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x42E0 (17120) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x42F0 (17136) pixels
-0xC5A8, 0xC5A8, 0x7365, 0x0860, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4300 (17152) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4310 (17168) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x5AA3, 0xBD67, 0xC5A8,   // 0x4320 (17184) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4330 (17200) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xCDE8, 0xE6C9, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x4340 (17216) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x4350 (17232) pixels
-0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEEEA, 0xD628, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4360 (17248) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xBD88, 0x4202, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4370 (17264) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4380 (17280) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4390 (17296) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7364, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x43A0 (17312) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xCE08, 0xEEC9, 0xF70A, 0xF70A, 0xF70A,   // 0x43B0 (17328) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x43C0 (17344) pixels
-0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEEEA, 0xCE28, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x43D0 (17360) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x43E0 (17376) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0x7365, 0x0860, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x43F0 (17392) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4400 (17408) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x5AA3, 0xBD67, 0xC5A8, 0xC5A8,   // 0x4410 (17424) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4420 (17440) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xCDE8, 0xEEC9, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A,   // 0x4430 (17456) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x4440 (17472) pixels
-0xF70A, 0xEF0A, 0xF70A, 0xEEEA, 0xD628, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4450 (17488) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8, 0x9446, 0x0860, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4460 (17504) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4470 (17520) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4480 (17536) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2921, 0xB527, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4490 (17552) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xCDE8, 0xEEC9, 0xF70A, 0xF70A,   // 0x44A0 (17568) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x44B0 (17584) pixels
-0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEEEA, 0xD628, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x44C0 (17600) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x44D0 (17616) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0x7365, 0x0860, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x44E0 (17632) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x44F0 (17648) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x5AA3, 0xBD67, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4500 (17664) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4510 (17680) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xCE08, 0xEEE9, 0xF70A, 0xEF0A, 0xF70A, 0xF70A,   // 0x4520 (17696) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x4530 (17712) pixels
-0xEF0A, 0xF70A, 0xEEEA, 0xD628, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4540 (17728) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xBD88, 0x4A23, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4550 (17744) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4560 (17760) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4570 (17776) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7364, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4580 (17792) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xCDE8, 0xEEC9, 0xF70A,   // 0x4590 (17808) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x45A0 (17824) pixels
-0xF70A, 0xEF0A, 0xF70A, 0xEEEA, 0xD629, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x45B0 (17840) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x45C0 (17856) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0x7365, 0x0860, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x45D0 (17872) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x45E0 (17888) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x5AA3, 0xBD67, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x45F0 (17904) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4600 (17920) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xCE08, 0xEEEA, 0xF70A, 0xEF0A, 0xF70A,   // 0x4610 (17936) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A,   // 0x4620 (17952) pixels
-0xF70A, 0xEEEA, 0xD628, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4630 (17968) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8, 0x9446, 0x0860, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4640 (17984) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4650 (18000) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4660 (18016) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2101, 0xAD27, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4670 (18032) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xCE08, 0xEEC9,   // 0x4680 (18048) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x4690 (18064) pixels
-0xEF0A, 0xF70A, 0xEF0A, 0xD649, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x46A0 (18080) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x46B0 (18096) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0x7365, 0x0860, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x46C0 (18112) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x46D0 (18128) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x5A83, 0xBD67, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x46E0 (18144) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x46F0 (18160) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xD628, 0xEEEA, 0xF70A, 0xEF0A,   // 0x4700 (18176) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A,   // 0x4710 (18192) pixels
-0xEEEA, 0xD628, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4720 (18208) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xBD88, 0x41E2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4730 (18224) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4740 (18240) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4750 (18256) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6B24, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4760 (18272) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xCE08,   // 0x4770 (18288) pixels
-0xEEC9, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x4780 (18304) pixels
-0xF70A, 0xF70A, 0xDE89, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4790 (18320) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x47A0 (18336) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0x7365, 0x0860, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x47B0 (18352) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x47C0 (18368) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x5A83, 0xBD67, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x47D0 (18384) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x47E0 (18400) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xD649, 0xEF0A, 0xF70A,   // 0x47F0 (18416) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEEEA,   // 0x4800 (18432) pixels
-0xD628, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4810 (18448) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8, 0x8C26, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4820 (18464) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4830 (18480) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4840 (18496) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18C1, 0xACE7, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4850 (18512) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4860 (18528) pixels
-0xCE08, 0xEEC9, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x4870 (18544) pixels
-0xF70A, 0xE6A9, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4880 (18560) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4890 (18576) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0x7365, 0x0860, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x48A0 (18592) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x48B0 (18608) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x5A83, 0xBD67, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x48C0 (18624) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x48D0 (18640) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xDE89, 0xF70A,   // 0x48E0 (18656) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEEEA, 0xD629,   // 0x48F0 (18672) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4900 (18688) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xBD67, 0x39A2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4910 (18704) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4920 (18720) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4930 (18736) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5AA3, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4940 (18752) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4950 (18768) pixels
-0xC5A8, 0xCE08, 0xEEC9, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A,   // 0x4960 (18784) pixels
-0xEEC9, 0xCDE8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4970 (18800) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4980 (18816) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0x7365, 0x0860, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4990 (18832) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x49A0 (18848) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x5A83, 0xBD67, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x49B0 (18864) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x49C0 (18880) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8, 0xE6A9,   // 0x49D0 (18896) pixels
-0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEEEA, 0xD628, 0xC5A8,   // 0x49E0 (18912) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x49F0 (18928) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8, 0x7BA5, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4A00 (18944) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4A10 (18960) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4A20 (18976) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1080, 0x9C86, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4A30 (18992) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4A40 (19008) pixels
-0xC5A8, 0xC5A8, 0xCE08, 0xEEC9, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEEEA,   // 0x4A50 (19024) pixels
-0xD628, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4A60 (19040) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4A70 (19056) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0x7365, 0x0860, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4A80 (19072) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4A90 (19088) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x5283, 0xBD67, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4AA0 (19104) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4AB0 (19120) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xCE08,   // 0x4AC0 (19136) pixels
-0xEEEA, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEEEA, 0xD628, 0xC5A8, 0xC5A8,   // 0x4AD0 (19152) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4AE0 (19168) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xB527, 0x2921, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4AF0 (19184) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4B00 (19200) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4B10 (19216) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4202, 0xBD88, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4B20 (19232) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4B30 (19248) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xCE08, 0xEEC9, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xDE69,   // 0x4B40 (19264) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4B50 (19280) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4B60 (19296) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0x7365, 0x0860, 0x0000, 0x0000, 0x0000,   // 0x4B70 (19312) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4B80 (19328) pixels
-0x0000, 0x0000, 0x0000, 0x0020, 0x5283, 0xBD67, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4B90 (19344) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4BA0 (19360) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4BB0 (19376) pixels
-0xD649, 0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEEEA, 0xD628, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4BC0 (19392) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4BD0 (19408) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0x6304, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4BE0 (19424) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4BF0 (19440) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4C00 (19456) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x83E5, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4C10 (19472) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4C20 (19488) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xCE08, 0xEEC9, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xE6A9, 0xC5C8,   // 0x4C30 (19504) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4C40 (19520) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4C50 (19536) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0x7365, 0x0860, 0x0000, 0x0000,   // 0x4C60 (19552) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4C70 (19568) pixels
-0x0000, 0x0000, 0x0000, 0x5283, 0xBD67, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4C80 (19584) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4C90 (19600) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4CA0 (19616) pixels
-0xC5A8, 0xDE89, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEEEA, 0xD628, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4CB0 (19632) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4CC0 (19648) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xA4A6, 0x10A0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4CD0 (19664) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4CE0 (19680) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4CF0 (19696) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2921, 0xB527, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4D00 (19712) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4D10 (19728) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xCE08, 0xEEC9, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEEEA, 0xCE08, 0xC5A8,   // 0x4D20 (19744) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4D30 (19760) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4D40 (19776) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0x7365, 0x0840, 0x0000,   // 0x4D50 (19792) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4D60 (19808) pixels
-0x0000, 0x0000, 0x5283, 0xBD67, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4D70 (19824) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4D80 (19840) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4D90 (19856) pixels
-0xC5A8, 0xCDE8, 0xEEC9, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEEEA, 0xD629, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4DA0 (19872) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4DB0 (19888) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xBD88, 0x4203, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4DC0 (19904) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4DD0 (19920) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4DE0 (19936) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x62C4, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4DF0 (19952) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4E00 (19968) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xCE08, 0xEEC9, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xDE69, 0xC5A8, 0xC5A8,   // 0x4E10 (19984) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4E20 (20000) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4E30 (20016) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0x7365, 0x0860,   // 0x4E40 (20032) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4E50 (20048) pixels
-0x0000, 0x5283, 0xBD67, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4E60 (20064) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4E70 (20080) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4E80 (20096) pixels
-0xC5A8, 0xC5A8, 0xD629, 0xEF0A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEEEA, 0xD628, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4E90 (20112) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4EA0 (20128) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8, 0x83C5, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4EB0 (20144) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4EC0 (20160) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4ED0 (20176) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0860, 0x9C66, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4EE0 (20192) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4EF0 (20208) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xCE08, 0xEEC9, 0xF70A, 0xEF0A, 0xF70A, 0xE6C9, 0xC5C8, 0xC5A8, 0xC5A8,   // 0x4F00 (20224) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4F10 (20240) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4F20 (20256) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0x7364,   // 0x4F30 (20272) pixels
-0x0860, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4F40 (20288) pixels
-0x5283, 0xBD67, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4F50 (20304) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4F60 (20320) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4F70 (20336) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xE689, 0xF70A, 0xEF0A, 0xF70A, 0xEEEA, 0xD629, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4F80 (20352) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4F90 (20368) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xAD27, 0x2101, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4FA0 (20384) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4FB0 (20400) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4FC0 (20416) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x39A2, 0xBD67, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4FD0 (20432) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4FE0 (20448) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xCE08, 0xEEC9, 0xF70A, 0xEF0A, 0xD628, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x4FF0 (20464) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5000 (20480) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5010 (20496) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5020 (20512) pixels
-0x7365, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5283,   // 0x5030 (20528) pixels
-0xBD67, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5040 (20544) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5050 (20560) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5060 (20576) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xCDE8, 0xEEEA, 0xF70A, 0xEEEA, 0xD629, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5070 (20592) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5080 (20608) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0x5AA3, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5090 (20624) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x50A0 (20640) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x50B0 (20656) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x6B44, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x50C0 (20672) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x50D0 (20688) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xCE08, 0xEEE9, 0xE6A9, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x50E0 (20704) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x50F0 (20720) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5100 (20736) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5110 (20752) pixels
-0xC5A8, 0x7364, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5283, 0xBD67,   // 0x5120 (20768) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5130 (20784) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5140 (20800) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5150 (20816) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xDE69, 0xEEEA, 0xD629, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5160 (20832) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5170 (20848) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8, 0x8C26, 0x0840, 0x0000, 0x0000, 0x0000,   // 0x5180 (20864) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5190 (20880) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x51A0 (20896) pixels
-0x0000, 0x0000, 0x0000, 0x1080, 0x9CA6, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x51B0 (20912) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x51C0 (20928) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xB567, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x51D0 (20944) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x51E0 (20960) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x51F0 (20976) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5200 (20992) pixels
-0xC5A8, 0xC5A8, 0x7364, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5283, 0xBD67, 0xC5A8,   // 0x5210 (21008) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5220 (21024) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5230 (21040) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5240 (21056) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xBD88, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5250 (21072) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5260 (21088) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xB547, 0x2921, 0x0000, 0x0000, 0x0000,   // 0x5270 (21104) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5280 (21120) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5290 (21136) pixels
-0x0000, 0x0000, 0x0000, 0x39A2, 0xBD87, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x52A0 (21152) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x52B0 (21168) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8, 0x7364, 0x3162, 0xA4C7, 0xC5C8, 0xC5A8, 0xC5A8,   // 0x52C0 (21184) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x52D0 (21200) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x52E0 (21216) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x52F0 (21232) pixels
-0xC5A8, 0xC5A8, 0xBDA8, 0x7364, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5283, 0xBD67, 0xC5A8, 0xC5A8,   // 0x5300 (21248) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5310 (21264) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5320 (21280) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5330 (21296) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xB547, 0x4A03, 0x5AA3, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5340 (21312) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5350 (21328) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0x5AA3, 0x0000, 0x0000, 0x0000,   // 0x5360 (21344) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5370 (21360) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5380 (21376) pixels
-0x0000, 0x0000, 0x0000, 0x6B24, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5390 (21392) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x53A0 (21408) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xAD27, 0x2121, 0x0000, 0x3162, 0xA4C7, 0xC5C8, 0xC5A8,   // 0x53B0 (21424) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x53C0 (21440) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x53D0 (21456) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x53E0 (21472) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xBDA8, 0x7344, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5283, 0xBD67, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x53F0 (21488) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5400 (21504) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5410 (21520) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5420 (21536) pixels
-0xC5A8, 0xC5A8, 0xB547, 0x4A23, 0x0000, 0x10A0, 0x9CA6, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5430 (21552) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5440 (21568) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8, 0x8C26, 0x0020, 0x0000, 0x0000,   // 0x5450 (21584) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5460 (21600) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5470 (21616) pixels
-0x0000, 0x0000, 0x0860, 0x9C86, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5480 (21632) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5490 (21648) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8, 0x7344, 0x0000, 0x0000, 0x0000, 0x2962, 0xA4C7, 0xC5C8,   // 0x54A0 (21664) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x54B0 (21680) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x54C0 (21696) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x54D0 (21712) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xBDA8, 0x7364, 0x0840, 0x0000, 0x0000, 0x0000, 0x5283, 0xBD67, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x54E0 (21728) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x54F0 (21744) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5500 (21760) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5510 (21776) pixels
-0xC5A8, 0xB547, 0x4A23, 0x0000, 0x0000, 0x0000, 0x5283, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5520 (21792) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5530 (21808) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xAD27, 0x2101, 0x0000, 0x0000,   // 0x5540 (21824) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5550 (21840) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5560 (21856) pixels
-0x0000, 0x0000, 0x2941, 0xB547, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5570 (21872) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5580 (21888) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xB527, 0x2941, 0x0000, 0x0000, 0x0000, 0x0000, 0x3162, 0xA4C7,   // 0x5590 (21904) pixels
-0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x55A0 (21920) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x55B0 (21936) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x55C0 (21952) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xBDA8, 0x7344, 0x0840, 0x0000, 0x5283, 0xBD67, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x55D0 (21968) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x55E0 (21984) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x55F0 (22000) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5600 (22016) pixels
-0xB547, 0x4A23, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A1, 0xA4C6, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5610 (22032) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5620 (22048) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0x4A23, 0x0000, 0x0000,   // 0x5630 (22064) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5640 (22080) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5650 (22096) pixels
-0x0000, 0x0000, 0x5283, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5660 (22112) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5670 (22128) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8, 0x7BA5, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3162,   // 0x5680 (22144) pixels
-0xA4C7, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5690 (22160) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x56A0 (22176) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x56B0 (22192) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xBDA8, 0x7385, 0x62E4, 0xB567, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x56C0 (22208) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x56D0 (22224) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x56E0 (22240) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xB547,   // 0x56F0 (22256) pixels
-0x4A23, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x62E4, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5700 (22272) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5710 (22288) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8, 0x7B85, 0x0000, 0x0000,   // 0x5720 (22304) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5730 (22320) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5740 (22336) pixels
-0x0000, 0x0020, 0x83E5, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5750 (22352) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5760 (22368) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xBD67, 0x39A2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5770 (22384) pixels
-0x3162, 0xA4C7, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5780 (22400) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5790 (22416) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x57A0 (22432) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x57B0 (22448) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x57C0 (22464) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x57D0 (22480) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xB547, 0x4A23,   // 0x57E0 (22496) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x20E1, 0xAD07, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x57F0 (22512) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5800 (22528) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0x9CA6, 0x1080, 0x0000,   // 0x5810 (22544) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5820 (22560) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5830 (22576) pixels
-0x0000, 0x10A0, 0xA4C7, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5840 (22592) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5850 (22608) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8, 0x9446, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5860 (22624) pixels
-0x0000, 0x3162, 0xA4E7, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5870 (22640) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5880 (22656) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5890 (22672) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x58A0 (22688) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x58B0 (22704) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x58C0 (22720) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xB547, 0x4A23, 0x0000,   // 0x58D0 (22736) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7365, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x58E0 (22752) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x58F0 (22768) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xB567, 0x2962, 0x0000,   // 0x5900 (22784) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5910 (22800) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5920 (22816) pixels
-0x0000, 0x3182, 0xBD67, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5930 (22832) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5940 (22848) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0x5283, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5950 (22864) pixels
-0x0000, 0x0000, 0x3162, 0xA4E7, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5960 (22880) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5970 (22896) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5980 (22912) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5990 (22928) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x59A0 (22944) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x59B0 (22960) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xB547, 0x4A23, 0x0000, 0x0000,   // 0x59C0 (22976) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x39A2, 0xBD67, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x59D0 (22992) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x59E0 (23008) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0x5283, 0x0000,   // 0x59F0 (23024) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5A00 (23040) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5A10 (23056) pixels
-0x0000, 0x5AA3, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5A20 (23072) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5A30 (23088) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xAD07, 0x18E1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5A40 (23104) pixels
-0x0000, 0x0000, 0x0000, 0x3162, 0xA4E7, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5A50 (23120) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5A60 (23136) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5A70 (23152) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5A80 (23168) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5A90 (23184) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5AA0 (23200) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xB547, 0x4A23, 0x0000, 0x0000, 0x0000,   // 0x5AB0 (23216) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0860, 0x9466, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5AC0 (23232) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5AD0 (23248) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8, 0x7BA5, 0x0000,   // 0x5AE0 (23264) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5AF0 (23280) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5B00 (23296) pixels
-0x0000, 0x83C5, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5B10 (23312) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5B20 (23328) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8, 0x7BA5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5B30 (23344) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x3162, 0xA4E7, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5B40 (23360) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5B50 (23376) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5B60 (23392) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5B70 (23408) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5B80 (23424) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5B90 (23440) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xB547, 0x4A23, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5BA0 (23456) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5AC4, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5BB0 (23472) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5BC0 (23488) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xA4A6, 0x1080,   // 0x5BD0 (23504) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5BE0 (23520) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5BF0 (23536) pixels
-0x1080, 0xA4C6, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5C00 (23552) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5C10 (23568) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xBD88, 0x4202, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5C20 (23584) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3162, 0xA4C7, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5C30 (23600) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5C40 (23616) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5C50 (23632) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5C60 (23648) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5C70 (23664) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5C80 (23680) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xB547, 0x4A23, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5C90 (23696) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2921, 0xB547, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5CA0 (23712) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5CB0 (23728) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xB547, 0x2121,   // 0x5CC0 (23744) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5CD0 (23760) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5CE0 (23776) pixels
-0x2121, 0xB547, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5CF0 (23792) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5D00 (23808) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xACE7, 0x18C1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5D10 (23824) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3162, 0xA4E7, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5D20 (23840) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5D30 (23856) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5D40 (23872) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5D50 (23888) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5D60 (23904) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5D70 (23920) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xB547, 0x4A23, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5D80 (23936) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x9446, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5D90 (23952) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5DA0 (23968) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xBDA8, 0x4203,   // 0x5DB0 (23984) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5DC0 (24000) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5DD0 (24016) pixels
-0x4202, 0xBDA8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5DE0 (24032) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5DF0 (24048) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8, 0x7BA5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5E00 (24064) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3162, 0xA4E7, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5E10 (24080) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5E20 (24096) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5E30 (24112) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5E40 (24128) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5E50 (24144) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5E60 (24160) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xB547, 0x4A43, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5E70 (24176) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5AC4, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5E80 (24192) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5E90 (24208) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8, 0x6B04,   // 0x5EA0 (24224) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5EB0 (24240) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5EC0 (24256) pixels
-0x62E4, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5ED0 (24272) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5EE0 (24288) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0x4A43, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5EF0 (24304) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3162, 0xA4E7, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5F00 (24320) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5F10 (24336) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5F20 (24352) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5F30 (24368) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5F40 (24384) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5F50 (24400) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xB547, 0x4A23, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5F60 (24416) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3162, 0xBD67, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5F70 (24432) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5F80 (24448) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8, 0x83E5,   // 0x5F90 (24464) pixels
-0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5FA0 (24480) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5FB0 (24496) pixels
-0x83C5, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5FC0 (24512) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5FD0 (24528) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xB547, 0x2121, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5FE0 (24544) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3162, 0xA4E7, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x5FF0 (24560) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6000 (24576) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6010 (24592) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6020 (24608) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6030 (24624) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6040 (24640) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xB547, 0x4A23, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6050 (24656) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1080, 0xA4A6, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6060 (24672) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6070 (24688) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xA4A6,   // 0x6080 (24704) pixels
-0x1080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6090 (24720) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0860,   // 0x60A0 (24736) pixels
-0x9C86, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x60B0 (24752) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x60C0 (24768) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8, 0x9466, 0x0860, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x60D0 (24784) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3162, 0xA4E7, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x60E0 (24800) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x60F0 (24816) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6100 (24832) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6110 (24848) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6120 (24864) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6130 (24880) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xB547, 0x4A23, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6140 (24896) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7B85, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6150 (24912) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6160 (24928) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xB547,   // 0x6170 (24944) pixels
-0x2101, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6180 (24960) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18E1,   // 0x6190 (24976) pixels
-0xAD07, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x61A0 (24992) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x61B0 (25008) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8, 0x7344, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x61C0 (25024) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3162, 0xA4E7, 0xC5C8, 0xC5A8, 0xC5A8,   // 0x61D0 (25040) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x61E0 (25056) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x61F0 (25072) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6200 (25088) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6210 (25104) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6220 (25120) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xB547, 0x4A43, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6230 (25136) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4A43, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6240 (25152) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6250 (25168) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xBD88,   // 0x6260 (25184) pixels
-0x39A2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6270 (25200) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3162,   // 0x6280 (25216) pixels
-0xBD67, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6290 (25232) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x62A0 (25248) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0x4A23, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x62B0 (25264) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3182, 0xA4E7, 0xC5C8, 0xC5A8,   // 0x62C0 (25280) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x62D0 (25296) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x62E0 (25312) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x62F0 (25328) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6300 (25344) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6310 (25360) pixels
-0xC5A8, 0xC5A8, 0xB547, 0x4A43, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6320 (25376) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2941, 0xB547, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6330 (25392) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6340 (25408) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6350 (25424) pixels
-0x4A43, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6360 (25440) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4202,   // 0x6370 (25456) pixels
-0xBDA8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6380 (25472) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6390 (25488) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xB547, 0x2921, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x63A0 (25504) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3162, 0xA4E7, 0xC5C8,   // 0x63B0 (25520) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x63C0 (25536) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x63D0 (25552) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x63E0 (25568) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x63F0 (25584) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6400 (25600) pixels
-0xC5A8, 0xB547, 0x4A23, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6410 (25616) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1080, 0xA4C6, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6420 (25632) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6430 (25648) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8,   // 0x6440 (25664) pixels
-0x6304, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6450 (25680) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5AA3,   // 0x6460 (25696) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6470 (25712) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6480 (25728) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xA4C6, 0x1080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6490 (25744) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3182, 0xA4E7,   // 0x64A0 (25760) pixels
-0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x64B0 (25776) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x64C0 (25792) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x64D0 (25808) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x64E0 (25824) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x64F0 (25840) pixels
-0xB547, 0x4A43, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6500 (25856) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x8C05, 0xC5C8, 0xC5A8, 0xC5A8,   // 0x6510 (25872) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6520 (25888) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8,   // 0x6530 (25904) pixels
-0x7BA5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6540 (25920) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6B44,   // 0x6550 (25936) pixels
-0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6560 (25952) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6570 (25968) pixels
-0xC5A8, 0xC5A8, 0xC5C8, 0x8C26, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6580 (25984) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3182,   // 0x6590 (26000) pixels
-0xA4E7, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x65A0 (26016) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x65B0 (26032) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x65C0 (26048) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x65D0 (26064) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xB547,   // 0x65E0 (26080) pixels
-0x4A43, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x65F0 (26096) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6B24, 0xC5C8, 0xC5A8, 0xC5A8,   // 0x6600 (26112) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6610 (26128) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8,   // 0x6620 (26144) pixels
-0x8C26, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6630 (26160) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x83C5,   // 0x6640 (26176) pixels
-0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6650 (26192) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6660 (26208) pixels
-0xC5A8, 0xC5A8, 0xC5C8, 0x6B44, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6670 (26224) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6680 (26240) pixels
-0x3182, 0xA4E7, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6690 (26256) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x66A0 (26272) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x66B0 (26288) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x66C0 (26304) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xB547, 0x4A43,   // 0x66D0 (26320) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x66E0 (26336) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4A23, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x66F0 (26352) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6700 (26368) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8,   // 0x6710 (26384) pixels
-0x9CA6, 0x0860, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6720 (26400) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x9446,   // 0x6730 (26416) pixels
-0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6740 (26432) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6750 (26448) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0x5263, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6760 (26464) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6770 (26480) pixels
-0x0000, 0x3182, 0xA4E7, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6780 (26496) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6790 (26512) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x67A0 (26528) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x67B0 (26544) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xB547, 0x4A43, 0x0000,   // 0x67C0 (26560) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x67D0 (26576) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3182, 0xBD67, 0xC5A8, 0xC5A8,   // 0x67E0 (26592) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x67F0 (26608) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6800 (26624) pixels
-0xAD07, 0x18C1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6810 (26640) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0860, 0x9C86,   // 0x6820 (26656) pixels
-0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6830 (26672) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6840 (26688) pixels
-0xC5A8, 0xC5A8, 0xBD88, 0x39C2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6850 (26704) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6860 (26720) pixels
-0x0000, 0x0000, 0x3182, 0xA4E7, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6870 (26736) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6880 (26752) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6890 (26768) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x68A0 (26784) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xB547, 0x4A43, 0x0000, 0x0000,   // 0x68B0 (26800) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x68C0 (26816) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x20E1, 0xAD27, 0xC5A8, 0xC5A8,   // 0x68D0 (26832) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x68E0 (26848) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x68F0 (26864) pixels
-0xB547, 0x2101, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6900 (26880) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A0, 0xA4E7,   // 0x6910 (26896) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6920 (26912) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6930 (26928) pixels
-0xC5A8, 0xC5A8, 0xB547, 0x2941, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6940 (26944) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6950 (26960) pixels
-0x0000, 0x0000, 0x0000, 0x3182, 0xA4E7, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6960 (26976) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6970 (26992) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6980 (27008) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6990 (27024) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xB547, 0x4A43, 0x0000, 0x0000, 0x0000,   // 0x69A0 (27040) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x69B0 (27056) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1080, 0xA4C6, 0xC5A8, 0xC5A8,   // 0x69C0 (27072) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x69D0 (27088) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x69E0 (27104) pixels
-0xBD67, 0x3162, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x69F0 (27120) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18E1, 0xAD27,   // 0x6A00 (27136) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6A10 (27152) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6A20 (27168) pixels
-0xC5A8, 0xC5A8, 0xAD07, 0x18C1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6A30 (27184) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6A40 (27200) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x3182, 0xA4E7, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6A50 (27216) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6A60 (27232) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6A70 (27248) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6A80 (27264) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xB547, 0x4A43, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6A90 (27280) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6AA0 (27296) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x9446, 0xC5C8, 0xC5A8,   // 0x6AB0 (27312) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6AC0 (27328) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6AD0 (27344) pixels
-0xBD88, 0x39A2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6AE0 (27360) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2121, 0xB547,   // 0x6AF0 (27376) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6B00 (27392) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6B10 (27408) pixels
-0xC5A8, 0xC5A8, 0xA4C6, 0x1080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6B20 (27424) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6B30 (27440) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3182, 0xA4E7, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6B40 (27456) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6B50 (27472) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6B60 (27488) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6B70 (27504) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xB547, 0x4A43, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6B80 (27520) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6B90 (27536) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x83E5, 0xC5C8, 0xC5A8,   // 0x6BA0 (27552) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6BB0 (27568) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6BC0 (27584) pixels
-0xBDA8, 0x41E2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6BD0 (27600) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2962, 0xBD67,   // 0x6BE0 (27616) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6BF0 (27632) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6C00 (27648) pixels
-0xC5A8, 0xC5C8, 0x9466, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6C10 (27664) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6C20 (27680) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3182, 0xACE7, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6C30 (27696) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6C40 (27712) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6C50 (27728) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6C60 (27744) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xB567, 0x4A43, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6C70 (27760) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6C80 (27776) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7B85, 0xC5C8, 0xC5A8,   // 0x6C90 (27792) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6CA0 (27808) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6CB0 (27824) pixels
-0xC5A8, 0x4A23, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6CC0 (27840) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3182, 0xBD88,   // 0x6CD0 (27856) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6CE0 (27872) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6CF0 (27888) pixels
-0xC5A8, 0xC5C8, 0x8C26, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6D00 (27904) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6D10 (27920) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3182, 0xA4E7, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6D20 (27936) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6D30 (27952) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6D40 (27968) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6D50 (27984) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xB547, 0x4A43, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6D60 (28000) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6D70 (28016) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6B44, 0xC5C8, 0xC5A8,   // 0x6D80 (28032) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6D90 (28048) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6DA0 (28064) pixels
-0xC5A8, 0x5263, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6DB0 (28080) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x39A2, 0xBD88,   // 0x6DC0 (28096) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6DD0 (28112) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6DE0 (28128) pixels
-0xC5A8, 0xC5C8, 0x83E5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6DF0 (28144) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6E00 (28160) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3182, 0xACE7, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6E10 (28176) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6E20 (28192) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6E30 (28208) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6E40 (28224) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xB567, 0x4A43, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6E50 (28240) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6E60 (28256) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6304, 0xC5C8, 0xC5A8,   // 0x6E70 (28272) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6E80 (28288) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6E90 (28304) pixels
-0xC5A8, 0x5283, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6EA0 (28320) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x39C2, 0xBD88,   // 0x6EB0 (28336) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6EC0 (28352) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6ED0 (28368) pixels
-0xC5A8, 0xC5C8, 0x7BC5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6EE0 (28384) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6EF0 (28400) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3182, 0xACE7, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6F00 (28416) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6F10 (28432) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6F20 (28448) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6F30 (28464) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xB567, 0x4A43, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6F40 (28480) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6F50 (28496) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5AC4, 0xC5A8, 0xC5A8,   // 0x6F60 (28512) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6F70 (28528) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6F80 (28544) pixels
-0xC5A8, 0x5AA4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6F90 (28560) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x39C2, 0xBD88,   // 0x6FA0 (28576) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6FB0 (28592) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6FC0 (28608) pixels
-0xC5A8, 0xC5C8, 0x7BA5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6FD0 (28624) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6FE0 (28640) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3182, 0xA4E7, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x6FF0 (28656) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7000 (28672) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7010 (28688) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7020 (28704) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xB547, 0x5263, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7030 (28720) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7040 (28736) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5AA3, 0xC5A8, 0xC5A8,   // 0x7050 (28752) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7060 (28768) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7070 (28784) pixels
-0xC5C8, 0x5AC4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7080 (28800) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x41E2, 0xBD88,   // 0x7090 (28816) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x70A0 (28832) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x70B0 (28848) pixels
-0xC5A8, 0xC5C8, 0x7B85, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x70C0 (28864) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x70D0 (28880) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x39C2, 0xB567, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x70E0 (28896) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x70F0 (28912) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7100 (28928) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7110 (28944) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0x5AA4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7120 (28960) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7130 (28976) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5283, 0xC5A8, 0xC5A8,   // 0x7140 (28992) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7150 (29008) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7160 (29024) pixels
-0xC5C8, 0x62E4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7170 (29040) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x41E2, 0xBD88,   // 0x7180 (29056) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7190 (29072) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x71A0 (29088) pixels
-0xC5A8, 0xC5C8, 0x7B85, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x71B0 (29104) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x71C0 (29120) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5263, 0xBD88, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x71D0 (29136) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x71E0 (29152) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x71F0 (29168) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7200 (29184) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0x6B44, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7210 (29200) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7220 (29216) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5283, 0xC5A8, 0xC5A8,   // 0x7230 (29232) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7240 (29248) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7250 (29264) pixels
-0xC5C8, 0x62C4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7260 (29280) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x39C2, 0xBD88,   // 0x7270 (29296) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7280 (29312) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7290 (29328) pixels
-0xC5A8, 0xC5C8, 0x7BA5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x72A0 (29344) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x72B0 (29360) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4A43, 0xB547, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x72C0 (29376) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x72D0 (29392) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x72E0 (29408) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x72F0 (29424) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xBD88, 0x6B24, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7300 (29440) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7310 (29456) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5AA3, 0xC5A8, 0xC5A8,   // 0x7320 (29472) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7330 (29488) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7340 (29504) pixels
-0xC5C8, 0x5AC4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7350 (29520) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x39C2, 0xBD88,   // 0x7360 (29536) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7370 (29552) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7380 (29568) pixels
-0xC5A8, 0xC5C8, 0x83C5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7390 (29584) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x73A0 (29600) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4A43, 0xB547, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x73B0 (29616) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x73C0 (29632) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x73D0 (29648) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x73E0 (29664) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xBD88, 0x6B24, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x73F0 (29680) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7400 (29696) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x62C4, 0xC5A8, 0xC5A8,   // 0x7410 (29712) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7420 (29728) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7430 (29744) pixels
-0xC5A8, 0x5AA3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7440 (29760) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x31A2, 0xBD88,   // 0x7450 (29776) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7460 (29792) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7470 (29808) pixels
-0xC5A8, 0xC5C8, 0x83E5, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7480 (29824) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7490 (29840) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4A43, 0xB567, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x74A0 (29856) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x74B0 (29872) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x74C0 (29888) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x74D0 (29904) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xBD88, 0x6B24, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x74E0 (29920) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x74F0 (29936) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6B04, 0xC5C8, 0xC5A8,   // 0x7500 (29952) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7510 (29968) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7520 (29984) pixels
-0xC5A8, 0x5283, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7530 (30000) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3182, 0xBD88,   // 0x7540 (30016) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7550 (30032) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7560 (30048) pixels
-0xC5A8, 0xC5C8, 0x8C26, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7570 (30064) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7580 (30080) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4A43, 0xB547, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7590 (30096) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x75A0 (30112) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x75B0 (30128) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x75C0 (30144) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xBD88, 0x6B04, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x75D0 (30160) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x75E0 (30176) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7344, 0xC5C8, 0xC5A8,   // 0x75F0 (30192) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7600 (30208) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7610 (30224) pixels
-0xC5A8, 0x5243, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7620 (30240) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2941, 0xBD67,   // 0x7630 (30256) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7640 (30272) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7650 (30288) pixels
-0xC5A8, 0xC5C8, 0x9C86, 0x0860, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7660 (30304) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7670 (30320) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4A43, 0xB547, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7680 (30336) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7690 (30352) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x76A0 (30368) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x76B0 (30384) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xBD88, 0x6B04, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x76C0 (30400) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x76D0 (30416) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7BA5, 0xC5C8, 0xC5A8,   // 0x76E0 (30432) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x76F0 (30448) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7700 (30464) pixels
-0xC5A8, 0x4A23, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7710 (30480) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2101, 0xB547,   // 0x7720 (30496) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7730 (30512) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7740 (30528) pixels
-0xC5A8, 0xC5A8, 0xA4C7, 0x1080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7750 (30544) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7760 (30560) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4A43, 0xB547, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7770 (30576) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7780 (30592) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7790 (30608) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x77A0 (30624) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xBD88, 0x6B24, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x77B0 (30640) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x77C0 (30656) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x8405, 0xC5C8, 0xC5A8,   // 0x77D0 (30672) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x77E0 (30688) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x77F0 (30704) pixels
-0xBD88, 0x41E2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7800 (30720) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18C1, 0xAD07,   // 0x7810 (30736) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7820 (30752) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7830 (30768) pixels
-0xC5A8, 0xC5A8, 0xAD27, 0x18E1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7840 (30784) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7850 (30800) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x4A43, 0xB547, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7860 (30816) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7870 (30832) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7880 (30848) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7890 (30864) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xBD88, 0x6B04, 0x0840, 0x0000, 0x0000, 0x0000,   // 0x78A0 (30880) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x78B0 (30896) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x9466, 0xC5C8, 0xC5A8,   // 0x78C0 (30912) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x78D0 (30928) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x78E0 (30944) pixels
-0xBD88, 0x31A2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x78F0 (30960) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1080, 0xA4C7,   // 0x7900 (30976) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7910 (30992) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7920 (31008) pixels
-0xC5A8, 0xC5A8, 0xBD67, 0x2942, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7930 (31024) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7940 (31040) pixels
-0x0000, 0x0000, 0x0000, 0x4A43, 0xB547, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7950 (31056) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7960 (31072) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7970 (31088) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7980 (31104) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xBD88, 0x6B04, 0x0820, 0x0000, 0x0000,   // 0x7990 (31120) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x79A0 (31136) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1080, 0xA4C7, 0xC5A8, 0xC5A8,   // 0x79B0 (31152) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x79C0 (31168) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x79D0 (31184) pixels
-0xBD67, 0x2942, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x79E0 (31200) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0860, 0x9C86,   // 0x79F0 (31216) pixels
-0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7A00 (31232) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7A10 (31248) pixels
-0xC5A8, 0xC5A8, 0xBD88, 0x41E2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7A20 (31264) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7A30 (31280) pixels
-0x0000, 0x0000, 0x4A43, 0xB547, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7A40 (31296) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7A50 (31312) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7A60 (31328) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7A70 (31344) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xBD88, 0x6B04, 0x0840, 0x0000,   // 0x7A80 (31360) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7A90 (31376) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2101, 0xB547, 0xC5A8, 0xC5A8,   // 0x7AA0 (31392) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7AB0 (31408) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7AC0 (31424) pixels
-0xB527, 0x2101, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7AD0 (31440) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x8C26,   // 0x7AE0 (31456) pixels
-0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7AF0 (31472) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7B00 (31488) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0x5AA3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7B10 (31504) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7B20 (31520) pixels
-0x0000, 0x4A43, 0xB547, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7B30 (31536) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7B40 (31552) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7B50 (31568) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7B60 (31584) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xBD88, 0x6B04, 0x0820,   // 0x7B70 (31600) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7B80 (31616) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x39A2, 0xBD88, 0xC5A8, 0xC5A8,   // 0x7B90 (31632) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7BA0 (31648) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7BB0 (31664) pixels
-0xA4E7, 0x10A1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7BC0 (31680) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7BA5,   // 0x7BD0 (31696) pixels
-0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7BE0 (31712) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7BF0 (31728) pixels
-0xC5A8, 0xC5A8, 0xC5C8, 0x7365, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7C00 (31744) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7C10 (31760) pixels
-0x4A43, 0xB547, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7C20 (31776) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7C30 (31792) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7C40 (31808) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7C50 (31824) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xBD88, 0x6B04,   // 0x7C60 (31840) pixels
-0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7C70 (31856) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5263, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7C80 (31872) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7C90 (31888) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8,   // 0x7CA0 (31904) pixels
-0x9C86, 0x0860, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7CB0 (31920) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6B24,   // 0x7CC0 (31936) pixels
-0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7CD0 (31952) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7CE0 (31968) pixels
-0xC5A8, 0xC5A8, 0xC5C8, 0x9446, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7CF0 (31984) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4A43,   // 0x7D00 (32000) pixels
-0xB547, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7D10 (32016) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7D20 (32032) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7D30 (32048) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7D40 (32064) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xBD88,   // 0x7D50 (32080) pixels
-0x6304, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7D60 (32096) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7344, 0xC5C8, 0xC5A8, 0xC5A8,   // 0x7D70 (32112) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7D80 (32128) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8,   // 0x7D90 (32144) pixels
-0x8C06, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7DA0 (32160) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5263,   // 0x7DB0 (32176) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7DC0 (32192) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7DD0 (32208) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xA4E7, 0x10A0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7DE0 (32224) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4A43, 0xB547,   // 0x7DF0 (32240) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7E00 (32256) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7E10 (32272) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7E20 (32288) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7E30 (32304) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7E40 (32320) pixels
-0xBD88, 0x6B04, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7E50 (32336) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x8C26, 0xC5C8, 0xC5A8, 0xC5A8,   // 0x7E60 (32352) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7E70 (32368) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8,   // 0x7E80 (32384) pixels
-0x7385, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7E90 (32400) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x41E2,   // 0x7EA0 (32416) pixels
-0xBD88, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7EB0 (32432) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7EC0 (32448) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xBD67, 0x2962, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7ED0 (32464) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4A23, 0xB547, 0xC5A8,   // 0x7EE0 (32480) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7EF0 (32496) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7F00 (32512) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7F10 (32528) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7F20 (32544) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7F30 (32560) pixels
-0xC5A8, 0xBD88, 0x6304, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7F40 (32576) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A1, 0xA4E7, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7F50 (32592) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7F60 (32608) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8,   // 0x7F70 (32624) pixels
-0x62E4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7F80 (32640) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2942,   // 0x7F90 (32656) pixels
-0xB567, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7FA0 (32672) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7FB0 (32688) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0x5263, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7FC0 (32704) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4A23, 0xB547, 0xC5A8, 0xC5A8,   // 0x7FD0 (32720) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7FE0 (32736) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x7FF0 (32752) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8000 (32768) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8010 (32784) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8020 (32800) pixels
-0xC5A8, 0xC5A8, 0xBD88, 0x6304, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x8030 (32816) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3162, 0xBD67, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8040 (32832) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8050 (32848) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8060 (32864) pixels
-0x4A23, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x8070 (32880) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18C1,   // 0x8080 (32896) pixels
-0xAD07, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8090 (32912) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x80A0 (32928) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8, 0x7B85, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x80B0 (32944) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4A23, 0xB547, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x80C0 (32960) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x80D0 (32976) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x80E0 (32992) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x80F0 (33008) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8100 (33024) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8110 (33040) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xBD88, 0x6304, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x8120 (33056) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5A83, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8130 (33072) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8140 (33088) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xBD88,   // 0x8150 (33104) pixels
-0x3182, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x8160 (33120) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840,   // 0x8170 (33136) pixels
-0x9466, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8180 (33152) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8190 (33168) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0x9CA6, 0x1080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x81A0 (33184) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4A23, 0xB547, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x81B0 (33200) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x81C0 (33216) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x81D0 (33232) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x81E0 (33248) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x81F0 (33264) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8200 (33280) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xBD88, 0x6304, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x8210 (33296) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x83C5, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8220 (33312) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8230 (33328) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xAD27,   // 0x8240 (33344) pixels
-0x20E1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x8250 (33360) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x8260 (33376) pixels
-0x7BA5, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8270 (33392) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8280 (33408) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xB567, 0x2941, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x8290 (33424) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4A23, 0xB547, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x82A0 (33440) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x82B0 (33456) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x82C0 (33472) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x82D0 (33488) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x82E0 (33504) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x82F0 (33520) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xBD88, 0x6304, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x8300 (33536) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18A1, 0xA4E7, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8310 (33552) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8320 (33568) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8, 0x9C86,   // 0x8330 (33584) pixels
-0x0860, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x8340 (33600) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x8350 (33616) pixels
-0x5AC4, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8360 (33632) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8370 (33648) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0x5A83, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x8380 (33664) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4A23, 0xB547, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8390 (33680) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x83A0 (33696) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x83B0 (33712) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x83C0 (33728) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x83D0 (33744) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x83E0 (33760) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xBD88, 0x6304, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x83F0 (33776) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x39A2, 0xBD88, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8400 (33792) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8410 (33808) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8, 0x83C5,   // 0x8420 (33824) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x8430 (33840) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x8440 (33856) pixels
-0x39C2, 0xBD88, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8450 (33872) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8460 (33888) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8, 0x8C05, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x8470 (33904) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4A23, 0xB547, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8480 (33920) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8490 (33936) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x84A0 (33952) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x84B0 (33968) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x84C0 (33984) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x84D0 (34000) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xBD88, 0x6304, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x84E0 (34016) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6B24, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x84F0 (34032) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8500 (34048) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8, 0x62C4,   // 0x8510 (34064) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x8520 (34080) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x8530 (34096) pixels
-0x2101, 0xB527, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8540 (34112) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8550 (34128) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xAD27, 0x20E1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x8560 (34144) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4A23, 0xB547, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8570 (34160) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8580 (34176) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8590 (34192) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x85A0 (34208) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x85B0 (34224) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x85C0 (34240) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xBD88, 0x62E4, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x85D0 (34256) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0860, 0x9C86, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x85E0 (34272) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x85F0 (34288) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xBD88, 0x39C2,   // 0x8600 (34304) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x8610 (34320) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x8620 (34336) pixels
-0x0860, 0x9C86, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8630 (34352) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8640 (34368) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0x4A43, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x8650 (34384) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4A23, 0xB547, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8660 (34400) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8670 (34416) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8680 (34432) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8690 (34448) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x86A0 (34464) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x86B0 (34480) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xBD88, 0x6304, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x86C0 (34496) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3182, 0xBD67, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x86D0 (34512) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x86E0 (34528) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xB527, 0x2101,   // 0x86F0 (34544) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x8700 (34560) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x8710 (34576) pixels
-0x0000, 0x7B85, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8720 (34592) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8730 (34608) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8, 0x8C05, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x8740 (34624) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x4A23, 0xB547, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8750 (34640) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8760 (34656) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8770 (34672) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8780 (34688) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8790 (34704) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x87A0 (34720) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xBD88, 0x6304, 0x0820, 0x0000, 0x0000, 0x0000,   // 0x87B0 (34736) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6B24, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x87C0 (34752) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x87D0 (34768) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8, 0x9C86, 0x0860,   // 0x87E0 (34784) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x87F0 (34800) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x8800 (34816) pixels
-0x0000, 0x5263, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8810 (34832) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8820 (34848) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xB547, 0x2921, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x8830 (34864) pixels
-0x0000, 0x0000, 0x0000, 0x4A23, 0xB547, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8840 (34880) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8850 (34896) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8860 (34912) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8870 (34928) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8880 (34944) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8890 (34960) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xBD88, 0x62E4, 0x0020, 0x0000, 0x0000,   // 0x88A0 (34976) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1080, 0xA4A6, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x88B0 (34992) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x88C0 (35008) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8, 0x7385, 0x0000,   // 0x88D0 (35024) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x88E0 (35040) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x88F0 (35056) pixels
-0x0000, 0x2941, 0xB567, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8900 (35072) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8910 (35088) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0x62E4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x8920 (35104) pixels
-0x0000, 0x0000, 0x4A23, 0xB547, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8930 (35120) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8940 (35136) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8950 (35152) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8960 (35168) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8970 (35184) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8980 (35200) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xBD88, 0x62E4, 0x0020, 0x0000,   // 0x8990 (35216) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4202, 0xBD88, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x89A0 (35232) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x89B0 (35248) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0x4A43, 0x0000,   // 0x89C0 (35264) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x89D0 (35280) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x89E0 (35296) pixels
-0x0000, 0x1080, 0x9CA6, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x89F0 (35312) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8A00 (35328) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8, 0x9CA6, 0x1080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x8A10 (35344) pixels
-0x0000, 0x4A23, 0xB547, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8A20 (35360) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8A30 (35376) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8A40 (35392) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8A50 (35408) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8A60 (35424) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8A70 (35440) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xBD88, 0x6304, 0x0020,   // 0x8A80 (35456) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x83E5, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8A90 (35472) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8AA0 (35488) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xB547, 0x2121, 0x0000,   // 0x8AB0 (35504) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x8AC0 (35520) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x8AD0 (35536) pixels
-0x0000, 0x0000, 0x7BA5, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8AE0 (35552) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8AF0 (35568) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xBD88, 0x4A23, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x8B00 (35584) pixels
-0x4A23, 0xB547, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8B10 (35600) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8B20 (35616) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8B30 (35632) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xBD88, 0xBD67, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8B40 (35648) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8B50 (35664) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8B60 (35680) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xBD88, 0x62E4,   // 0x8B70 (35696) pixels
-0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2941, 0xB547, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8B80 (35712) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8B90 (35728) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8, 0x9C86, 0x0860, 0x0000,   // 0x8BA0 (35744) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x8BB0 (35760) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x8BC0 (35776) pixels
-0x0000, 0x0000, 0x4A43, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8BD0 (35792) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8BE0 (35808) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8, 0x8C05, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4A23,   // 0x8BF0 (35824) pixels
-0xB547, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8C00 (35840) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8C10 (35856) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8C20 (35872) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xBD67, 0x5AA3, 0x4202, 0xAD07, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8C30 (35888) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8C40 (35904) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8C50 (35920) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xBD88,   // 0x8C60 (35936) pixels
-0x62E4, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7344, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8C70 (35952) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8C80 (35968) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8, 0x7344, 0x0000, 0x0000,   // 0x8C90 (35984) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x8CA0 (36000) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x8CB0 (36016) pixels
-0x0000, 0x0000, 0x2101, 0xB527, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8CC0 (36032) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8CD0 (36048) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xBD67, 0x39A2, 0x0000, 0x0000, 0x0000, 0x0000, 0x4A23, 0xB547,   // 0x8CE0 (36064) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8CF0 (36080) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8D00 (36096) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8D10 (36112) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xBD67, 0x5283, 0x0000, 0x0000, 0x39C2, 0xAD07, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8D20 (36128) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8D30 (36144) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8D40 (36160) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8D50 (36176) pixels
-0xBD88, 0x62E4, 0x0020, 0x0000, 0x0000, 0x0000, 0x20E1, 0xAD07, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8D60 (36192) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8D70 (36208) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xBD88, 0x41E2, 0x0000, 0x0000,   // 0x8D80 (36224) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x8D90 (36240) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x8DA0 (36256) pixels
-0x0000, 0x0000, 0x0840, 0x9446, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8DB0 (36272) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8DC0 (36288) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8, 0x83C5, 0x0020, 0x0000, 0x0000, 0x4A23, 0xB547, 0xC5A8,   // 0x8DD0 (36304) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8DE0 (36320) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8DF0 (36336) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8E00 (36352) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xBD67, 0x5283, 0x0000, 0x0000, 0x0000, 0x0000, 0x39C2, 0xAD07, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8E10 (36368) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8E20 (36384) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8E30 (36400) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8E40 (36416) pixels
-0xC5A8, 0xBD88, 0x62E4, 0x0020, 0x0000, 0x0000, 0x6304, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8E50 (36432) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8E60 (36448) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xACE7, 0x18C1, 0x0000, 0x0000,   // 0x8E70 (36464) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x8E80 (36480) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x8E90 (36496) pixels
-0x0000, 0x0000, 0x0000, 0x62E4, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8EA0 (36512) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8EB0 (36528) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xB567, 0x3182, 0x0000, 0x4A23, 0xB547, 0xC5A8, 0xC5A8,   // 0x8EC0 (36544) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8ED0 (36560) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8EE0 (36576) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8EF0 (36592) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xBD67, 0x5283, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x39C2, 0xAD07, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8F00 (36608) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8F10 (36624) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8F20 (36640) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8F30 (36656) pixels
-0xC5A8, 0xC5A8, 0xBD88, 0x62E4, 0x0020, 0x18E1, 0xACE7, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8F40 (36672) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8F50 (36688) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8, 0x83E5, 0x0020, 0x0000, 0x0000,   // 0x8F60 (36704) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x8F70 (36720) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x8F80 (36736) pixels
-0x0000, 0x0000, 0x0000, 0x2962, 0xB567, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8F90 (36752) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8FA0 (36768) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8, 0x83E5, 0x4A43, 0xB547, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8FB0 (36784) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8FC0 (36800) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8FD0 (36816) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x8FE0 (36832) pixels
-0xC5A8, 0xC5A8, 0xBD67, 0x5283, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x39C2, 0xAD07, 0xC5A8, 0xC5A8,   // 0x8FF0 (36848) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9000 (36864) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9010 (36880) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9020 (36896) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xBD88, 0x62E4, 0x7344, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9030 (36912) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9040 (36928) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0x5263, 0x0000, 0x0000, 0x0000,   // 0x9050 (36944) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9060 (36960) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9070 (36976) pixels
-0x0000, 0x0000, 0x0000, 0x0840, 0x9466, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9080 (36992) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9090 (37008) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xCE08, 0xC5E8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x90A0 (37024) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x90B0 (37040) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x90C0 (37056) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x90D0 (37072) pixels
-0xC5A8, 0xBD67, 0x5283, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x39C2, 0xAD07, 0xC5A8,   // 0x90E0 (37088) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x90F0 (37104) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9100 (37120) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9110 (37136) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8, 0xD628, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9120 (37152) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9130 (37168) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xAD07, 0x20E1, 0x0000, 0x0000, 0x0000,   // 0x9140 (37184) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9150 (37200) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9160 (37216) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x62E4, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9170 (37232) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9180 (37248) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xD628, 0xEEEA, 0xE6C9, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9190 (37264) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x91A0 (37280) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x91B0 (37296) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x91C0 (37312) pixels
-0xBD67, 0x5283, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x39C2, 0xAD07,   // 0x91D0 (37328) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x91E0 (37344) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x91F0 (37360) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9200 (37376) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xDE89, 0xEF0A, 0xDE69, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9210 (37392) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9220 (37408) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8, 0x83E5, 0x0020, 0x0000, 0x0000, 0x0000,   // 0x9230 (37424) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9240 (37440) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9250 (37456) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x2941, 0xB547, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9260 (37472) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9270 (37488) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xD628, 0xEEEA, 0xF70A, 0xEF0A, 0xD649, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9280 (37504) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9290 (37520) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x92A0 (37536) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xBD67,   // 0x92B0 (37552) pixels
-0x5A83, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x39C2,   // 0x92C0 (37568) pixels
-0xAD07, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x92D0 (37584) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x92E0 (37600) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x92F0 (37616) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xCE08, 0xEF0A, 0xF70A, 0xEF0A, 0xDE69, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9300 (37632) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9310 (37648) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xBDA8, 0x4A43, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9320 (37664) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9330 (37680) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9340 (37696) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x8C26, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9350 (37712) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9360 (37728) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xD628, 0xEEEA, 0xF70A, 0xEF0A, 0xF70A, 0xEEE9, 0xCDE8, 0xC5A8, 0xC5A8,   // 0x9370 (37744) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9380 (37760) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9390 (37776) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xBD67, 0x5283,   // 0x93A0 (37792) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x93B0 (37808) pixels
-0x39C2, 0xAD07, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x93C0 (37824) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x93D0 (37840) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x93E0 (37856) pixels
-0xC5A8, 0xC5A8, 0xC5C8, 0xE6A9, 0xF70A, 0xEF0A, 0xF70A, 0xEF0A, 0xDE69, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x93F0 (37872) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9400 (37888) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xACE7, 0x18C1, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9410 (37904) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9420 (37920) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9430 (37936) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5263, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9440 (37952) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9450 (37968) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xD628, 0xEEEA, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xDE89, 0xC5A8, 0xC5A8,   // 0x9460 (37984) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9470 (38000) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9480 (38016) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xBD67, 0x5283, 0x0000,   // 0x9490 (38032) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x94A0 (38048) pixels
-0x0000, 0x39C2, 0xAD07, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x94B0 (38064) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x94C0 (38080) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x94D0 (38096) pixels
-0xC5A8, 0xC5A8, 0xD649, 0xEF0A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEF0A, 0xDE69, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x94E0 (38112) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x94F0 (38128) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8, 0x7365, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9500 (38144) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9510 (38160) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9520 (38176) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18E1, 0xAD07, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9530 (38192) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9540 (38208) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xD628, 0xEEEA, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xD628, 0xC5A8,   // 0x9550 (38224) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9560 (38240) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9570 (38256) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xBD67, 0x5283, 0x0020, 0x0000,   // 0x9580 (38272) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9590 (38288) pixels
-0x0000, 0x0000, 0x39C2, 0xAD27, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x95A0 (38304) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x95B0 (38320) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x95C0 (38336) pixels
-0xC5A8, 0xCE08, 0xEEEA, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEF0A, 0xDE69, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x95D0 (38352) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x95E0 (38368) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xBD88, 0x39A2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x95F0 (38384) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9600 (38400) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9610 (38416) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7385, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9620 (38432) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9630 (38448) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xD628, 0xEEEA, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEEC9, 0xCDE8,   // 0x9640 (38464) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9650 (38480) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9660 (38496) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xBD67, 0x5A83, 0x0020, 0x0000, 0x0000,   // 0x9670 (38512) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9680 (38528) pixels
-0x0000, 0x0000, 0x0000, 0x39C2, 0xAD27, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9690 (38544) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x96A0 (38560) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x96B0 (38576) pixels
-0xC5C8, 0xE6A9, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEF0A, 0xDE69, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x96C0 (38592) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x96D0 (38608) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8, 0x9466, 0x0860, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x96E0 (38624) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x96F0 (38640) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9700 (38656) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x31A2, 0xBD67, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9710 (38672) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9720 (38688) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xD628, 0xEEEA, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xDE89,   // 0x9730 (38704) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9740 (38720) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9750 (38736) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xBD67, 0x5A83, 0x0020, 0x0000, 0x0000, 0x0000,   // 0x9760 (38752) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9770 (38768) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x39C2, 0xAD07, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9780 (38784) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9790 (38800) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x97A0 (38816) pixels
-0xDE69, 0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEF0A, 0xDE69, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x97B0 (38832) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x97C0 (38848) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0x5283, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x97D0 (38864) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x97E0 (38880) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x97F0 (38896) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x8C26, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9800 (38912) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9810 (38928) pixels
-0xC5A8, 0xC5A8, 0xD628, 0xEEEA, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A,   // 0x9820 (38944) pixels
-0xD649, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9830 (38960) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9840 (38976) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xBD67, 0x5A83, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9850 (38992) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9860 (39008) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x39C2, 0xAD27, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9870 (39024) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9880 (39040) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xD628,   // 0x9890 (39056) pixels
-0xEEEA, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEF0A, 0xDE69, 0xC5A8, 0xC5A8,   // 0x98A0 (39072) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x98B0 (39088) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xAD07, 0x18E1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x98C0 (39104) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x98D0 (39120) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x98E0 (39136) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4A43, 0xBDA8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x98F0 (39152) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9900 (39168) pixels
-0xC5A8, 0xD628, 0xEEEA, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A,   // 0x9910 (39184) pixels
-0xEEEA, 0xCE08, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9920 (39200) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9930 (39216) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xBD67, 0x5AA3, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9940 (39232) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9950 (39248) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x39E2, 0xAD27, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9960 (39264) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9970 (39280) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xCDE8, 0xEEC9,   // 0x9980 (39296) pixels
-0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEF0A, 0xDE69, 0xC5A8,   // 0x9990 (39312) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x99A0 (39328) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8, 0x6B44, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x99B0 (39344) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x99C0 (39360) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x99D0 (39376) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1080, 0x9CA6, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x99E0 (39392) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x99F0 (39408) pixels
-0xD628, 0xEEEA, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A,   // 0x9A00 (39424) pixels
-0xF70A, 0xE6C9, 0xCDE8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9A10 (39440) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9A20 (39456) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xBD67, 0x5AA3, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9A30 (39472) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9A40 (39488) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x39C2, 0xAD27, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9A50 (39504) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9A60 (39520) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8, 0xE6A9, 0xF70A,   // 0x9A70 (39536) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEF0A, 0xDE69,   // 0x9A80 (39552) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9A90 (39568) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xB547, 0x2941, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9AA0 (39584) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9AB0 (39600) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9AC0 (39616) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5AA3, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9AD0 (39632) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xD628,   // 0x9AE0 (39648) pixels
-0xEEEA, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x9AF0 (39664) pixels
-0xF70A, 0xF70A, 0xE6A9, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9B00 (39680) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9B10 (39696) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xBD67, 0x5AA3, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9B20 (39712) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9B30 (39728) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x39C2, 0xAD27, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9B40 (39744) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9B50 (39760) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xDE89, 0xF70A, 0xF70A,   // 0x9B60 (39776) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEF0A,   // 0x9B70 (39792) pixels
-0xDE69, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9B80 (39808) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8, 0x7BA5, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9B90 (39824) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9BA0 (39840) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9BB0 (39856) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18C1, 0xA4C7, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9BC0 (39872) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xD628, 0xEEEA,   // 0x9BD0 (39888) pixels
-0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x9BE0 (39904) pixels
-0xF70A, 0xF70A, 0xF70A, 0xDE89, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9BF0 (39920) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9C00 (39936) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xBD67, 0x5AA3, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9C10 (39952) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9C20 (39968) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x39C2, 0xAD27, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9C30 (39984) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9C40 (40000) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xDE69, 0xEF0A, 0xF70A, 0xEF0A,   // 0x9C50 (40016) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A,   // 0x9C60 (40032) pixels
-0xEF0A, 0xDE69, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9C70 (40048) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xB567, 0x3182, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9C80 (40064) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9C90 (40080) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9CA0 (40096) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x62E4, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9CB0 (40112) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xD628, 0xEEEA, 0xF70A,   // 0x9CC0 (40128) pixels
-0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x9CD0 (40144) pixels
-0xF70A, 0xEF0A, 0xF70A, 0xEF0A, 0xDE69, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9CE0 (40160) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9CF0 (40176) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xBD67, 0x5AA3, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9D00 (40192) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9D10 (40208) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x39E2, 0xAD27, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9D20 (40224) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9D30 (40240) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xD649, 0xEF0A, 0xF70A, 0xEF0A, 0xF70A,   // 0x9D40 (40256) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A,   // 0x9D50 (40272) pixels
-0xF70A, 0xEF0A, 0xDE69, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9D60 (40288) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8, 0x83E5, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9D70 (40304) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9D80 (40320) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9D90 (40336) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18C1, 0xA4E7, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9DA0 (40352) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xD628, 0xEEEA, 0xF70A, 0xEF0A,   // 0x9DB0 (40368) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x9DC0 (40384) pixels
-0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEF0A, 0xD649, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9DD0 (40400) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9DE0 (40416) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xBD67, 0x5AA3, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9DF0 (40432) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9E00 (40448) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x39C2, 0xAD27, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9E10 (40464) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9E20 (40480) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xD628, 0xEEEA, 0xF70A, 0xEF0A, 0xF70A, 0xF70A,   // 0x9E30 (40496) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x9E40 (40512) pixels
-0xEF0A, 0xF70A, 0xEF0A, 0xDE69, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9E50 (40528) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xB567, 0x39A2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9E60 (40544) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9E70 (40560) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9E80 (40576) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x62E4, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9E90 (40592) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xD628, 0xEEEA, 0xF70A, 0xEF0A, 0xF70A,   // 0x9EA0 (40608) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x9EB0 (40624) pixels
-0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEF0A, 0xD649, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9EC0 (40640) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9ED0 (40656) pixels
-0xC5A8, 0xC5A8, 0xBD67, 0x5AA3, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9EE0 (40672) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9EF0 (40688) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x41E2, 0xAD27, 0xC5A8, 0xC5A8,   // 0x9F00 (40704) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9F10 (40720) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xD628, 0xEEEA, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A,   // 0x9F20 (40736) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x9F30 (40752) pixels
-0xF70A, 0xEF0A, 0xF70A, 0xEF0A, 0xDE69, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9F40 (40768) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8, 0x83E5, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9F50 (40784) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9F60 (40800) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9F70 (40816) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18C1, 0xA4C6, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9F80 (40832) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xD628, 0xEEEA, 0xF70A, 0xEF0A, 0xF70A, 0xF70A,   // 0x9F90 (40848) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0x9FA0 (40864) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEF0A, 0xD649, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9FB0 (40880) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0x9FC0 (40896) pixels
-0xC5A8, 0xBD67, 0x5AA3, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9FD0 (40912) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9FE0 (40928) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x41E2, 0xAD27, 0xC5A8,   // 0x9FF0 (40944) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xA000 (40960) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xD628, 0xEEEA, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xA010 (40976) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xA020 (40992) pixels
-0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEF0A, 0xDE49, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xA030 (41008) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xB547, 0x3182, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA040 (41024) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA050 (41040) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA060 (41056) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5283, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xA070 (41072) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xD628, 0xEEEA, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A,   // 0xA080 (41088) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xA090 (41104) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEF0A, 0xD649, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xA0A0 (41120) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xA0B0 (41136) pixels
-0xBD67, 0x5AA3, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA0C0 (41152) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA0D0 (41168) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x41E2, 0xAD27,   // 0xA0E0 (41184) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xA0F0 (41200) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xD628, 0xEEEA, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xA100 (41216) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xA110 (41232) pixels
-0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEF0A, 0xDE69, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xA120 (41248) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8, 0x7B85, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA130 (41264) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA140 (41280) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA150 (41296) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1080, 0x9466, 0xC5C8, 0xC5A8, 0xC5A8,   // 0xA160 (41312) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xD628, 0xEEEA, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xA170 (41328) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xA180 (41344) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEF0A, 0xDE69, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xA190 (41360) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xBD67,   // 0xA1A0 (41376) pixels
-0x5AA3, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA1B0 (41392) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA1C0 (41408) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x41E2,   // 0xA1D0 (41424) pixels
-0xAD27, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xA1E0 (41440) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xD649, 0xEEEA, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xA1F0 (41456) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xA200 (41472) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEF0A, 0xDE69, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xA210 (41488) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xAD27, 0x2921, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA220 (41504) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA230 (41520) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA240 (41536) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4202, 0xBD88, 0xC5A8, 0xC5A8,   // 0xA250 (41552) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xD628, 0xEEEA, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xA260 (41568) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xA270 (41584) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEF0A, 0xDE89, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xA280 (41600) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xBD67, 0x5AA3,   // 0xA290 (41616) pixels
-0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA2A0 (41632) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA2B0 (41648) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA2C0 (41664) pixels
-0x41E2, 0xAD27, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xA2D0 (41680) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xDE69, 0xEF0A, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xA2E0 (41696) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xA2F0 (41712) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEF0A, 0xDE49, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xA300 (41728) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0x62E4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA310 (41744) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA320 (41760) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA330 (41776) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x83E5, 0xC5C8, 0xC5A8,   // 0xA340 (41792) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xD628, 0xEEEA, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xA350 (41808) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xA360 (41824) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xE6A9, 0xCDE8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xA370 (41840) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xBD67, 0x5AA3, 0x0020,   // 0xA380 (41856) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA390 (41872) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA3A0 (41888) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA3B0 (41904) pixels
-0x0000, 0x41E2, 0xAD27, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xA3C0 (41920) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8, 0xDE89, 0xEF0A, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xA3D0 (41936) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xA3E0 (41952) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEF0A, 0xDE69, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xA3F0 (41968) pixels
-0xC5A8, 0xC5A8, 0x9CA6, 0x18A1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA400 (41984) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA410 (42000) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA420 (42016) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2942, 0xB527, 0xC5A8,   // 0xA430 (42032) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xD628, 0xEEEA, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xA440 (42048) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xA450 (42064) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xE6C9, 0xCE08, 0xC5A8, 0xC5A8,   // 0xA460 (42080) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xBD67, 0x5AA3, 0x0020, 0x0000,   // 0xA470 (42096) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA480 (42112) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA490 (42128) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA4A0 (42144) pixels
-0x0000, 0x0000, 0x41E2, 0xAD27, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xA4B0 (42160) pixels
-0xC5A8, 0xC5A8, 0xCDE8, 0xE6A9, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xA4C0 (42176) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xA4D0 (42192) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEF0A, 0xDE69, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xA4E0 (42208) pixels
-0xC5A8, 0xBD88, 0x4A23, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA4F0 (42224) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA500 (42240) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA510 (42256) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x62E4, 0xC5A8,   // 0xA520 (42272) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xD628, 0xEEEA, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xA530 (42288) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xA540 (42304) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEEEA, 0xD649, 0xC5A8,   // 0xA550 (42320) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xBD87, 0x5AA3, 0x0020, 0x0000, 0x0000,   // 0xA560 (42336) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA570 (42352) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA580 (42368) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA590 (42384) pixels
-0x0000, 0x0000, 0x0000, 0x41E2, 0xB527, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xA5A0 (42400) pixels
-0xC5A8, 0xD628, 0xEEC9, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xA5B0 (42416) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xA5C0 (42432) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEF0A, 0xDE49, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xA5D0 (42448) pixels
-0xC5C8, 0x83E5, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA5E0 (42464) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA5F0 (42480) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA600 (42496) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1080, 0x9C66,   // 0xA610 (42512) pixels
-0xC5C8, 0xC5A8, 0xC5A8, 0xD628, 0xEEEA, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xA620 (42528) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xA630 (42544) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEF0A, 0xDE89,   // 0xA640 (42560) pixels
-0xC5E8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xBD87, 0x5AA3, 0x0020, 0x0000, 0x0000, 0x0000,   // 0xA650 (42576) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA660 (42592) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA670 (42608) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA680 (42624) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x41E2, 0xAD27, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8,   // 0xA690 (42640) pixels
-0xDE69, 0xEEEA, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xA6A0 (42656) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xA6B0 (42672) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEF0A, 0xDE49, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xA6C0 (42688) pixels
-0xAD27, 0x2941, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA6D0 (42704) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA6E0 (42720) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA6F0 (42736) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x39C2,   // 0xA700 (42752) pixels
-0xB567, 0xC5A8, 0xD628, 0xEEEA, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xA710 (42768) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xA720 (42784) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xF70A,   // 0xA730 (42800) pixels
-0xE6C9, 0xD628, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xBD87, 0x5AA3, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA740 (42816) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA750 (42832) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA760 (42848) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA770 (42864) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x41E2, 0xB527, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xCE08, 0xE6A9,   // 0xA780 (42880) pixels
-0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xA790 (42896) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xA7A0 (42912) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEF0A, 0xD649, 0xC5A8, 0xBDA8,   // 0xA7B0 (42928) pixels
-0x5AC4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA7C0 (42944) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA7D0 (42960) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA7E0 (42976) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA7F0 (42992) pixels
-0x6B44, 0xD628, 0xEEEA, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xA800 (43008) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xA810 (43024) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xA820 (43040) pixels
-0xF70A, 0xEF0A, 0xDE69, 0xC5E8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xBD88, 0x5AA3, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA830 (43056) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA840 (43072) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA850 (43088) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA860 (43104) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x41E2, 0xB527, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8, 0xDE69, 0xEEEA, 0xF70A,   // 0xA870 (43120) pixels
-0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xA880 (43136) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xA890 (43152) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEF0A, 0xDE69, 0x8C26,   // 0xA8A0 (43168) pixels
-0x0860, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA8B0 (43184) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA8C0 (43200) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA8D0 (43216) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA8E0 (43232) pixels
-0x2941, 0xDE69, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xA8F0 (43248) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xA900 (43264) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xA910 (43280) pixels
-0xEF0A, 0xF70A, 0xF70A, 0xEEC9, 0xD629, 0xC5C8, 0xC5A8, 0xBD88, 0x5AA4, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA920 (43296) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA930 (43312) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA940 (43328) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA950 (43344) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x41E2, 0xB527, 0xC5A8, 0xC5A8, 0xD628, 0xE6C9, 0xEF0A, 0xF70A, 0xEF0A,   // 0xA960 (43360) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xA970 (43376) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xA980 (43392) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEEE9, 0x5263,   // 0xA990 (43408) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA9A0 (43424) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA9B0 (43440) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA9C0 (43456) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA9D0 (43472) pixels
-0x0860, 0x9466, 0xEF0A, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xA9E0 (43488) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xA9F0 (43504) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xAA00 (43520) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xE6A9, 0xCDE8, 0x62C4, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xAA10 (43536) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xAA20 (43552) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xAA30 (43568) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xAA40 (43584) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4202, 0xBD88, 0xE689, 0xEF0A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A,   // 0xAA50 (43600) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xAA60 (43616) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xAA70 (43632) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xB547, 0x20E1,   // 0xAA80 (43648) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xAA90 (43664) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xAAA0 (43680) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xAAB0 (43696) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xAAC0 (43712) pixels
-0x0000, 0x18A1, 0xA4C6, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xAAD0 (43728) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xAAE0 (43744) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xAAF0 (43760) pixels
-0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEF0A, 0xD628, 0x7BC5, 0x2941, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xAB00 (43776) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xAB10 (43792) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xAB20 (43808) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xAB30 (43824) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2101, 0x6B44, 0xC5C8, 0xEEEA, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A,   // 0xAB40 (43840) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xAB50 (43856) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xAB60 (43872) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF72A, 0xC5A8, 0x2942, 0x0000,   // 0xAB70 (43888) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xAB80 (43904) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xAB90 (43920) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xABA0 (43936) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xABB0 (43952) pixels
-0x0000, 0x0000, 0x18C1, 0xB527, 0xF72A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xABC0 (43968) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xABD0 (43984) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xABE0 (44000) pixels
-0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEF0A, 0xD649, 0xC5A8, 0xC5A8, 0xB547, 0x7385, 0x2962, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xABF0 (44016) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xAC00 (44032) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xAC10 (44048) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xAC20 (44064) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2101, 0x6B24, 0xAD07, 0xC5A8, 0xC5A8, 0xD628, 0xEEEA, 0xF70A, 0xEF0A, 0xF70A, 0xF70A,   // 0xAC30 (44080) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xAC40 (44096) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xAC50 (44112) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF72A, 0xCE08, 0x3182, 0x0000, 0x0000,   // 0xAC60 (44128) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xAC70 (44144) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xAC80 (44160) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xAC90 (44176) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xACA0 (44192) pixels
-0x0000, 0x0000, 0x0000, 0x2941, 0xC5C8, 0xF72A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xACB0 (44208) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xACC0 (44224) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xACD0 (44240) pixels
-0xF70A, 0xEF0A, 0xF70A, 0xEF0A, 0xD649, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8, 0xB547, 0x83C5, 0x39C2, 0x0840, 0x0000, 0x0000,   // 0xACE0 (44256) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xACF0 (44272) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xAD00 (44288) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xAD10 (44304) pixels
-0x0000, 0x0000, 0x0840, 0x3182, 0x7365, 0xAD27, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xD628, 0xEEEA, 0xF70A, 0xEF0A, 0xF70A,   // 0xAD20 (44320) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xAD30 (44336) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xAD40 (44352) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xDE89, 0x4A23, 0x0000, 0x0000, 0x0000,   // 0xAD50 (44368) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xAD60 (44384) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xAD70 (44400) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xAD80 (44416) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xAD90 (44432) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x4A23, 0xDE69, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xADA0 (44448) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xADB0 (44464) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xADC0 (44480) pixels
-0xEF0A, 0xF70A, 0xEF0A, 0xD649, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8, 0xBD87, 0x9446, 0x5283, 0x18E1,   // 0xADD0 (44496) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xADE0 (44512) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xADF0 (44528) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xAE00 (44544) pixels
-0x18A1, 0x4A23, 0x8C05, 0xB567, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xD628, 0xEEEA, 0xF70A, 0xEF0A,   // 0xAE10 (44560) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xAE20 (44576) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xAE30 (44592) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xE6C9, 0x6B24, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xAE40 (44608) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xAE50 (44624) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xAE60 (44640) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xAE70 (44656) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xAE80 (44672) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x62E4, 0xE6A9, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xAE90 (44688) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xAEA0 (44704) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A,   // 0xAEB0 (44720) pixels
-0xF70A, 0xEF0A, 0xD649, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8, 0xC5A8, 0xAD07,   // 0xAEC0 (44736) pixels
-0x7BA5, 0x41E2, 0x18A1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xAED0 (44752) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xAEE0 (44768) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1080, 0x39A2, 0x7364,   // 0xAEF0 (44784) pixels
-0xA4E7, 0xBDA8, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xD628, 0xEEEA, 0xF70A,   // 0xAF00 (44800) pixels
-0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xAF10 (44816) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xAF20 (44832) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEEEA, 0x8C05, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xAF30 (44848) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xAF40 (44864) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xAF50 (44880) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xAF60 (44896) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xAF70 (44912) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x83C5, 0xE6A9, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xAF80 (44928) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xAF90 (44944) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A,   // 0xAFA0 (44960) pixels
-0xEF0A, 0xD649, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xAFB0 (44976) pixels
-0xC5C8, 0xBD88, 0xA4E7, 0x7BA5, 0x4A23, 0x2101, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xAFC0 (44992) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xAFD0 (45008) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x18C1, 0x41E2, 0x7365, 0xA4C6, 0xBD88, 0xC5C8,   // 0xAFE0 (45024) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xD628, 0xEEEA,   // 0xAFF0 (45040) pixels
-0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xB000 (45056) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xB010 (45072) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEEEA, 0xA4C6, 0x18C1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB020 (45088) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB030 (45104) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB040 (45120) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB050 (45136) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB060 (45152) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A0, 0x9466, 0xE6C9, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xB070 (45168) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xB080 (45184) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEF0A,   // 0xB090 (45200) pixels
-0xD649, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xB0A0 (45216) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8, 0xBDA8, 0xB527, 0x9446, 0x6B24, 0x41E2, 0x2101, 0x0860, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB0B0 (45232) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB0C0 (45248) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x18E1, 0x39C2, 0x62E4, 0x8C26, 0xAD07, 0xBD88, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xB0D0 (45264) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xD628,   // 0xB0E0 (45280) pixels
-0xEEEA, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xB0F0 (45296) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xB100 (45312) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEEEA, 0xB527, 0x2921, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB110 (45328) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB120 (45344) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB130 (45360) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB140 (45376) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB150 (45392) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2101, 0xA4E7, 0xE6C9, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xB160 (45408) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xB170 (45424) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEF0A, 0xD649,   // 0xB180 (45440) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xB190 (45456) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8, 0xC5C8, 0xBD88, 0xB527, 0x9C86, 0x83E5, 0x6304, 0x4A23, 0x3182, 0x2101,   // 0xB1A0 (45472) pixels
-0x10A0, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x1080,   // 0xB1B0 (45488) pixels
-0x18E1, 0x3162, 0x4203, 0x62E4, 0x7BC5, 0x9466, 0xAD27, 0xBD88, 0xC5C8, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xB1C0 (45504) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xB1D0 (45520) pixels
-0xD628, 0xEEEA, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xB1E0 (45536) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xB1F0 (45552) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEEE9, 0xBD88, 0x39C2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB200 (45568) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB210 (45584) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB220 (45600) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB230 (45616) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB240 (45632) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3182, 0xB527, 0xE6A9, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xB250 (45648) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xB260 (45664) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEF0A, 0xD649, 0xC5A8,   // 0xB270 (45680) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xB280 (45696) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8, 0xC5C8, 0xC5C8, 0xC5A8, 0xBD67, 0xB527,   // 0xB290 (45712) pixels
-0xA4E7, 0x9C86, 0x8C26, 0x83C5, 0x7385, 0x7344, 0x6B24, 0x6B04, 0x6B04, 0x6B24, 0x7344, 0x7365, 0x7BA5, 0x8C05, 0x9466, 0xA4C7,   // 0xB2A0 (45728) pixels
-0xAD27, 0xBD67, 0xBDA8, 0xC5C8, 0xC5C8, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xB2B0 (45744) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xB2C0 (45760) pixels
-0xC5A8, 0xD628, 0xEEEA, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xB2D0 (45776) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xB2E0 (45792) pixels
-0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEEE9, 0xC5C8, 0x5243, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB2F0 (45808) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB300 (45824) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB310 (45840) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB320 (45856) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB330 (45872) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x41E2, 0xBD67, 0xE6A9, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xB340 (45888) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xB350 (45904) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEF0A, 0xDE49, 0xC5A8, 0xC5A8,   // 0xB360 (45920) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xB370 (45936) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xB380 (45952) pixels
-0xC5A8, 0xC5C8, 0xC5C8, 0xC5C8, 0xC5C8, 0xC5C8, 0xC5C8, 0xC5C8, 0xC5C8, 0xC5C8, 0xC5C8, 0xC5C8, 0xC5C8, 0xC5C8, 0xC5C8, 0xC5A8,   // 0xB390 (45968) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xB3A0 (45984) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xB3B0 (46000) pixels
-0xC5A8, 0xC5A8, 0xD628, 0xEEEA, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xB3C0 (46016) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xB3D0 (46032) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEEC9, 0xC5E8, 0x5AC4, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB3E0 (46048) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB3F0 (46064) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB400 (46080) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB410 (46096) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB420 (46112) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4A23, 0xBD88, 0xE6A9, 0xF70A, 0xF70A, 0xF70A,   // 0xB430 (46128) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xB440 (46144) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEF0A, 0xDE49, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xB450 (46160) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xB460 (46176) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xB470 (46192) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xB480 (46208) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xB490 (46224) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xB4A0 (46240) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xD628, 0xEEEA, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xB4B0 (46256) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xB4C0 (46272) pixels
-0xF70A, 0xF70A, 0xF70A, 0xEEC9, 0xCDE8, 0x6B04, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB4D0 (46288) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB4E0 (46304) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB4F0 (46320) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB500 (46336) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB510 (46352) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5283, 0xC5A8, 0xE6A9, 0xF70A, 0xF70A,   // 0xB520 (46368) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xB530 (46384) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEF0A, 0xDE49, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xB540 (46400) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xB550 (46416) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xB560 (46432) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xB570 (46448) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xB580 (46464) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xB590 (46480) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xD628, 0xEEEA, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xB5A0 (46496) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xB5B0 (46512) pixels
-0xF70A, 0xF70A, 0xEEC9, 0xCE08, 0x7364, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB5C0 (46528) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB5D0 (46544) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB5E0 (46560) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB5F0 (46576) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB600 (46592) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x5AA3, 0xC5A8, 0xE6A9, 0xF70A,   // 0xB610 (46608) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xB620 (46624) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEF0A, 0xDE49, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xB630 (46640) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xB640 (46656) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xB650 (46672) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xB660 (46688) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xB670 (46704) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xB680 (46720) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xD628, 0xEEEA, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xB690 (46736) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xB6A0 (46752) pixels
-0xF70A, 0xEEC9, 0xCE08, 0x7385, 0x0860, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB6B0 (46768) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB6C0 (46784) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB6D0 (46800) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB6E0 (46816) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB6F0 (46832) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x5AA4, 0xC5A8, 0xE6A9,   // 0xB700 (46848) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xB710 (46864) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEF0A, 0xDE49, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xB720 (46880) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xB730 (46896) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xB740 (46912) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xB750 (46928) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xB760 (46944) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xB770 (46960) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xD628, 0xEEEA, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xB780 (46976) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A,   // 0xB790 (46992) pixels
-0xEEC9, 0xCE08, 0x7B85, 0x0860, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB7A0 (47008) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB7B0 (47024) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB7C0 (47040) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB7D0 (47056) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB7E0 (47072) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x5AA3, 0xC5A8,   // 0xB7F0 (47088) pixels
-0xE6A9, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xB800 (47104) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEF0A, 0xDE69, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xB810 (47120) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xB820 (47136) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xB830 (47152) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xB840 (47168) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xB850 (47184) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xB860 (47200) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xD628, 0xEEEA, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xB870 (47216) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEEC9,   // 0xB880 (47232) pixels
-0xCE08, 0x7385, 0x0860, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB890 (47248) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB8A0 (47264) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB8B0 (47280) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB8C0 (47296) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB8D0 (47312) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x5A83,   // 0xB8E0 (47328) pixels
-0xBD88, 0xE6A9, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xB8F0 (47344) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEF0A, 0xDE69, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xB900 (47360) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xB910 (47376) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xB920 (47392) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xB930 (47408) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xB940 (47424) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xB950 (47440) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xD628, 0xEEEA, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xB960 (47456) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEEC9, 0xCDE8,   // 0xB970 (47472) pixels
-0x7365, 0x0860, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB980 (47488) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB990 (47504) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB9A0 (47520) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB9B0 (47536) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB9C0 (47552) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB9D0 (47568) pixels
-0x4A43, 0xBD67, 0xE6C9, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xB9E0 (47584) pixels
-0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEF0A, 0xDE69, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xB9F0 (47600) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xBA00 (47616) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xBA10 (47632) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xBA20 (47648) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xBA30 (47664) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xBA40 (47680) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xD628, 0xEEEA, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A,   // 0xBA50 (47696) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEEE9, 0xCDE8, 0x6B04,   // 0xBA60 (47712) pixels
-0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xBA70 (47728) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xBA80 (47744) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xBA90 (47760) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xBAA0 (47776) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xBAB0 (47792) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xBAC0 (47808) pixels
-0x0000, 0x4202, 0xB547, 0xE6C9, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xBAD0 (47824) pixels
-0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEF0A, 0xDE69, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xBAE0 (47840) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xBAF0 (47856) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xBB00 (47872) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xBB10 (47888) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xBB20 (47904) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xBB30 (47920) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xD628, 0xEEEA, 0xF70A, 0xEF0A, 0xF70A, 0xF70A,   // 0xBB40 (47936) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEEE9, 0xC5C8, 0x5AC4, 0x0020,   // 0xBB50 (47952) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xBB60 (47968) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xBB70 (47984) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xBB80 (48000) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xBB90 (48016) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xBBA0 (48032) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xBBB0 (48048) pixels
-0x0000, 0x0000, 0x3182, 0xAD07, 0xE6C9, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xBBC0 (48064) pixels
-0xF70A, 0xEF0A, 0xF70A, 0xEF0A, 0xDE69, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xBBD0 (48080) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xBBE0 (48096) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xBBF0 (48112) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xBC00 (48128) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xBC10 (48144) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xBC20 (48160) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xD628, 0xEEEA, 0xF70A, 0xEF0A, 0xF70A,   // 0xBC30 (48176) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEEEA, 0xBDA8, 0x4A43, 0x0020, 0x0000,   // 0xBC40 (48192) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xBC50 (48208) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xBC60 (48224) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xBC70 (48240) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xBC80 (48256) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xBC90 (48272) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xBCA0 (48288) pixels
-0x0000, 0x0000, 0x0000, 0x2121, 0x9C86, 0xE6C9, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A,   // 0xBCB0 (48304) pixels
-0xEF0A, 0xF70A, 0xEF0A, 0xDE69, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xBCC0 (48320) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xBCD0 (48336) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xBCE0 (48352) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xBCF0 (48368) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xBD00 (48384) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xBD10 (48400) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xD629, 0xEEEA, 0xF70A, 0xEF0A,   // 0xBD20 (48416) pixels
-0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEEEA, 0xB547, 0x39C2, 0x0000, 0x0000, 0x0000,   // 0xBD30 (48432) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xBD40 (48448) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xBD50 (48464) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xBD60 (48480) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xBD70 (48496) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xBD80 (48512) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xBD90 (48528) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x18A1, 0x83E5, 0xE6A9, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A,   // 0xBDA0 (48544) pixels
-0xF70A, 0xEF0A, 0xDE69, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xBDB0 (48560) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xBDC0 (48576) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xBDD0 (48592) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xBDE0 (48608) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xBDF0 (48624) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xBE00 (48640) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xD628, 0xEEEA, 0xF70A,   // 0xBE10 (48656) pixels
-0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xEEEA, 0xA4C6, 0x2921, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xBE20 (48672) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xBE30 (48688) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xBE40 (48704) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xBE50 (48720) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xBE60 (48736) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xBE70 (48752) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xBE80 (48768) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0860, 0x6B24, 0xDE69, 0xF72A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A,   // 0xBE90 (48784) pixels
-0xEF0A, 0xDE69, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xBEA0 (48800) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xBEB0 (48816) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xBEC0 (48832) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xBED0 (48848) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xBEE0 (48864) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xBEF0 (48880) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xD628, 0xEEEA,   // 0xBF00 (48896) pixels
-0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xF70A, 0xF70A, 0xEF0A, 0xF70A, 0xE6C9, 0x8C05, 0x18C1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xBF10 (48912) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xBF20 (48928) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xBF30 (48944) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xBF40 (48960) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xBF50 (48976) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xBF60 (48992) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xBF70 (49008) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4A43, 0xCE08, 0xF72A, 0xF70A, 0xEF0A, 0xF70A, 0xEF0A, 0xF70A, 0xEF0A,   // 0xBF80 (49024) pixels
-0xDE69, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xBF90 (49040) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xBFA0 (49056) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xBFB0 (49072) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xBFC0 (49088) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xBFD0 (49104) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xBFE0 (49120) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xD629,   // 0xBFF0 (49136) pixels
-0xEEEA, 0xF70A, 0xEF0A, 0xF70A, 0xF70A, 0xEF0A, 0xF72A, 0xDE89, 0x6B24, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC000 (49152) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC010 (49168) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC020 (49184) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC030 (49200) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC040 (49216) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC050 (49232) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC060 (49248) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3162, 0xB567, 0xF72A, 0xF70A, 0xEF0A, 0xF70A, 0xEF0A, 0xDE69,   // 0xC070 (49264) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xC080 (49280) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xC090 (49296) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xC0A0 (49312) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xC0B0 (49328) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xC0C0 (49344) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xC0D0 (49360) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xC0E0 (49376) pixels
-0xD629, 0xEEEA, 0xF70A, 0xEF0A, 0xF70A, 0xF72A, 0xCE08, 0x4A23, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC0F0 (49392) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC100 (49408) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC110 (49424) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC120 (49440) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC130 (49456) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC140 (49472) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC150 (49488) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2101, 0xAD07, 0xEF0A, 0xF70A, 0xEF0A, 0xDE69, 0xC5A8,   // 0xC160 (49504) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xC170 (49520) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xC180 (49536) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xC190 (49552) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xC1A0 (49568) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xC1B0 (49584) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xC1C0 (49600) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xC1D0 (49616) pixels
-0xC5A8, 0xD629, 0xEEEA, 0xF70A, 0xF70A, 0xC5C8, 0x39A2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC1E0 (49632) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC1F0 (49648) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC200 (49664) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC210 (49680) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC220 (49696) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC230 (49712) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC240 (49728) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18C1, 0x9CA6, 0xE6A9, 0xDE69, 0xC5A8, 0xC5A8,   // 0xC250 (49744) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xC260 (49760) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xC270 (49776) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xC280 (49792) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xC290 (49808) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xC2A0 (49824) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xC2B0 (49840) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xC2C0 (49856) pixels
-0xC5A8, 0xC5A8, 0xD629, 0xE6C9, 0xB567, 0x3162, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC2D0 (49872) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC2E0 (49888) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC2F0 (49904) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC300 (49920) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC310 (49936) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC320 (49952) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC330 (49968) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1080, 0x41E2, 0x7BA5, 0xBD87, 0xC5A8,   // 0xC340 (49984) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xC350 (50000) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xC360 (50016) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xC370 (50032) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xC380 (50048) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xC390 (50064) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xC3A0 (50080) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xC3B0 (50096) pixels
-0xC5A8, 0xC5A8, 0x8C26, 0x4A23, 0x18E1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC3C0 (50112) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC3D0 (50128) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC3E0 (50144) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC3F0 (50160) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC400 (50176) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC410 (50192) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC420 (50208) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4203, 0xA4A6,   // 0xC430 (50224) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xC440 (50240) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xC450 (50256) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xC460 (50272) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xC470 (50288) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xC480 (50304) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xC490 (50320) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8,   // 0xC4A0 (50336) pixels
-0xAD27, 0x5AA4, 0x0860, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC4B0 (50352) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC4C0 (50368) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC4D0 (50384) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC4E0 (50400) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC4F0 (50416) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC500 (50432) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC510 (50448) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18C1,   // 0xC520 (50464) pixels
-0x7344, 0xB547, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xC530 (50480) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xC540 (50496) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xC550 (50512) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xC560 (50528) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xC570 (50544) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xC580 (50560) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xBD88, 0x83E5,   // 0xC590 (50576) pixels
-0x2941, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC5A0 (50592) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC5B0 (50608) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC5C0 (50624) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC5D0 (50640) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC5E0 (50656) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC5F0 (50672) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC600 (50688) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC610 (50704) pixels
-0x0020, 0x3182, 0x8C26, 0xBDA8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xC620 (50720) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xC630 (50736) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xC640 (50752) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xC650 (50768) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xC660 (50784) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xC670 (50800) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0x9CA6, 0x4A23, 0x0840,   // 0xC680 (50816) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC690 (50832) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC6A0 (50848) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC6B0 (50864) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC6C0 (50880) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC6D0 (50896) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC6E0 (50912) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC6F0 (50928) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC700 (50944) pixels
-0x0000, 0x0000, 0x0860, 0x5263, 0xA4C6, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xC710 (50960) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xC720 (50976) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xC730 (50992) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xC740 (51008) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xC750 (51024) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xC760 (51040) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8, 0xAD27, 0x6304, 0x18A1, 0x0000, 0x0000,   // 0xC770 (51056) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC780 (51072) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC790 (51088) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC7A0 (51104) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC7B0 (51120) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC7C0 (51136) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC7D0 (51152) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC7E0 (51168) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC7F0 (51184) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x18C1, 0x6304, 0xAD07, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xC800 (51200) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xC810 (51216) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xC820 (51232) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xC830 (51248) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xC840 (51264) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xC850 (51280) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8, 0xB547, 0x7B85, 0x2921, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC860 (51296) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC870 (51312) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC880 (51328) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC890 (51344) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC8A0 (51360) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC8B0 (51376) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC8C0 (51392) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC8D0 (51408) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC8E0 (51424) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2101, 0x7344, 0xAD27, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xC8F0 (51440) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xC900 (51456) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xC910 (51472) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xC920 (51488) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xC930 (51504) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xC940 (51520) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8, 0xB567, 0x83C5, 0x3182, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC950 (51536) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC960 (51552) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC970 (51568) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC980 (51584) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC990 (51600) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC9A0 (51616) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC9B0 (51632) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC9C0 (51648) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC9D0 (51664) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2121, 0x7364, 0xAD27, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xC9E0 (51680) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xC9F0 (51696) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xCA00 (51712) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xCA10 (51728) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xCA20 (51744) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xCA30 (51760) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8, 0xB567, 0x83E5, 0x3182, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xCA40 (51776) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xCA50 (51792) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xCA60 (51808) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xCA70 (51824) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xCA80 (51840) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xCA90 (51856) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xCAA0 (51872) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xCAB0 (51888) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xCAC0 (51904) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2121, 0x6B24, 0xAD07, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xCAD0 (51920) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xCAE0 (51936) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xCAF0 (51952) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xCB00 (51968) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xCB10 (51984) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xCB20 (52000) pixels
-0xC5A8, 0xC5A8, 0xC5C8, 0xB547, 0x7BA5, 0x3182, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xCB30 (52016) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xCB40 (52032) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xCB50 (52048) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xCB60 (52064) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xCB70 (52080) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xCB80 (52096) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xCB90 (52112) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xCBA0 (52128) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xCBB0 (52144) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18E1, 0x5AC4, 0x9CA6, 0xBD88,   // 0xCBC0 (52160) pixels
-0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xCBD0 (52176) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xCBE0 (52192) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xCBF0 (52208) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xCC00 (52224) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8,   // 0xCC10 (52240) pixels
-0xC5A8, 0xACE7, 0x6B24, 0x2941, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xCC20 (52256) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xCC30 (52272) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xCC40 (52288) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xCC50 (52304) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xCC60 (52320) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xCC70 (52336) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xCC80 (52352) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xCC90 (52368) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xCCA0 (52384) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1080, 0x4203,   // 0xCCB0 (52400) pixels
-0x8C05, 0xB547, 0xC5C8, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xCCC0 (52416) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xCCD0 (52432) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xCCE0 (52448) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xCCF0 (52464) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8, 0xBD67, 0x9466,   // 0xCD00 (52480) pixels
-0x5283, 0x18C1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xCD10 (52496) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xCD20 (52512) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xCD30 (52528) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xCD40 (52544) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xCD50 (52560) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xCD60 (52576) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xCD70 (52592) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xCD80 (52608) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xCD90 (52624) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xCDA0 (52640) pixels
-0x0020, 0x2941, 0x6B04, 0x9CA6, 0xBD88, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xCDB0 (52656) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xCDC0 (52672) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xCDD0 (52688) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xCDE0 (52704) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8, 0xBDA8, 0xA4E7, 0x7365, 0x39A2, 0x0860,   // 0xCDF0 (52720) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xCE00 (52736) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xCE10 (52752) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xCE20 (52768) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xCE30 (52784) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xCE40 (52800) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xCE50 (52816) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xCE60 (52832) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xCE70 (52848) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xCE80 (52864) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xCE90 (52880) pixels
-0x0000, 0x0000, 0x0000, 0x1080, 0x39C2, 0x7B85, 0xA4C7, 0xBD88, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xCEA0 (52896) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xCEB0 (52912) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xCEC0 (52928) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xCED0 (52944) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8, 0xC5A8, 0xAD07, 0x83E5, 0x4A23, 0x18C1, 0x0000, 0x0000, 0x0000,   // 0xCEE0 (52960) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xCEF0 (52976) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xCF00 (52992) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xCF10 (53008) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xCF20 (53024) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xCF30 (53040) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xCF40 (53056) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xCF50 (53072) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xCF60 (53088) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xCF70 (53104) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xCF80 (53120) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A1, 0x41E2, 0x7365, 0x9CA6, 0xBD67, 0xC5A8, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xCF90 (53136) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xCFA0 (53152) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xCFB0 (53168) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xCFC0 (53184) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8, 0xC5C8, 0xBD88, 0xA4E7, 0x83C5, 0x4A43, 0x18E1, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xCFD0 (53200) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xCFE0 (53216) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xCFF0 (53232) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD000 (53248) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD010 (53264) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD020 (53280) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD030 (53296) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD040 (53312) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD050 (53328) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD060 (53344) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD070 (53360) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1080, 0x3182, 0x62E4, 0x9446, 0xAD27, 0xBD88, 0xC5C8,   // 0xD080 (53376) pixels
-0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xD090 (53392) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xD0A0 (53408) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8,   // 0xD0B0 (53424) pixels
-0xC5C8, 0xC5A8, 0xB547, 0x9C86, 0x6B44, 0x39E2, 0x18A1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD0C0 (53440) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD0D0 (53456) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD0E0 (53472) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD0F0 (53488) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD100 (53504) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD110 (53520) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD120 (53536) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD130 (53552) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD140 (53568) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD150 (53584) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD160 (53600) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x18E1, 0x41E2, 0x6B24,   // 0xD170 (53616) pixels
-0x8C26, 0xAD07, 0xBD88, 0xC5A8, 0xC5C8, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xD180 (53632) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xD190 (53648) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8, 0xC5C8, 0xC5A8, 0xBD88, 0xB527, 0x9466,   // 0xD1A0 (53664) pixels
-0x7364, 0x4A23, 0x2101, 0x0860, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD1B0 (53680) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD1C0 (53696) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD1D0 (53712) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD1E0 (53728) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD1F0 (53744) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD200 (53760) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD210 (53776) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD220 (53792) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD230 (53808) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD240 (53824) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD250 (53840) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD260 (53856) pixels
-0x0820, 0x18C1, 0x3182, 0x5283, 0x7365, 0x9446, 0xA4E7, 0xB567, 0xBD88, 0xC5A8, 0xC5C8, 0xC5C8, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xD270 (53872) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8,   // 0xD280 (53888) pixels
-0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8, 0xC5C8, 0xC5C8, 0xC5A8, 0xBDA8, 0xBD67, 0xAD07, 0x9466, 0x7BA5, 0x5AC4, 0x39C2, 0x2101, 0x0840,   // 0xD290 (53904) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD2A0 (53920) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD2B0 (53936) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD2C0 (53952) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD2D0 (53968) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD2E0 (53984) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD2F0 (54000) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD300 (54016) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD310 (54032) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD320 (54048) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD330 (54064) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD340 (54080) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD350 (54096) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x18A1, 0x2941, 0x39E2, 0x5283, 0x6B24, 0x83C5, 0x9446, 0xA4A6, 0xAD07, 0xB547,   // 0xD360 (54112) pixels
-0xBD67, 0xBD88, 0xBDA8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5C8, 0xC5A8, 0xC5A8, 0xC5A8, 0xC5A8, 0xBDA8, 0xBD88, 0xBD67,   // 0xD370 (54128) pixels
-0xB547, 0xAD07, 0xA4C7, 0x9466, 0x83E5, 0x7364, 0x5AA3, 0x4202, 0x3162, 0x18C1, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD380 (54144) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD390 (54160) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD3A0 (54176) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD3B0 (54192) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD3C0 (54208) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD3D0 (54224) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD3E0 (54240) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD3F0 (54256) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD400 (54272) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD410 (54288) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD420 (54304) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD430 (54320) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD440 (54336) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x1080, 0x18C1, 0x2101,   // 0xD450 (54352) pixels
-0x2962, 0x39A2, 0x4202, 0x4A43, 0x5263, 0x5283, 0x5AA3, 0x5AA3, 0x5AA3, 0x5AA3, 0x5283, 0x5263, 0x4A43, 0x4203, 0x39C2, 0x3162,   // 0xD460 (54368) pixels
-0x2921, 0x18C1, 0x1080, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD470 (54384) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD480 (54400) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD490 (54416) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD4A0 (54432) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD4B0 (54448) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD4C0 (54464) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD4D0 (54480) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD4E0 (54496) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD4F0 (54512) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD500 (54528) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD510 (54544) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD520 (54560) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD530 (54576) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD540 (54592) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD550 (54608) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD560 (54624) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD570 (54640) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD580 (54656) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD590 (54672) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD5A0 (54688) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD5B0 (54704) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD5C0 (54720) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD5D0 (54736) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD5E0 (54752) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD5F0 (54768) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD600 (54784) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD610 (54800) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD620 (54816) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD630 (54832) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD640 (54848) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD650 (54864) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD660 (54880) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD670 (54896) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD680 (54912) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD690 (54928) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD6A0 (54944) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD6B0 (54960) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD6C0 (54976) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD6D0 (54992) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD6E0 (55008) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD6F0 (55024) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD700 (55040) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD710 (55056) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD720 (55072) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD730 (55088) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD740 (55104) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD750 (55120) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD760 (55136) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD770 (55152) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD780 (55168) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD790 (55184) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD7A0 (55200) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD7B0 (55216) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD7C0 (55232) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD7D0 (55248) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD7E0 (55264) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD7F0 (55280) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD800 (55296) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD810 (55312) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD820 (55328) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD830 (55344) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD840 (55360) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD850 (55376) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD860 (55392) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD870 (55408) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD880 (55424) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD890 (55440) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD8A0 (55456) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD8B0 (55472) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD8C0 (55488) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD8D0 (55504) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD8E0 (55520) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD8F0 (55536) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD900 (55552) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD910 (55568) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD920 (55584) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD930 (55600) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD940 (55616) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD950 (55632) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD960 (55648) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD970 (55664) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD980 (55680) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD990 (55696) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD9A0 (55712) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD9B0 (55728) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD9C0 (55744) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD9D0 (55760) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD9E0 (55776) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD9F0 (55792) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDA00 (55808) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDA10 (55824) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDA20 (55840) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDA30 (55856) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDA40 (55872) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDA50 (55888) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDA60 (55904) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDA70 (55920) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDA80 (55936) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDA90 (55952) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDAA0 (55968) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDAB0 (55984) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDAC0 (56000) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDAD0 (56016) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDAE0 (56032) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDAF0 (56048) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDB00 (56064) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDB10 (56080) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDB20 (56096) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDB30 (56112) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDB40 (56128) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDB50 (56144) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDB60 (56160) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDB70 (56176) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDB80 (56192) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDB90 (56208) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDBA0 (56224) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDBB0 (56240) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDBC0 (56256) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDBD0 (56272) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDBE0 (56288) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDBF0 (56304) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDC00 (56320) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDC10 (56336) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDC20 (56352) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDC30 (56368) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDC40 (56384) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDC50 (56400) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDC60 (56416) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDC70 (56432) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDC80 (56448) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDC90 (56464) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDCA0 (56480) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDCB0 (56496) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDCC0 (56512) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDCD0 (56528) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDCE0 (56544) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDCF0 (56560) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDD00 (56576) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDD10 (56592) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDD20 (56608) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDD30 (56624) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDD40 (56640) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDD50 (56656) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDD60 (56672) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDD70 (56688) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDD80 (56704) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDD90 (56720) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDDA0 (56736) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDDB0 (56752) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDDC0 (56768) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDDD0 (56784) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDDE0 (56800) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDDF0 (56816) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDE00 (56832) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDE10 (56848) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDE20 (56864) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDE30 (56880) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDE40 (56896) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDE50 (56912) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDE60 (56928) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDE70 (56944) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDE80 (56960) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDE90 (56976) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDEA0 (56992) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDEB0 (57008) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDEC0 (57024) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDED0 (57040) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDEE0 (57056) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDEF0 (57072) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDF00 (57088) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDF10 (57104) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDF20 (57120) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDF30 (57136) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDF40 (57152) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDF50 (57168) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDF60 (57184) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDF70 (57200) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDF80 (57216) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDF90 (57232) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDFA0 (57248) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDFB0 (57264) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDFC0 (57280) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDFD0 (57296) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDFE0 (57312) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xDFF0 (57328) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xE000 (57344) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xE010 (57360) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xE020 (57376) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xE030 (57392) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xE040 (57408) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xE050 (57424) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xE060 (57440) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xE070 (57456) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xE080 (57472) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xE090 (57488) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xE0A0 (57504) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xE0B0 (57520) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xE0C0 (57536) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xE0D0 (57552) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xE0E0 (57568) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xE0F0 (57584) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xE100 (57600) pixels
+#include <Arduino.h>
+
+static constexpr uint16_t entangled_palette[] PROGMEM = {
+  0x0000, 0x000D, 0x001A, 0x0020,
+};
+
+static constexpr uint8_t entangled_data[] PROGMEM = {
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3D, 0x53, 0x01, 0x3F, 0x3F, 0x3F, 0x14,
+  0x43, 0x01, 0x59, 0x02, 0x43, 0x01, 0x3F, 0x3F, 0x3F, 0x08, 0x42, 0x01, 0x66, 0x02, 0x42, 0x01,
+  0x3F, 0x3F, 0x3D, 0x42, 0x01, 0x6F, 0x02, 0x42, 0x01, 0x3F, 0x3F, 0x36, 0x41, 0x01, 0x77, 0x02,
+  0x41, 0x01, 0x3F, 0x3F, 0x30, 0x41, 0x01, 0x7E, 0x02, 0x41, 0x01, 0x3F, 0x3F, 0x29, 0x41, 0x01,
+  0x7F, 0x02, 0x44, 0x02, 0x80, 0x01, 0x3F, 0x3F, 0x24, 0x41, 0x01, 0x7F, 0x02, 0x49, 0x02, 0x41,
+  0x01, 0x3F, 0x3F, 0x1F, 0x80, 0x01, 0x7F, 0x02, 0x4F, 0x02, 0x80, 0x01, 0x3F, 0x3F, 0x1A, 0x41,
+  0x01, 0x7F, 0x02, 0x53, 0x02, 0x41, 0x01, 0x3F, 0x3F, 0x15, 0x41, 0x01, 0x7F, 0x02, 0x58, 0x02,
+  0x80, 0x01, 0x3F, 0x3F, 0x11, 0x41, 0x01, 0x7F, 0x02, 0x5C, 0x02, 0x80, 0x01, 0x3F, 0x3F, 0x0D,
+  0x41, 0x01, 0x7F, 0x02, 0x60, 0x02, 0x80, 0x01, 0x3F, 0x3F, 0x0A, 0x80, 0x01, 0x7F, 0x02, 0x63,
+  0x02, 0x41, 0x01, 0x3F, 0x3F, 0x06, 0x80, 0x01, 0x7F, 0x02, 0x67, 0x02, 0x80, 0x01, 0x3F, 0x3F,
+  0x03, 0x80, 0x01, 0x7F, 0x02, 0x6B, 0x02, 0x80, 0x01, 0x3F, 0x3F, 0x00, 0x80, 0x01, 0x7F, 0x02,
+  0x6E, 0x02, 0x80, 0x01, 0x3F, 0x3C, 0x80, 0x01, 0x7F, 0x02, 0x71, 0x02, 0x80, 0x01, 0x3F, 0x39,
+  0x80, 0x01, 0x7F, 0x02, 0x75, 0x02, 0x41, 0x01, 0x3F, 0x35, 0x80, 0x02, 0x41, 0x03, 0x7F, 0x02,
+  0x74, 0x02, 0x82, 0x03, 0x02, 0x01, 0x3F, 0x32, 0x81, 0x01, 0x02, 0x42, 0x03, 0x7F, 0x02, 0x73,
+  0x02, 0x42, 0x03, 0x81, 0x02, 0x01, 0x3F, 0x30, 0x81, 0x01, 0x02, 0x44, 0x03, 0x7F, 0x02, 0x71,
+  0x02, 0x45, 0x03, 0x80, 0x01, 0x3F, 0x2E, 0x80, 0x01, 0x47, 0x03, 0x7F, 0x02, 0x6F, 0x02, 0x47,
+  0x03, 0x80, 0x01, 0x3F, 0x2C, 0x80, 0x01, 0x49, 0x03, 0x7F, 0x02, 0x6D, 0x02, 0x49, 0x03, 0x80,
+  0x02, 0x3F, 0x2A, 0x80, 0x02, 0x4B, 0x03, 0x7F, 0x02, 0x6B, 0x02, 0x4B, 0x03, 0x81, 0x02, 0x01,
+  0x3F, 0x26, 0x81, 0x01, 0x02, 0x4D, 0x03, 0x7F, 0x02, 0x69, 0x02, 0x4D, 0x03, 0x81, 0x02, 0x01,
+  0x3F, 0x24, 0x81, 0x01, 0x02, 0x4F, 0x03, 0x7F, 0x02, 0x67, 0x02, 0x4F, 0x03, 0x81, 0x02, 0x01,
+  0x3F, 0x22, 0x81, 0x01, 0x02, 0x51, 0x03, 0x7F, 0x02, 0x65, 0x02, 0x51, 0x03, 0x81, 0x02, 0x01,
+  0x3F, 0x20, 0x81, 0x01, 0x02, 0x53, 0x03, 0x7F, 0x02, 0x63, 0x02, 0x53, 0x03, 0x81, 0x02, 0x01,
+  0x3F, 0x1E, 0x81, 0x01, 0x02, 0x55, 0x03, 0x7F, 0x02, 0x61, 0x02, 0x55, 0x03, 0x81, 0x02, 0x01,
+  0x3F, 0x1C, 0x81, 0x01, 0x02, 0x57, 0x03, 0x7F, 0x02, 0x5F, 0x02, 0x57, 0x03, 0x81, 0x02, 0x01,
+  0x3F, 0x1A, 0x81, 0x01, 0x02, 0x59, 0x03, 0x7F, 0x02, 0x5D, 0x02, 0x59, 0x03, 0x81, 0x02, 0x01,
+  0x3F, 0x18, 0x81, 0x01, 0x02, 0x5B, 0x03, 0x7F, 0x02, 0x5B, 0x02, 0x5B, 0x03, 0x81, 0x02, 0x01,
+  0x3F, 0x16, 0x81, 0x01, 0x02, 0x5D, 0x03, 0x7F, 0x02, 0x59, 0x02, 0x5D, 0x03, 0x81, 0x02, 0x01,
+  0x3F, 0x14, 0x81, 0x01, 0x02, 0x5F, 0x03, 0x7F, 0x02, 0x57, 0x02, 0x5F, 0x03, 0x81, 0x02, 0x01,
+  0x3F, 0x12, 0x81, 0x01, 0x02, 0x61, 0x03, 0x7F, 0x02, 0x55, 0x02, 0x61, 0x03, 0x81, 0x02, 0x01,
+  0x3F, 0x10, 0x81, 0x01, 0x02, 0x63, 0x03, 0x61, 0x02, 0x4F, 0x01, 0x61, 0x02, 0x63, 0x03, 0x81,
+  0x02, 0x01, 0x3F, 0x0E, 0x81, 0x01, 0x02, 0x65, 0x03, 0x5A, 0x02, 0x42, 0x01, 0x15, 0x42, 0x01,
+  0x5A, 0x02, 0x65, 0x03, 0x81, 0x02, 0x01, 0x3F, 0x0D, 0x80, 0x02, 0x67, 0x03, 0x55, 0x02, 0x41,
+  0x01, 0x1F, 0x42, 0x01, 0x54, 0x02, 0x67, 0x03, 0x81, 0x02, 0x01, 0x3F, 0x0B, 0x80, 0x02, 0x69,
+  0x03, 0x50, 0x02, 0x41, 0x01, 0x27, 0x41, 0x01, 0x50, 0x02, 0x69, 0x03, 0x80, 0x02, 0x3F, 0x0A,
+  0x80, 0x01, 0x6B, 0x03, 0x4C, 0x02, 0x41, 0x01, 0x2D, 0x41, 0x01, 0x4C, 0x02, 0x6B, 0x03, 0x80,
+  0x02, 0x3F, 0x08, 0x80, 0x01, 0x6D, 0x03, 0x49, 0x02, 0x80, 0x01, 0x33, 0x80, 0x01, 0x49, 0x02,
+  0x6D, 0x03, 0x80, 0x01, 0x3F, 0x06, 0x81, 0x01, 0x02, 0x6E, 0x03, 0x46, 0x02, 0x80, 0x01, 0x37,
+  0x80, 0x01, 0x46, 0x02, 0x6F, 0x03, 0x80, 0x01, 0x3F, 0x05, 0x80, 0x02, 0x70, 0x03, 0x43, 0x02,
+  0x80, 0x01, 0x3B, 0x41, 0x01, 0x42, 0x02, 0x70, 0x03, 0x81, 0x02, 0x01, 0x3F, 0x03, 0x80, 0x02,
+  0x72, 0x03, 0x81, 0x02, 0x01, 0x3F, 0x81, 0x01, 0x02, 0x72, 0x03, 0x81, 0x02, 0x01, 0x3F, 0x01,
+  0x80, 0x02, 0x72, 0x03, 0x41, 0x02, 0x80, 0x01, 0x3F, 0x80, 0x01, 0x41, 0x02, 0x72, 0x03, 0x80,
+  0x02, 0x3F, 0x01, 0x80, 0x02, 0x71, 0x03, 0x43, 0x02, 0x80, 0x01, 0x3D, 0x80, 0x01, 0x44, 0x02,
+  0x71, 0x03, 0x80, 0x01, 0x3F, 0x81, 0x01, 0x02, 0x6F, 0x03, 0x46, 0x02, 0x80, 0x01, 0x3B, 0x80,
+  0x01, 0x46, 0x02, 0x6F, 0x03, 0x41, 0x02, 0x3E, 0x80, 0x01, 0x42, 0x02, 0x6D, 0x03, 0x48, 0x02,
+  0x80, 0x01, 0x39, 0x80, 0x01, 0x49, 0x02, 0x6C, 0x03, 0x42, 0x02, 0x80, 0x01, 0x3D, 0x44, 0x02,
+  0x6A, 0x03, 0x4B, 0x02, 0x80, 0x01, 0x37, 0x80, 0x01, 0x4B, 0x02, 0x6A, 0x03, 0x44, 0x02, 0x80,
+  0x01, 0x3B, 0x80, 0x01, 0x45, 0x02, 0x68, 0x03, 0x4D, 0x02, 0x80, 0x01, 0x35, 0x80, 0x01, 0x4D,
+  0x02, 0x68, 0x03, 0x45, 0x02, 0x80, 0x01, 0x3A, 0x80, 0x01, 0x47, 0x02, 0x66, 0x03, 0x4F, 0x02,
+  0x80, 0x01, 0x33, 0x80, 0x01, 0x50, 0x02, 0x65, 0x03, 0x47, 0x02, 0x80, 0x01, 0x39, 0x80, 0x01,
+  0x48, 0x02, 0x63, 0x03, 0x52, 0x02, 0x80, 0x01, 0x31, 0x80, 0x01, 0x52, 0x02, 0x63, 0x03, 0x49,
+  0x02, 0x38, 0x80, 0x01, 0x4A, 0x02, 0x61, 0x03, 0x54, 0x02, 0x80, 0x01, 0x2F, 0x80, 0x01, 0x54,
+  0x02, 0x61, 0x03, 0x4A, 0x02, 0x80, 0x01, 0x37, 0x4C, 0x02, 0x5F, 0x03, 0x56, 0x02, 0x80, 0x01,
+  0x2D, 0x80, 0x01, 0x56, 0x02, 0x5F, 0x03, 0x4C, 0x02, 0x80, 0x01, 0x35, 0x80, 0x01, 0x4D, 0x02,
+  0x5D, 0x03, 0x58, 0x02, 0x80, 0x01, 0x2B, 0x80, 0x01, 0x58, 0x02, 0x5D, 0x03, 0x4D, 0x02, 0x80,
+  0x01, 0x35, 0x4F, 0x02, 0x5B, 0x03, 0x5A, 0x02, 0x80, 0x01, 0x29, 0x80, 0x01, 0x5A, 0x02, 0x5B,
+  0x03, 0x4F, 0x02, 0x80, 0x01, 0x33, 0x80, 0x01, 0x50, 0x02, 0x59, 0x03, 0x5C, 0x02, 0x80, 0x01,
+  0x27, 0x80, 0x01, 0x5C, 0x02, 0x59, 0x03, 0x50, 0x02, 0x80, 0x01, 0x33, 0x52, 0x02, 0x57, 0x03,
+  0x5E, 0x02, 0x80, 0x01, 0x25, 0x80, 0x01, 0x5E, 0x02, 0x57, 0x03, 0x52, 0x02, 0x80, 0x01, 0x31,
+  0x80, 0x01, 0x53, 0x02, 0x55, 0x03, 0x60, 0x02, 0x80, 0x01, 0x23, 0x80, 0x01, 0x60, 0x02, 0x55,
+  0x03, 0x53, 0x02, 0x80, 0x01, 0x31, 0x55, 0x02, 0x53, 0x03, 0x62, 0x02, 0x80, 0x01, 0x21, 0x80,
+  0x01, 0x62, 0x02, 0x53, 0x03, 0x55, 0x02, 0x80, 0x01, 0x2F, 0x80, 0x01, 0x56, 0x02, 0x51, 0x03,
+  0x64, 0x02, 0x80, 0x01, 0x1F, 0x80, 0x01, 0x64, 0x02, 0x51, 0x03, 0x56, 0x02, 0x80, 0x01, 0x2F,
+  0x58, 0x02, 0x50, 0x03, 0x65, 0x02, 0x80, 0x01, 0x1D, 0x80, 0x01, 0x66, 0x02, 0x4F, 0x03, 0x58,
+  0x02, 0x80, 0x01, 0x2D, 0x80, 0x01, 0x59, 0x02, 0x4E, 0x03, 0x67, 0x02, 0x80, 0x01, 0x1B, 0x80,
+  0x01, 0x67, 0x02, 0x4E, 0x03, 0x59, 0x02, 0x80, 0x01, 0x2D, 0x5B, 0x02, 0x4C, 0x03, 0x69, 0x02,
+  0x80, 0x01, 0x19, 0x80, 0x01, 0x69, 0x02, 0x4C, 0x03, 0x5B, 0x02, 0x2C, 0x80, 0x01, 0x5C, 0x02,
+  0x4A, 0x03, 0x6B, 0x02, 0x80, 0x01, 0x17, 0x80, 0x01, 0x6B, 0x02, 0x4A, 0x03, 0x5C, 0x02, 0x80,
+  0x01, 0x2B, 0x80, 0x01, 0x5D, 0x02, 0x49, 0x03, 0x6C, 0x02, 0x80, 0x01, 0x15, 0x80, 0x01, 0x6D,
+  0x02, 0x48, 0x03, 0x5E, 0x02, 0x2B, 0x5F, 0x02, 0x47, 0x03, 0x6E, 0x02, 0x80, 0x01, 0x13, 0x80,
+  0x01, 0x6E, 0x02, 0x47, 0x03, 0x5F, 0x02, 0x80, 0x01, 0x29, 0x80, 0x01, 0x60, 0x02, 0x45, 0x03,
+  0x70, 0x02, 0x80, 0x01, 0x11, 0x80, 0x01, 0x70, 0x02, 0x45, 0x03, 0x60, 0x02, 0x80, 0x01, 0x29,
+  0x62, 0x02, 0x44, 0x03, 0x71, 0x02, 0x80, 0x01, 0x0F, 0x80, 0x01, 0x71, 0x02, 0x44, 0x03, 0x62,
+  0x02, 0x28, 0x80, 0x01, 0x63, 0x02, 0x42, 0x03, 0x73, 0x02, 0x80, 0x01, 0x0D, 0x80, 0x01, 0x73,
+  0x02, 0x42, 0x03, 0x63, 0x02, 0x80, 0x01, 0x27, 0x80, 0x01, 0x64, 0x02, 0x41, 0x03, 0x74, 0x02,
+  0x80, 0x01, 0x0B, 0x80, 0x01, 0x75, 0x02, 0x80, 0x03, 0x64, 0x02, 0x80, 0x01, 0x27, 0x7F, 0x02,
+  0x5D, 0x02, 0x80, 0x01, 0x09, 0x80, 0x01, 0x7F, 0x02, 0x5D, 0x02, 0x26, 0x80, 0x01, 0x65, 0x02,
+  0x80, 0x01, 0x00, 0x76, 0x02, 0x80, 0x01, 0x07, 0x80, 0x01, 0x76, 0x02, 0x41, 0x01, 0x65, 0x02,
+  0x80, 0x01, 0x25, 0x80, 0x01, 0x65, 0x02, 0x02, 0x76, 0x02, 0x80, 0x01, 0x05, 0x80, 0x01, 0x76,
+  0x02, 0x80, 0x01, 0x01, 0x65, 0x02, 0x80, 0x01, 0x25, 0x65, 0x02, 0x80, 0x01, 0x03, 0x76, 0x02,
+  0x80, 0x01, 0x03, 0x80, 0x01, 0x76, 0x02, 0x80, 0x01, 0x02, 0x80, 0x01, 0x65, 0x02, 0x25, 0x65,
+  0x02, 0x05, 0x76, 0x02, 0x80, 0x01, 0x01, 0x80, 0x01, 0x76, 0x02, 0x80, 0x01, 0x04, 0x65, 0x02,
+  0x80, 0x01, 0x23, 0x80, 0x01, 0x64, 0x02, 0x80, 0x01, 0x06, 0x76, 0x02, 0x41, 0x01, 0x76, 0x02,
+  0x80, 0x01, 0x05, 0x80, 0x01, 0x64, 0x02, 0x80, 0x01, 0x23, 0x80, 0x01, 0x64, 0x02, 0x80, 0x01,
+  0x07, 0x7F, 0x02, 0x6D, 0x02, 0x80, 0x01, 0x07, 0x65, 0x02, 0x23, 0x64, 0x02, 0x80, 0x01, 0x09,
+  0x7F, 0x02, 0x6B, 0x02, 0x80, 0x01, 0x08, 0x80, 0x01, 0x64, 0x02, 0x23, 0x64, 0x02, 0x80, 0x01,
+  0x0A, 0x7F, 0x02, 0x69, 0x02, 0x80, 0x01, 0x09, 0x80, 0x01, 0x64, 0x02, 0x80, 0x01, 0x21, 0x80,
+  0x01, 0x64, 0x02, 0x0C, 0x7F, 0x02, 0x67, 0x02, 0x80, 0x01, 0x0B, 0x80, 0x01, 0x63, 0x02, 0x80,
+  0x01, 0x21, 0x80, 0x01, 0x63, 0x02, 0x80, 0x01, 0x0D, 0x7F, 0x02, 0x65, 0x02, 0x80, 0x01, 0x0C,
+  0x80, 0x01, 0x64, 0x02, 0x21, 0x64, 0x02, 0x80, 0x01, 0x0E, 0x7F, 0x02, 0x63, 0x02, 0x80, 0x01,
+  0x0E, 0x64, 0x02, 0x21, 0x64, 0x02, 0x10, 0x7F, 0x02, 0x61, 0x02, 0x80, 0x01, 0x0F, 0x80, 0x01,
+  0x63, 0x02, 0x80, 0x01, 0x1F, 0x80, 0x01, 0x63, 0x02, 0x80, 0x01, 0x11, 0x7F, 0x02, 0x5F, 0x02,
+  0x80, 0x01, 0x10, 0x80, 0x01, 0x63, 0x02, 0x80, 0x01, 0x1F, 0x80, 0x01, 0x63, 0x02, 0x80, 0x01,
+  0x12, 0x7F, 0x02, 0x5D, 0x02, 0x80, 0x01, 0x12, 0x63, 0x02, 0x80, 0x01, 0x1F, 0x80, 0x01, 0x63,
+  0x02, 0x14, 0x7F, 0x02, 0x5B, 0x02, 0x80, 0x01, 0x13, 0x64, 0x02, 0x1F, 0x63, 0x02, 0x80, 0x01,
+  0x15, 0x7F, 0x02, 0x59, 0x02, 0x80, 0x01, 0x14, 0x80, 0x01, 0x63, 0x02, 0x1F, 0x63, 0x02, 0x80,
+  0x01, 0x16, 0x7F, 0x02, 0x57, 0x02, 0x80, 0x01, 0x15, 0x80, 0x01, 0x63, 0x02, 0x80, 0x01, 0x1E,
+  0x63, 0x02, 0x80, 0x01, 0x17, 0x7F, 0x02, 0x55, 0x02, 0x80, 0x01, 0x17, 0x63, 0x02, 0x80, 0x01,
+  0x1D, 0x80, 0x01, 0x63, 0x02, 0x19, 0x7F, 0x02, 0x53, 0x02, 0x80, 0x01, 0x18, 0x63, 0x02, 0x80,
+  0x01, 0x1D, 0x80, 0x01, 0x63, 0x02, 0x1A, 0x7F, 0x02, 0x51, 0x02, 0x80, 0x01, 0x19, 0x80, 0x01,
+  0x62, 0x02, 0x80, 0x01, 0x1D, 0x80, 0x01, 0x62, 0x02, 0x80, 0x01, 0x1B, 0x7F, 0x02, 0x4F, 0x02,
+  0x80, 0x01, 0x1A, 0x80, 0x01, 0x62, 0x02, 0x80, 0x01, 0x1D, 0x80, 0x01, 0x62, 0x02, 0x80, 0x01,
+  0x1C, 0x7F, 0x02, 0x4D, 0x02, 0x80, 0x01, 0x1B, 0x80, 0x01, 0x63, 0x02, 0x1D, 0x80, 0x01, 0x62,
+  0x02, 0x80, 0x01, 0x1D, 0x7F, 0x02, 0x4B, 0x02, 0x80, 0x01, 0x1D, 0x63, 0x02, 0x1D, 0x63, 0x02,
+  0x80, 0x01, 0x1E, 0x7F, 0x02, 0x49, 0x02, 0x80, 0x01, 0x1E, 0x63, 0x02, 0x1D, 0x63, 0x02, 0x20,
+  0x7F, 0x02, 0x47, 0x02, 0x80, 0x01, 0x1F, 0x63, 0x02, 0x1D, 0x63, 0x02, 0x21, 0x7F, 0x02, 0x45,
+  0x02, 0x80, 0x01, 0x20, 0x80, 0x01, 0x62, 0x02, 0x80, 0x01, 0x1C, 0x63, 0x02, 0x22, 0x7F, 0x02,
+  0x43, 0x02, 0x80, 0x01, 0x21, 0x80, 0x01, 0x62, 0x02, 0x80, 0x01, 0x1C, 0x62, 0x02, 0x80, 0x01,
+  0x23, 0x7F, 0x02, 0x41, 0x02, 0x80, 0x01, 0x22, 0x80, 0x01, 0x62, 0x02, 0x80, 0x01, 0x1C, 0x62,
+  0x02, 0x80, 0x01, 0x24, 0x7F, 0x02, 0x80, 0x01, 0x23, 0x80, 0x01, 0x62, 0x02, 0x80, 0x01, 0x1B,
+  0x80, 0x01, 0x62, 0x02, 0x80, 0x01, 0x25, 0x7D, 0x02, 0x80, 0x01, 0x24, 0x80, 0x01, 0x62, 0x02,
+  0x80, 0x01, 0x1B, 0x80, 0x01, 0x62, 0x02, 0x80, 0x01, 0x26, 0x7B, 0x02, 0x80, 0x01, 0x25, 0x80,
+  0x01, 0x62, 0x02, 0x80, 0x01, 0x1B, 0x80, 0x01, 0x62, 0x02, 0x80, 0x01, 0x27, 0x79, 0x02, 0x80,
+  0x01, 0x26, 0x80, 0x01, 0x62, 0x02, 0x80, 0x01, 0x1B, 0x80, 0x01, 0x62, 0x02, 0x80, 0x01, 0x27,
+  0x80, 0x01, 0x77, 0x02, 0x80, 0x01, 0x27, 0x80, 0x01, 0x62, 0x02, 0x80, 0x01, 0x1B, 0x80, 0x01,
+  0x62, 0x02, 0x80, 0x01, 0x27, 0x80, 0x01, 0x77, 0x02, 0x80, 0x01, 0x27, 0x80, 0x01, 0x62, 0x02,
+  0x80, 0x01, 0x1B, 0x80, 0x01, 0x62, 0x02, 0x80, 0x01, 0x26, 0x80, 0x01, 0x79, 0x02, 0x80, 0x01,
+  0x26, 0x80, 0x01, 0x62, 0x02, 0x80, 0x01, 0x1B, 0x80, 0x01, 0x62, 0x02, 0x80, 0x01, 0x25, 0x80,
+  0x01, 0x7B, 0x02, 0x80, 0x01, 0x25, 0x80, 0x01, 0x62, 0x02, 0x80, 0x01, 0x1B, 0x80, 0x01, 0x62,
+  0x02, 0x80, 0x01, 0x24, 0x80, 0x01, 0x7D, 0x02, 0x80, 0x01, 0x24, 0x80, 0x01, 0x62, 0x02, 0x80,
+  0x01, 0x1C, 0x62, 0x02, 0x80, 0x01, 0x23, 0x80, 0x01, 0x7F, 0x02, 0x80, 0x01, 0x23, 0x80, 0x01,
+  0x62, 0x02, 0x80, 0x01, 0x1C, 0x63, 0x02, 0x22, 0x80, 0x01, 0x7F, 0x02, 0x41, 0x02, 0x80, 0x01,
+  0x22, 0x80, 0x01, 0x62, 0x02, 0x80, 0x01, 0x1C, 0x63, 0x02, 0x21, 0x80, 0x01, 0x7F, 0x02, 0x43,
+  0x02, 0x80, 0x01, 0x21, 0x80, 0x01, 0x62, 0x02, 0x80, 0x01, 0x1C, 0x63, 0x02, 0x20, 0x80, 0x01,
+  0x7F, 0x02, 0x45, 0x02, 0x80, 0x01, 0x20, 0x80, 0x01, 0x62, 0x02, 0x80, 0x01, 0x1C, 0x63, 0x02,
+  0x1F, 0x80, 0x01, 0x7F, 0x02, 0x47, 0x02, 0x80, 0x01, 0x1F, 0x63, 0x02, 0x1D, 0x63, 0x02, 0x80,
+  0x01, 0x1D, 0x80, 0x01, 0x7F, 0x02, 0x49, 0x02, 0x80, 0x01, 0x1E, 0x63, 0x02, 0x1D, 0x80, 0x01,
+  0x62, 0x02, 0x80, 0x01, 0x1C, 0x80, 0x01, 0x7F, 0x02, 0x4B, 0x02, 0x80, 0x01, 0x1C, 0x80, 0x01,
+  0x63, 0x02, 0x1D, 0x80, 0x01, 0x62, 0x02, 0x80, 0x01, 0x1B, 0x80, 0x01, 0x7F, 0x02, 0x4D, 0x02,
+  0x80, 0x01, 0x1B, 0x80, 0x01, 0x63, 0x02, 0x1D, 0x80, 0x01, 0x62, 0x02, 0x80, 0x01, 0x1A, 0x80,
+  0x01, 0x7F, 0x02, 0x4F, 0x02, 0x80, 0x01, 0x1A, 0x80, 0x01, 0x62, 0x02, 0x80, 0x01, 0x1D, 0x80,
+  0x01, 0x63, 0x02, 0x19, 0x80, 0x01, 0x7F, 0x02, 0x51, 0x02, 0x80, 0x01, 0x19, 0x80, 0x01, 0x62,
+  0x02, 0x80, 0x01, 0x1D, 0x80, 0x01, 0x63, 0x02, 0x18, 0x80, 0x01, 0x7F, 0x02, 0x53, 0x02, 0x80,
+  0x01, 0x18, 0x63, 0x02, 0x80, 0x01, 0x1E, 0x63, 0x02, 0x80, 0x01, 0x16, 0x80, 0x01, 0x7F, 0x02,
+  0x55, 0x02, 0x80, 0x01, 0x17, 0x63, 0x02, 0x80, 0x01, 0x1E, 0x63, 0x02, 0x80, 0x01, 0x15, 0x80,
+  0x01, 0x7F, 0x02, 0x57, 0x02, 0x80, 0x01, 0x15, 0x80, 0x01, 0x63, 0x02, 0x1F, 0x80, 0x01, 0x63,
+  0x02, 0x14, 0x80, 0x01, 0x7F, 0x02, 0x59, 0x02, 0x80, 0x01, 0x14, 0x80, 0x01, 0x63, 0x02, 0x1F,
+  0x80, 0x01, 0x63, 0x02, 0x13, 0x80, 0x01, 0x7F, 0x02, 0x5B, 0x02, 0x80, 0x01, 0x13, 0x64, 0x02,
+  0x1F, 0x80, 0x01, 0x63, 0x02, 0x80, 0x01, 0x11, 0x80, 0x01, 0x7F, 0x02, 0x5D, 0x02, 0x80, 0x01,
+  0x11, 0x80, 0x01, 0x63, 0x02, 0x80, 0x01, 0x1F, 0x80, 0x01, 0x63, 0x02, 0x80, 0x01, 0x10, 0x80,
+  0x01, 0x7F, 0x02, 0x5F, 0x02, 0x80, 0x01, 0x10, 0x80, 0x01, 0x63, 0x02, 0x80, 0x01, 0x20, 0x64,
+  0x02, 0x0F, 0x80, 0x01, 0x7F, 0x02, 0x61, 0x02, 0x80, 0x01, 0x0F, 0x64, 0x02, 0x80, 0x01, 0x20,
+  0x64, 0x02, 0x80, 0x01, 0x0D, 0x80, 0x01, 0x7F, 0x02, 0x63, 0x02, 0x80, 0x01, 0x0E, 0x64, 0x02,
+  0x21, 0x80, 0x01, 0x63, 0x02, 0x80, 0x01, 0x0C, 0x80, 0x01, 0x7F, 0x02, 0x65, 0x02, 0x80, 0x01,
+  0x0C, 0x80, 0x01, 0x64, 0x02, 0x21, 0x80, 0x01, 0x64, 0x02, 0x0B, 0x80, 0x01, 0x7F, 0x02, 0x67,
+  0x02, 0x80, 0x01, 0x0B, 0x64, 0x02, 0x80, 0x01, 0x22, 0x64, 0x02, 0x80, 0x01, 0x09, 0x80, 0x01,
+  0x7F, 0x02, 0x69, 0x02, 0x80, 0x01, 0x09, 0x80, 0x01, 0x64, 0x02, 0x80, 0x01, 0x22, 0x65, 0x02,
+  0x08, 0x80, 0x01, 0x7F, 0x02, 0x6B, 0x02, 0x80, 0x01, 0x08, 0x80, 0x01, 0x64, 0x02, 0x23, 0x80,
+  0x01, 0x64, 0x02, 0x80, 0x01, 0x06, 0x80, 0x01, 0x7F, 0x02, 0x6D, 0x02, 0x80, 0x01, 0x07, 0x65,
+  0x02, 0x23, 0x80, 0x01, 0x64, 0x02, 0x80, 0x01, 0x05, 0x80, 0x01, 0x76, 0x02, 0x41, 0x01, 0x76,
+  0x02, 0x80, 0x01, 0x05, 0x80, 0x01, 0x64, 0x02, 0x80, 0x01, 0x24, 0x65, 0x02, 0x80, 0x01, 0x03,
+  0x80, 0x01, 0x76, 0x02, 0x80, 0x01, 0x01, 0x80, 0x01, 0x76, 0x02, 0x80, 0x01, 0x04, 0x65, 0x02,
+  0x80, 0x01, 0x24, 0x80, 0x01, 0x64, 0x02, 0x80, 0x01, 0x02, 0x80, 0x01, 0x76, 0x02, 0x80, 0x01,
+  0x03, 0x80, 0x01, 0x76, 0x02, 0x80, 0x01, 0x02, 0x80, 0x01, 0x65, 0x02, 0x25, 0x80, 0x01, 0x65,
+  0x02, 0x01, 0x80, 0x01, 0x76, 0x02, 0x80, 0x01, 0x05, 0x80, 0x01, 0x76, 0x02, 0x80, 0x01, 0x01,
+  0x65, 0x02, 0x80, 0x01, 0x26, 0x65, 0x02, 0x41, 0x01, 0x76, 0x02, 0x80, 0x01, 0x07, 0x80, 0x01,
+  0x76, 0x02, 0x41, 0x01, 0x65, 0x02, 0x80, 0x01, 0x26, 0x80, 0x01, 0x7F, 0x02, 0x5C, 0x02, 0x80,
+  0x01, 0x09, 0x80, 0x01, 0x7F, 0x02, 0x5D, 0x02, 0x27, 0x80, 0x01, 0x64, 0x02, 0x41, 0x03, 0x74,
+  0x02, 0x80, 0x01, 0x0B, 0x80, 0x01, 0x75, 0x02, 0x80, 0x03, 0x64, 0x02, 0x80, 0x01, 0x28, 0x63,
+  0x02, 0x42, 0x03, 0x73, 0x02, 0x80, 0x01, 0x0D, 0x80, 0x01, 0x73, 0x02, 0x42, 0x03, 0x63, 0x02,
+  0x80, 0x01, 0x28, 0x80, 0x01, 0x61, 0x02, 0x44, 0x03, 0x71, 0x02, 0x80, 0x01, 0x0F, 0x80, 0x01,
+  0x71, 0x02, 0x44, 0x03, 0x62, 0x02, 0x29, 0x80, 0x01, 0x60, 0x02, 0x45, 0x03, 0x70, 0x02, 0x80,
+  0x01, 0x11, 0x80, 0x01, 0x70, 0x02, 0x45, 0x03, 0x60, 0x02, 0x80, 0x01, 0x2A, 0x5F, 0x02, 0x47,
+  0x03, 0x6E, 0x02, 0x80, 0x01, 0x13, 0x80, 0x01, 0x6E, 0x02, 0x47, 0x03, 0x5F, 0x02, 0x80, 0x01,
+  0x2A, 0x80, 0x01, 0x5D, 0x02, 0x49, 0x03, 0x6C, 0x02, 0x80, 0x01, 0x15, 0x80, 0x01, 0x6C, 0x02,
+  0x49, 0x03, 0x5D, 0x02, 0x80, 0x01, 0x2B, 0x80, 0x01, 0x5C, 0x02, 0x4A, 0x03, 0x6B, 0x02, 0x80,
+  0x01, 0x17, 0x80, 0x01, 0x6B, 0x02, 0x4A, 0x03, 0x5C, 0x02, 0x80, 0x01, 0x2C, 0x80, 0x01, 0x5A,
+  0x02, 0x4C, 0x03, 0x69, 0x02, 0x80, 0x01, 0x19, 0x80, 0x01, 0x69, 0x02, 0x4C, 0x03, 0x5B, 0x02,
+  0x2D, 0x80, 0x01, 0x59, 0x02, 0x4E, 0x03, 0x67, 0x02, 0x80, 0x01, 0x1B, 0x80, 0x01, 0x67, 0x02,
+  0x4E, 0x03, 0x59, 0x02, 0x80, 0x01, 0x2E, 0x58, 0x02, 0x50, 0x03, 0x65, 0x02, 0x80, 0x01, 0x1D,
+  0x80, 0x01, 0x65, 0x02, 0x50, 0x03, 0x58, 0x02, 0x2F, 0x80, 0x01, 0x56, 0x02, 0x52, 0x03, 0x63,
+  0x02, 0x80, 0x01, 0x1F, 0x80, 0x01, 0x64, 0x02, 0x51, 0x03, 0x56, 0x02, 0x80, 0x01, 0x30, 0x55,
+  0x02, 0x53, 0x03, 0x62, 0x02, 0x80, 0x01, 0x21, 0x80, 0x01, 0x62, 0x02, 0x53, 0x03, 0x55, 0x02,
+  0x31, 0x80, 0x01, 0x53, 0x02, 0x55, 0x03, 0x60, 0x02, 0x80, 0x01, 0x23, 0x80, 0x01, 0x60, 0x02,
+  0x55, 0x03, 0x53, 0x02, 0x80, 0x01, 0x32, 0x52, 0x02, 0x57, 0x03, 0x5E, 0x02, 0x80, 0x01, 0x25,
+  0x80, 0x01, 0x5E, 0x02, 0x57, 0x03, 0x52, 0x02, 0x80, 0x01, 0x32, 0x80, 0x01, 0x50, 0x02, 0x59,
+  0x03, 0x5C, 0x02, 0x80, 0x01, 0x27, 0x80, 0x01, 0x5C, 0x02, 0x59, 0x03, 0x50, 0x02, 0x80, 0x01,
+  0x34, 0x4F, 0x02, 0x5B, 0x03, 0x5A, 0x02, 0x80, 0x01, 0x29, 0x80, 0x01, 0x5A, 0x02, 0x5B, 0x03,
+  0x4F, 0x02, 0x35, 0x80, 0x01, 0x4D, 0x02, 0x5D, 0x03, 0x58, 0x02, 0x80, 0x01, 0x2B, 0x80, 0x01,
+  0x58, 0x02, 0x5D, 0x03, 0x4D, 0x02, 0x80, 0x01, 0x36, 0x80, 0x01, 0x4B, 0x02, 0x5F, 0x03, 0x56,
+  0x02, 0x80, 0x01, 0x2D, 0x80, 0x01, 0x56, 0x02, 0x5F, 0x03, 0x4C, 0x02, 0x37, 0x80, 0x01, 0x4A,
+  0x02, 0x61, 0x03, 0x54, 0x02, 0x80, 0x01, 0x2F, 0x80, 0x01, 0x54, 0x02, 0x61, 0x03, 0x4A, 0x02,
+  0x80, 0x01, 0x38, 0x80, 0x01, 0x48, 0x02, 0x64, 0x03, 0x51, 0x02, 0x80, 0x01, 0x31, 0x80, 0x01,
+  0x52, 0x02, 0x63, 0x03, 0x49, 0x02, 0x3A, 0x47, 0x02, 0x66, 0x03, 0x4F, 0x02, 0x80, 0x01, 0x33,
+  0x80, 0x01, 0x4F, 0x02, 0x66, 0x03, 0x47, 0x02, 0x80, 0x01, 0x3A, 0x80, 0x01, 0x45, 0x02, 0x68,
+  0x03, 0x4D, 0x02, 0x80, 0x01, 0x35, 0x80, 0x01, 0x4D, 0x02, 0x68, 0x03, 0x45, 0x02, 0x80, 0x01,
+  0x3C, 0x44, 0x02, 0x6A, 0x03, 0x4B, 0x02, 0x80, 0x01, 0x37, 0x80, 0x01, 0x4B, 0x02, 0x6A, 0x03,
+  0x44, 0x02, 0x3D, 0x80, 0x01, 0x42, 0x02, 0x6D, 0x03, 0x48, 0x02, 0x80, 0x01, 0x39, 0x80, 0x01,
+  0x48, 0x02, 0x6D, 0x03, 0x42, 0x02, 0x80, 0x01, 0x3E, 0x81, 0x01, 0x02, 0x6F, 0x03, 0x46, 0x02,
+  0x80, 0x01, 0x3B, 0x80, 0x01, 0x46, 0x02, 0x6F, 0x03, 0x81, 0x02, 0x01, 0x3F, 0x00, 0x80, 0x02,
+  0x71, 0x03, 0x43, 0x02, 0x80, 0x01, 0x3D, 0x80, 0x01, 0x43, 0x02, 0x72, 0x03, 0x80, 0x01, 0x3F,
+  0x00, 0x80, 0x01, 0x73, 0x03, 0x81, 0x02, 0x01, 0x3F, 0x81, 0x01, 0x02, 0x73, 0x03, 0x80, 0x02,
+  0x3F, 0x02, 0x80, 0x02, 0x72, 0x03, 0x81, 0x02, 0x01, 0x3F, 0x81, 0x01, 0x02, 0x72, 0x03, 0x80,
+  0x02, 0x3F, 0x04, 0x80, 0x02, 0x70, 0x03, 0x43, 0x02, 0x80, 0x01, 0x3B, 0x80, 0x01, 0x43, 0x02,
+  0x70, 0x03, 0x80, 0x02, 0x3F, 0x06, 0x80, 0x02, 0x6E, 0x03, 0x46, 0x02, 0x41, 0x01, 0x36, 0x80,
+  0x01, 0x46, 0x02, 0x6E, 0x03, 0x81, 0x02, 0x01, 0x3F, 0x06, 0x81, 0x01, 0x02, 0x6C, 0x03, 0x49,
+  0x02, 0x41, 0x01, 0x31, 0x41, 0x01, 0x49, 0x02, 0x6D, 0x03, 0x80, 0x01, 0x3F, 0x08, 0x80, 0x01,
+  0x6B, 0x03, 0x4D, 0x02, 0x41, 0x01, 0x2B, 0x41, 0x01, 0x4D, 0x02, 0x6B, 0x03, 0x80, 0x01, 0x3F,
+  0x0A, 0x80, 0x01, 0x69, 0x03, 0x51, 0x02, 0x41, 0x01, 0x25, 0x41, 0x01, 0x51, 0x02, 0x69, 0x03,
+  0x80, 0x02, 0x3F, 0x0C, 0x80, 0x01, 0x67, 0x03, 0x55, 0x02, 0x42, 0x01, 0x1D, 0x42, 0x01, 0x55,
+  0x02, 0x67, 0x03, 0x80, 0x02, 0x3F, 0x0E, 0x80, 0x02, 0x65, 0x03, 0x5B, 0x02, 0x42, 0x01, 0x13,
+  0x43, 0x01, 0x5A, 0x02, 0x65, 0x03, 0x81, 0x02, 0x01, 0x3F, 0x0F, 0x80, 0x02, 0x63, 0x03, 0x63,
+  0x02, 0x4C, 0x01, 0x62, 0x02, 0x63, 0x03, 0x81, 0x02, 0x01, 0x3F, 0x10, 0x81, 0x01, 0x02, 0x61,
+  0x03, 0x7F, 0x02, 0x55, 0x02, 0x61, 0x03, 0x81, 0x02, 0x01, 0x3F, 0x12, 0x81, 0x01, 0x02, 0x5F,
+  0x03, 0x7F, 0x02, 0x57, 0x02, 0x5F, 0x03, 0x81, 0x02, 0x01, 0x3F, 0x14, 0x81, 0x01, 0x02, 0x5D,
+  0x03, 0x7F, 0x02, 0x59, 0x02, 0x5D, 0x03, 0x81, 0x02, 0x01, 0x3F, 0x16, 0x81, 0x01, 0x02, 0x5B,
+  0x03, 0x7F, 0x02, 0x5B, 0x02, 0x5B, 0x03, 0x81, 0x02, 0x01, 0x3F, 0x18, 0x81, 0x01, 0x02, 0x59,
+  0x03, 0x7F, 0x02, 0x5D, 0x02, 0x59, 0x03, 0x81, 0x02, 0x01, 0x3F, 0x1A, 0x81, 0x01, 0x02, 0x57,
+  0x03, 0x7F, 0x02, 0x5F, 0x02, 0x57, 0x03, 0x81, 0x02, 0x01, 0x3F, 0x1C, 0x81, 0x01, 0x02, 0x55,
+  0x03, 0x7F, 0x02, 0x61, 0x02, 0x55, 0x03, 0x81, 0x02, 0x01, 0x3F, 0x1E, 0x81, 0x01, 0x02, 0x53,
+  0x03, 0x7F, 0x02, 0x63, 0x02, 0x53, 0x03, 0x81, 0x02, 0x01, 0x3F, 0x20, 0x81, 0x01, 0x02, 0x51,
+  0x03, 0x7F, 0x02, 0x65, 0x02, 0x51, 0x03, 0x81, 0x02, 0x01, 0x3F, 0x23, 0x80, 0x02, 0x4F, 0x03,
+  0x7F, 0x02, 0x67, 0x02, 0x4F, 0x03, 0x81, 0x02, 0x01, 0x3F, 0x25, 0x80, 0x02, 0x4D, 0x03, 0x7F,
+  0x02, 0x69, 0x02, 0x4D, 0x03, 0x81, 0x02, 0x01, 0x3F, 0x27, 0x80, 0x01, 0x4B, 0x03, 0x7F, 0x02,
+  0x6B, 0x02, 0x4B, 0x03, 0x80, 0x02, 0x3F, 0x2A, 0x81, 0x01, 0x02, 0x48, 0x03, 0x7F, 0x02, 0x6D,
+  0x02, 0x49, 0x03, 0x80, 0x01, 0x3F, 0x2C, 0x81, 0x01, 0x02, 0x46, 0x03, 0x7F, 0x02, 0x6F, 0x02,
+  0x46, 0x03, 0x81, 0x02, 0x01, 0x3F, 0x2F, 0x80, 0x02, 0x44, 0x03, 0x7F, 0x02, 0x71, 0x02, 0x44,
+  0x03, 0x81, 0x02, 0x01, 0x3F, 0x31, 0x80, 0x02, 0x42, 0x03, 0x7F, 0x02, 0x73, 0x02, 0x42, 0x03,
+  0x81, 0x02, 0x01, 0x3F, 0x33, 0x81, 0x02, 0x03, 0x7F, 0x02, 0x75, 0x02, 0x81, 0x03, 0x02, 0x3F,
+  0x36, 0x41, 0x01, 0x7F, 0x02, 0x73, 0x02, 0x41, 0x01, 0x3F, 0x39, 0x80, 0x01, 0x7F, 0x02, 0x71,
+  0x02, 0x80, 0x01, 0x3F, 0x3D, 0x80, 0x01, 0x7F, 0x02, 0x6D, 0x02, 0x80, 0x01, 0x3F, 0x3F, 0x01,
+  0x80, 0x01, 0x7F, 0x02, 0x6A, 0x02, 0x80, 0x01, 0x3F, 0x3F, 0x03, 0x80, 0x01, 0x7F, 0x02, 0x67,
+  0x02, 0x80, 0x01, 0x3F, 0x3F, 0x07, 0x80, 0x01, 0x7F, 0x02, 0x63, 0x02, 0x80, 0x01, 0x3F, 0x3F,
+  0x0B, 0x80, 0x01, 0x7F, 0x02, 0x5F, 0x02, 0x80, 0x01, 0x3F, 0x3F, 0x0F, 0x80, 0x01, 0x7F, 0x02,
+  0x5B, 0x02, 0x80, 0x01, 0x3F, 0x3F, 0x13, 0x80, 0x01, 0x7F, 0x02, 0x57, 0x02, 0x80, 0x01, 0x3F,
+  0x3F, 0x17, 0x80, 0x01, 0x7F, 0x02, 0x53, 0x02, 0x80, 0x01, 0x3F, 0x3F, 0x1B, 0x41, 0x01, 0x7F,
+  0x02, 0x4D, 0x02, 0x41, 0x01, 0x3F, 0x3F, 0x20, 0x80, 0x01, 0x7F, 0x02, 0x49, 0x02, 0x41, 0x01,
+  0x3F, 0x3F, 0x24, 0x41, 0x01, 0x7F, 0x02, 0x43, 0x02, 0x41, 0x01, 0x3F, 0x3F, 0x2A, 0x41, 0x01,
+  0x7D, 0x02, 0x41, 0x01, 0x3F, 0x3F, 0x31, 0x41, 0x01, 0x76, 0x02, 0x41, 0x01, 0x3F, 0x3F, 0x37,
+  0x42, 0x01, 0x6D, 0x02, 0x42, 0x01, 0x3F, 0x3F, 0x3F, 0x00, 0x42, 0x01, 0x63, 0x02, 0x43, 0x01,
+  0x3F, 0x3F, 0x3F, 0x09, 0x44, 0x01, 0x55, 0x02, 0x44, 0x01, 0x3F, 0x3F, 0x3F, 0x18, 0x4D, 0x01,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x20,
 };
+
+static constexpr ImageAsset entangled = {
+  240, 240, ImageFormat::RLE_MASK, 0x0000,
+  0xF70A, entangled_palette, 4, entangled_data,
+  sizeof(entangled_data)};
+
+#endif /* IMAGELIBRARY_ENTANGLED_H_ */
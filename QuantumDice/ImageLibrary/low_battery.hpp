@@ -0,0 +1,348 @@
+// Generated by scripts/image_assets.py from assets/images/low_battery.png - do not edit
+// Image Size     : 240x240 pixels, RLE_INDEXED
+// Memory usage   : 5204 bytes (raw 115200 bytes)
+
+#ifndef IMAGELIBRARY_LOW_BATTERY_H_
+#define IMAGELIBRARY_LOW_BATTERY_H_
+
+#include "../ImageAsset.hpp"
+
+#include <Arduino.h>
+
+static constexpr uint16_t low_battery_palette[] PROGMEM = {
+  0x0800, 0x1000, 0x1800, 0x2000, 0x2800, 0x3000, 0x3800, 0x4000, 0x4800, 0x5000, 0x5800, 0x6000,
+  0x6800, 0x7000, 0x7800, 0x8000, 0x8800, 0x9000, 0x9800, 0xA000, 0xA800, 0xB000, 0xB800, 0xC000,
+  0xC800, 0xD000, 0xD800, 0xE000, 0xE800, 0xF000, 0xF800,
+};
+
+static constexpr uint8_t low_battery_data[] PROGMEM = {
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x2D, 0x80, 0x00, 0x44, 0x11, 0x80, 0x04, 0x3F, 0x3F,
+  0x3F, 0x28, 0x80, 0x02, 0x44, 0x1E, 0x80, 0x08, 0x3F, 0x3F, 0x3F, 0x28, 0x80, 0x02, 0x44, 0x1E,
+  0x80, 0x08, 0x3F, 0x3F, 0x3F, 0x28, 0x80, 0x02, 0x44, 0x1E, 0x80, 0x08, 0x3F, 0x3F, 0x3F, 0x28,
+  0x80, 0x02, 0x44, 0x1E, 0x80, 0x08, 0x3F, 0x3F, 0x3F, 0x28, 0x80, 0x02, 0x44, 0x1E, 0x80, 0x08,
+  0x3F, 0x3F, 0x3F, 0x28, 0x80, 0x02, 0x44, 0x1E, 0x80, 0x08, 0x3F, 0x3F, 0x3F, 0x28, 0x80, 0x02,
+  0x44, 0x1E, 0x80, 0x08, 0x3F, 0x3F, 0x3F, 0x28, 0x80, 0x02, 0x44, 0x1E, 0x80, 0x08, 0x3F, 0x3F,
+  0x3F, 0x28, 0x80, 0x02, 0x44, 0x1E, 0x80, 0x08, 0x3F, 0x3F, 0x3F, 0x28, 0x80, 0x02, 0x44, 0x1E,
+  0x80, 0x08, 0x3F, 0x3F, 0x3F, 0x28, 0x80, 0x02, 0x44, 0x1E, 0x80, 0x08, 0x3F, 0x3F, 0x3F, 0x28,
+  0x80, 0x02, 0x44, 0x1E, 0x80, 0x08, 0x12, 0x82, 0x05, 0x0B, 0x0F, 0x41, 0x11, 0x83, 0x10, 0x0D,
+  0x09, 0x02, 0x3F, 0x3F, 0x3F, 0x0C, 0x80, 0x02, 0x44, 0x1E, 0x80, 0x08, 0x0F, 0x82, 0x06, 0x13,
+  0x1D, 0x48, 0x1E, 0x82, 0x19, 0x0D, 0x01, 0x0C, 0x80, 0x12, 0x43, 0x19, 0x80, 0x0F, 0x0B, 0x80,
+  0x02, 0x45, 0x19, 0x80, 0x0A, 0x0B, 0x80, 0x07, 0x43, 0x19, 0x81, 0x18, 0x00, 0x3F, 0x3F, 0x0F,
+  0x80, 0x02, 0x44, 0x1E, 0x80, 0x08, 0x0D, 0x81, 0x03, 0x16, 0x4D, 0x1E, 0x81, 0x1D, 0x0C, 0x0B,
+  0x80, 0x0F, 0x43, 0x1E, 0x80, 0x1B, 0x0B, 0x80, 0x0A, 0x45, 0x1E, 0x80, 0x14, 0x0B, 0x80, 0x11,
+  0x43, 0x1E, 0x80, 0x19, 0x3F, 0x3F, 0x10, 0x80, 0x02, 0x44, 0x1E, 0x80, 0x08, 0x0C, 0x81, 0x08,
+  0x1D, 0x50, 0x1E, 0x81, 0x16, 0x01, 0x09, 0x80, 0x07, 0x44, 0x1E, 0x80, 0x03, 0x0A, 0x80, 0x13,
+  0x45, 0x1E, 0x80, 0x1C, 0x0B, 0x80, 0x19, 0x43, 0x1E, 0x80, 0x10, 0x3F, 0x3F, 0x10, 0x80, 0x02,
+  0x44, 0x1E, 0x80, 0x08, 0x0B, 0x80, 0x0A, 0x53, 0x1E, 0x81, 0x18, 0x01, 0x09, 0x80, 0x1D, 0x43,
+  0x1E, 0x80, 0x0B, 0x0A, 0x80, 0x1B, 0x46, 0x1E, 0x80, 0x05, 0x09, 0x80, 0x01, 0x44, 0x1E, 0x80,
+  0x08, 0x3F, 0x3F, 0x10, 0x80, 0x02, 0x44, 0x1E, 0x80, 0x08, 0x0A, 0x80, 0x06, 0x46, 0x1E, 0x82,
+  0x18, 0x0B, 0x03, 0x01, 0x83, 0x00, 0x06, 0x10, 0x1D, 0x45, 0x1E, 0x80, 0x16, 0x09, 0x80, 0x16,
+  0x43, 0x1E, 0x80, 0x14, 0x09, 0x80, 0x04, 0x47, 0x1E, 0x80, 0x0E, 0x09, 0x80, 0x0A, 0x44, 0x1E,
+  0x80, 0x00, 0x3F, 0x3F, 0x10, 0x80, 0x02, 0x44, 0x1E, 0x80, 0x08, 0x09, 0x81, 0x00, 0x1B, 0x44,
+  0x1E, 0x81, 0x1D, 0x0A, 0x07, 0x81, 0x01, 0x15, 0x45, 0x1E, 0x80, 0x0E, 0x08, 0x80, 0x0E, 0x43,
+  0x1E, 0x80, 0x1C, 0x09, 0x80, 0x0C, 0x47, 0x1E, 0x80, 0x16, 0x09, 0x80, 0x12, 0x43, 0x1E, 0x80,
+  0x17, 0x3F, 0x3F, 0x11, 0x80, 0x02, 0x44, 0x1E, 0x80, 0x08, 0x09, 0x80, 0x10, 0x44, 0x1E, 0x81,
+  0x1D, 0x05, 0x0A, 0x80, 0x13, 0x44, 0x1E, 0x81, 0x1D, 0x02, 0x07, 0x80, 0x05, 0x44, 0x1E, 0x80,
+  0x05, 0x08, 0x80, 0x14, 0x43, 0x1E, 0x80, 0x18, 0x42, 0x1E, 0x80, 0x1D, 0x09, 0x80, 0x1B, 0x43,
+  0x1E, 0x80, 0x0F, 0x3F, 0x3F, 0x11, 0x80, 0x02, 0x44, 0x1E, 0x80, 0x08, 0x08, 0x81, 0x01, 0x1D,
+  0x44, 0x1E, 0x80, 0x0A, 0x0C, 0x80, 0x19, 0x44, 0x1E, 0x80, 0x11, 0x08, 0x80, 0x1C, 0x43, 0x1E,
+  0x80, 0x0D, 0x08, 0x80, 0x1C, 0x42, 0x1E, 0x81, 0x18, 0x0D, 0x43, 0x1E, 0x80, 0x07, 0x07, 0x80,
+  0x03, 0x44, 0x1E, 0x80, 0x07, 0x3F, 0x3F, 0x11, 0x80, 0x02, 0x44, 0x1E, 0x80, 0x08, 0x08, 0x80,
+  0x0D, 0x44, 0x1E, 0x80, 0x16, 0x0D, 0x80, 0x06, 0x44, 0x1E, 0x81, 0x1D, 0x00, 0x07, 0x80, 0x14,
+  0x43, 0x1E, 0x80, 0x15, 0x07, 0x80, 0x05, 0x43, 0x1E, 0x81, 0x10, 0x05, 0x43, 0x1E, 0x80, 0x0F,
+  0x07, 0x80, 0x0B, 0x43, 0x1E, 0x80, 0x1D, 0x3F, 0x3F, 0x12, 0x80, 0x02, 0x44, 0x1E, 0x80, 0x08,
+  0x08, 0x80, 0x18, 0x44, 0x1E, 0x80, 0x05, 0x0E, 0x80, 0x15, 0x44, 0x1E, 0x80, 0x0A, 0x07, 0x80,
+  0x0C, 0x43, 0x1E, 0x80, 0x1D, 0x07, 0x80, 0x0D, 0x43, 0x1E, 0x80, 0x07, 0x00, 0x80, 0x1C, 0x42,
+  0x1E, 0x80, 0x18, 0x07, 0x80, 0x14, 0x43, 0x1E, 0x80, 0x16, 0x3F, 0x3F, 0x12, 0x80, 0x02, 0x44,
+  0x1E, 0x80, 0x08, 0x07, 0x80, 0x01, 0x44, 0x1E, 0x80, 0x1A, 0x0F, 0x80, 0x09, 0x44, 0x1E, 0x80,
+  0x12, 0x07, 0x80, 0x04, 0x44, 0x1E, 0x80, 0x06, 0x06, 0x80, 0x16, 0x43, 0x1E, 0x80, 0x00, 0x00,
+  0x80, 0x14, 0x43, 0x1E, 0x80, 0x00, 0x06, 0x80, 0x1C, 0x43, 0x1E, 0x80, 0x0E, 0x3F, 0x3F, 0x12,
+  0x80, 0x02, 0x44, 0x1E, 0x80, 0x08, 0x07, 0x80, 0x08, 0x44, 0x1E, 0x80, 0x0F, 0x0F, 0x80, 0x00,
+  0x44, 0x1E, 0x80, 0x1A, 0x08, 0x80, 0x1B, 0x43, 0x1E, 0x80, 0x0F, 0x06, 0x80, 0x1D, 0x42, 0x1E,
+  0x80, 0x16, 0x01, 0x80, 0x0C, 0x43, 0x1E, 0x80, 0x08, 0x05, 0x80, 0x04, 0x44, 0x1E, 0x80, 0x05,
+  0x3F, 0x3F, 0x12, 0x80, 0x02, 0x44, 0x1E, 0x80, 0x08, 0x07, 0x80, 0x0E, 0x44, 0x1E, 0x80, 0x09,
+  0x10, 0x80, 0x18, 0x44, 0x1E, 0x80, 0x00, 0x07, 0x80, 0x13, 0x43, 0x1E, 0x80, 0x17, 0x05, 0x80,
+  0x07, 0x43, 0x1E, 0x80, 0x0E, 0x01, 0x80, 0x03, 0x43, 0x1E, 0x80, 0x11, 0x05, 0x80, 0x0D, 0x43,
+  0x1E, 0x80, 0x1C, 0x3F, 0x3F, 0x13, 0x80, 0x02, 0x44, 0x1E, 0x80, 0x08, 0x07, 0x80, 0x12, 0x44,
+  0x1E, 0x80, 0x03, 0x10, 0x80, 0x12, 0x44, 0x1E, 0x80, 0x03, 0x07, 0x80, 0x0B, 0x44, 0x1E, 0x80,
+  0x00, 0x04, 0x80, 0x0F, 0x43, 0x1E, 0x80, 0x05, 0x02, 0x80, 0x1B, 0x42, 0x1E, 0x80, 0x19, 0x05,
+  0x80, 0x15, 0x43, 0x1E, 0x80, 0x14, 0x3F, 0x3F, 0x13, 0x80, 0x02, 0x44, 0x1E, 0x80, 0x08, 0x07,
+  0x80, 0x15, 0x44, 0x1E, 0x11, 0x80, 0x0E, 0x44, 0x1E, 0x80, 0x07, 0x07, 0x80, 0x02, 0x44, 0x1E,
+  0x80, 0x08, 0x04, 0x80, 0x17, 0x42, 0x1E, 0x80, 0x1D, 0x03, 0x80, 0x13, 0x43, 0x1E, 0x80, 0x02,
+  0x04, 0x80, 0x1D, 0x43, 0x1E, 0x80, 0x0C, 0x3F, 0x3F, 0x13, 0x80, 0x02, 0x44, 0x1E, 0x80, 0x08,
+  0x07, 0x80, 0x16, 0x43, 0x1E, 0x80, 0x1D, 0x11, 0x80, 0x0D, 0x44, 0x1E, 0x80, 0x08, 0x08, 0x80,
+  0x1A, 0x43, 0x1E, 0x80, 0x10, 0x03, 0x80, 0x00, 0x43, 0x1E, 0x80, 0x15, 0x03, 0x80, 0x0A, 0x43,
+  0x1E, 0x80, 0x0A, 0x03, 0x80, 0x06, 0x44, 0x1E, 0x80, 0x04, 0x3F, 0x3F, 0x13, 0x80, 0x02, 0x44,
+  0x1E, 0x80, 0x08, 0x07, 0x80, 0x17, 0x43, 0x1E, 0x80, 0x1C, 0x11, 0x80, 0x0B, 0x44, 0x1E, 0x80,
+  0x09, 0x08, 0x80, 0x11, 0x43, 0x1E, 0x80, 0x19, 0x03, 0x80, 0x08, 0x43, 0x1E, 0x80, 0x0C, 0x03,
+  0x80, 0x02, 0x43, 0x1E, 0x80, 0x13, 0x03, 0x80, 0x0E, 0x43, 0x1E, 0x80, 0x1B, 0x3F, 0x3F, 0x14,
+  0x80, 0x02, 0x44, 0x1E, 0x80, 0x08, 0x07, 0x80, 0x17, 0x43, 0x1E, 0x80, 0x1D, 0x11, 0x80, 0x0C,
+  0x44, 0x1E, 0x80, 0x08, 0x08, 0x80, 0x09, 0x44, 0x1E, 0x80, 0x01, 0x02, 0x80, 0x10, 0x43, 0x1E,
+  0x80, 0x04, 0x04, 0x80, 0x19, 0x42, 0x1E, 0x80, 0x1B, 0x03, 0x80, 0x17, 0x43, 0x1E, 0x80, 0x13,
+  0x3F, 0x3F, 0x14, 0x80, 0x02, 0x44, 0x1E, 0x80, 0x08, 0x07, 0x80, 0x15, 0x44, 0x1E, 0x11, 0x80,
+  0x0E, 0x44, 0x1E, 0x80, 0x07, 0x08, 0x80, 0x01, 0x44, 0x1E, 0x80, 0x0A, 0x02, 0x80, 0x19, 0x42,
+  0x1E, 0x80, 0x1B, 0x05, 0x80, 0x11, 0x43, 0x1E, 0x80, 0x03, 0x01, 0x80, 0x00, 0x44, 0x1E, 0x80,
+  0x0B, 0x3F, 0x3F, 0x14, 0x80, 0x02, 0x44, 0x1E, 0x80, 0x08, 0x07, 0x80, 0x13, 0x44, 0x1E, 0x80,
+  0x01, 0x10, 0x80, 0x11, 0x44, 0x1E, 0x80, 0x04, 0x09, 0x80, 0x18, 0x43, 0x1E, 0x80, 0x12, 0x01,
+  0x80, 0x01, 0x43, 0x1E, 0x80, 0x13, 0x05, 0x80, 0x09, 0x43, 0x1E, 0x80, 0x0C, 0x01, 0x80, 0x08,
+  0x44, 0x1E, 0x80, 0x02, 0x3F, 0x3F, 0x14, 0x80, 0x02, 0x44, 0x1E, 0x80, 0x08, 0x07, 0x80, 0x0F,
+  0x44, 0x1E, 0x80, 0x07, 0x10, 0x80, 0x16, 0x44, 0x1E, 0x80, 0x01, 0x09, 0x80, 0x10, 0x43, 0x1E,
+  0x80, 0x1A, 0x01, 0x80, 0x0A, 0x43, 0x1E, 0x80, 0x0A, 0x05, 0x80, 0x01, 0x43, 0x1E, 0x80, 0x14,
+  0x01, 0x80, 0x10, 0x43, 0x1E, 0x80, 0x1A, 0x3F, 0x3F, 0x15, 0x80, 0x02, 0x44, 0x1E, 0x80, 0x08,
+  0x07, 0x80, 0x09, 0x44, 0x1E, 0x80, 0x0D, 0x10, 0x80, 0x1C, 0x43, 0x1E, 0x80, 0x1B, 0x0A, 0x80,
+  0x08, 0x44, 0x1E, 0x80, 0x03, 0x00, 0x80, 0x12, 0x43, 0x1E, 0x80, 0x02, 0x06, 0x80, 0x18, 0x42,
+  0x1E, 0x80, 0x1C, 0x01, 0x80, 0x18, 0x43, 0x1E, 0x80, 0x11, 0x3F, 0x3F, 0x15, 0x80, 0x02, 0x44,
+  0x1E, 0x80, 0x08, 0x07, 0x80, 0x03, 0x44, 0x1E, 0x80, 0x16, 0x0F, 0x80, 0x06, 0x44, 0x1E, 0x80,
+  0x14, 0x0A, 0x80, 0x00, 0x44, 0x1E, 0x80, 0x0B, 0x00, 0x80, 0x1A, 0x42, 0x1E, 0x80, 0x1A, 0x07,
+  0x80, 0x0F, 0x43, 0x1E, 0x81, 0x05, 0x01, 0x44, 0x1E, 0x80, 0x09, 0x3F, 0x3F, 0x15, 0x80, 0x02,
+  0x44, 0x1E, 0x80, 0x08, 0x08, 0x80, 0x1A, 0x44, 0x1E, 0x80, 0x02, 0x0E, 0x80, 0x12, 0x44, 0x1E,
+  0x80, 0x0C, 0x0B, 0x80, 0x17, 0x43, 0x1E, 0x81, 0x14, 0x03, 0x43, 0x1E, 0x80, 0x11, 0x07, 0x80,
+  0x07, 0x43, 0x1E, 0x81, 0x0D, 0x09, 0x44, 0x1E, 0x80, 0x01, 0x3F, 0x3F, 0x15, 0x80, 0x02, 0x44,
+  0x1E, 0x80, 0x08, 0x08, 0x80, 0x10, 0x44, 0x1E, 0x80, 0x11, 0x0D, 0x81, 0x02, 0x1D, 0x44, 0x1E,
+  0x80, 0x02, 0x0B, 0x80, 0x0F, 0x43, 0x1E, 0x81, 0x1C, 0x0B, 0x43, 0x1E, 0x80, 0x09, 0x07, 0x81,
+  0x00, 0x1D, 0x42, 0x1E, 0x81, 0x16, 0x11, 0x43, 0x1E, 0x80, 0x18, 0x3F, 0x3F, 0x16, 0x80, 0x02,
+  0x44, 0x1E, 0x80, 0x08, 0x08, 0x80, 0x03, 0x45, 0x1E, 0x80, 0x04, 0x0C, 0x80, 0x14, 0x44, 0x1E,
+  0x80, 0x14, 0x0C, 0x80, 0x06, 0x44, 0x1E, 0x80, 0x19, 0x43, 0x1E, 0x80, 0x01, 0x08, 0x80, 0x16,
+  0x42, 0x1E, 0x81, 0x1D, 0x1A, 0x43, 0x1E, 0x80, 0x10, 0x3F, 0x3F, 0x16, 0x80, 0x02, 0x44, 0x1E,
+  0x80, 0x08, 0x09, 0x80, 0x14, 0x44, 0x1E, 0x81, 0x19, 0x01, 0x0A, 0x80, 0x0C, 0x45, 0x1E, 0x80,
+  0x05, 0x0D, 0x80, 0x1D, 0x47, 0x1E, 0x80, 0x18, 0x09, 0x80, 0x0E, 0x48, 0x1E, 0x80, 0x08, 0x3F,
+  0x3F, 0x16, 0x80, 0x02, 0x44, 0x1E, 0x80, 0x08, 0x09, 0x81, 0x03, 0x1D, 0x44, 0x1E, 0x81, 0x19,
+  0x03, 0x08, 0x80, 0x0D, 0x45, 0x1E, 0x80, 0x12, 0x0E, 0x80, 0x15, 0x47, 0x1E, 0x80, 0x0F, 0x09,
+  0x80, 0x05, 0x48, 0x1E, 0x80, 0x00, 0x3F, 0x3F, 0x16, 0x80, 0x02, 0x44, 0x1E, 0x80, 0x08, 0x0A,
+  0x80, 0x0B, 0x45, 0x1E, 0x82, 0x1D, 0x0F, 0x03, 0x04, 0x81, 0x08, 0x17, 0x45, 0x1E, 0x81, 0x1A,
+  0x01, 0x0E, 0x80, 0x0D, 0x47, 0x1E, 0x80, 0x07, 0x0A, 0x80, 0x1D, 0x46, 0x1E, 0x80, 0x17, 0x3F,
+  0x3F, 0x17, 0x80, 0x02, 0x44, 0x1E, 0x80, 0x08, 0x0B, 0x80, 0x11, 0x47, 0x1E, 0x84, 0x1B, 0x17,
+  0x16, 0x18, 0x1D, 0x46, 0x1E, 0x81, 0x1C, 0x04, 0x0F, 0x80, 0x05, 0x46, 0x1E, 0x81, 0x1D, 0x00,
+  0x0A, 0x80, 0x15, 0x46, 0x1E, 0x80, 0x0F, 0x3F, 0x3F, 0x17, 0x80, 0x02, 0x44, 0x1E, 0x80, 0x08,
+  0x0C, 0x80, 0x10, 0x51, 0x1E, 0x81, 0x1B, 0x04, 0x11, 0x80, 0x1C, 0x45, 0x1E, 0x80, 0x16, 0x0B,
+  0x80, 0x0C, 0x46, 0x1E, 0x80, 0x06, 0x3F, 0x3F, 0x17, 0x80, 0x02, 0x44, 0x1E, 0x80, 0x08, 0x0D,
+  0x81, 0x09, 0x1C, 0x4E, 0x1E, 0x81, 0x14, 0x01, 0x12, 0x80, 0x14, 0x45, 0x1E, 0x80, 0x0E, 0x0B,
+  0x80, 0x04, 0x45, 0x1E, 0x80, 0x1D, 0x3F, 0x3F, 0x18, 0x80, 0x02, 0x44, 0x1E, 0x80, 0x08, 0x0E,
+  0x82, 0x00, 0x0E, 0x1B, 0x4A, 0x1E, 0x81, 0x15, 0x07, 0x14, 0x80, 0x0C, 0x45, 0x1E, 0x80, 0x05,
+  0x0C, 0x80, 0x1B, 0x44, 0x1E, 0x80, 0x15, 0x3F, 0x3F, 0x31, 0x83, 0x05, 0x0D, 0x13, 0x17, 0x41,
+  0x19, 0x84, 0x18, 0x15, 0x11, 0x0A, 0x01, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0B, 0x44, 0x11, 0x80, 0x05, 0x3F, 0x3F, 0x3F, 0x28,
+  0x80, 0x00, 0x44, 0x1E, 0x80, 0x0A, 0x3F, 0x3F, 0x3F, 0x28, 0x80, 0x00, 0x44, 0x1E, 0x80, 0x0A,
+  0x3F, 0x3F, 0x3F, 0x28, 0x80, 0x00, 0x44, 0x1E, 0x80, 0x0A, 0x3F, 0x04, 0x44, 0x03, 0x80, 0x00,
+  0x10, 0x80, 0x01, 0x43, 0x03, 0x80, 0x02, 0x3F, 0x3F, 0x06, 0x80, 0x00, 0x44, 0x1E, 0x80, 0x0A,
+  0x3F, 0x03, 0x80, 0x01, 0x44, 0x1E, 0x80, 0x09, 0x10, 0x80, 0x10, 0x43, 0x1E, 0x80, 0x1A, 0x3F,
+  0x3F, 0x06, 0x80, 0x00, 0x44, 0x1E, 0x80, 0x0A, 0x3F, 0x03, 0x80, 0x01, 0x44, 0x1E, 0x80, 0x09,
+  0x10, 0x80, 0x10, 0x43, 0x1E, 0x80, 0x1A, 0x3F, 0x3F, 0x06, 0x80, 0x00, 0x44, 0x1E, 0x80, 0x0A,
+  0x3F, 0x03, 0x80, 0x01, 0x44, 0x1E, 0x80, 0x09, 0x10, 0x80, 0x10, 0x43, 0x1E, 0x80, 0x1A, 0x3F,
+  0x3F, 0x06, 0x80, 0x00, 0x44, 0x1E, 0x80, 0x0A, 0x3F, 0x03, 0x80, 0x01, 0x44, 0x1E, 0x80, 0x09,
+  0x10, 0x80, 0x10, 0x43, 0x1E, 0x80, 0x1A, 0x3F, 0x3F, 0x06, 0x80, 0x00, 0x44, 0x1E, 0x80, 0x0A,
+  0x3F, 0x03, 0x80, 0x01, 0x44, 0x1E, 0x80, 0x09, 0x10, 0x80, 0x10, 0x43, 0x1E, 0x80, 0x1A, 0x3F,
+  0x3F, 0x06, 0x80, 0x00, 0x44, 0x1E, 0x80, 0x0A, 0x3F, 0x03, 0x80, 0x01, 0x44, 0x1E, 0x80, 0x09,
+  0x10, 0x80, 0x10, 0x43, 0x1E, 0x80, 0x1A, 0x3F, 0x3F, 0x06, 0x80, 0x00, 0x44, 0x1E, 0x80, 0x0A,
+  0x3F, 0x03, 0x80, 0x01, 0x44, 0x1E, 0x80, 0x09, 0x10, 0x80, 0x10, 0x43, 0x1E, 0x80, 0x1A, 0x3F,
+  0x3F, 0x06, 0x80, 0x00, 0x44, 0x1E, 0x80, 0x0A, 0x3F, 0x03, 0x80, 0x01, 0x44, 0x1E, 0x80, 0x09,
+  0x10, 0x80, 0x10, 0x43, 0x1E, 0x80, 0x1A, 0x3F, 0x3F, 0x06, 0x80, 0x00, 0x44, 0x1E, 0x80, 0x0A,
+  0x05, 0x82, 0x06, 0x0C, 0x10, 0x41, 0x11, 0x82, 0x0E, 0x09, 0x01, 0x17, 0x84, 0x00, 0x05, 0x0A,
+  0x0E, 0x10, 0x41, 0x11, 0x83, 0x10, 0x0C, 0x08, 0x02, 0x12, 0x80, 0x01, 0x44, 0x1E, 0x80, 0x09,
+  0x10, 0x80, 0x10, 0x43, 0x1E, 0x80, 0x1A, 0x1A, 0x83, 0x02, 0x09, 0x0D, 0x10, 0x41, 0x11, 0x82,
+  0x0F, 0x0B, 0x05, 0x1E, 0x82, 0x05, 0x0B, 0x0F, 0x41, 0x11, 0x81, 0x0F, 0x0A, 0x3C, 0x80, 0x00,
+  0x44, 0x1E, 0x80, 0x0A, 0x02, 0x82, 0x02, 0x10, 0x1C, 0x47, 0x1E, 0x81, 0x16, 0x08, 0x12, 0x82,
+  0x08, 0x10, 0x18, 0x4A, 0x1E, 0x82, 0x19, 0x0D, 0x01, 0x0C, 0x43, 0x19, 0x44, 0x1E, 0x80, 0x1B,
+  0x49, 0x19, 0x80, 0x0A, 0x01, 0x80, 0x0C, 0x42, 0x19, 0x80, 0x1C, 0x44, 0x1E, 0x49, 0x19, 0x80,
+  0x18, 0x0C, 0x82, 0x02, 0x0F, 0x1A, 0x48, 0x1E, 0x82, 0x1C, 0x12, 0x04, 0x0E, 0x80, 0x04, 0x44,
+  0x19, 0x80, 0x03, 0x02, 0x82, 0x02, 0x10, 0x1B, 0x45, 0x1E, 0x80, 0x1D, 0x00, 0x81, 0x00, 0x18,
+  0x43, 0x19, 0x80, 0x10, 0x12, 0x80, 0x03, 0x44, 0x19, 0x80, 0x0D, 0x1A, 0x80, 0x00, 0x44, 0x1E,
+  0x80, 0x0A, 0x01, 0x81, 0x0B, 0x1D, 0x4B, 0x1E, 0x81, 0x15, 0x01, 0x0D, 0x82, 0x04, 0x13, 0x1D,
+  0x4F, 0x1E, 0x81, 0x1D, 0x0D, 0x0A, 0x80, 0x00, 0x53, 0x1E, 0x80, 0x0D, 0x01, 0x80, 0x0F, 0x53,
+  0x1E, 0x0A, 0x81, 0x01, 0x11, 0x4E, 0x1E, 0x81, 0x12, 0x01, 0x0C, 0x80, 0x06, 0x44, 0x1E, 0x80,
+  0x05, 0x01, 0x81, 0x0C, 0x1D, 0x48, 0x1E, 0x01, 0x80, 0x14, 0x43, 0x1E, 0x81, 0x1D, 0x00, 0x11,
+  0x80, 0x0F, 0x44, 0x1E, 0x80, 0x04, 0x1A, 0x80, 0x00, 0x44, 0x1E, 0x80, 0x0A, 0x00, 0x80, 0x10,
+  0x4E, 0x1E, 0x81, 0x1B, 0x03, 0x0C, 0x80, 0x0B, 0x53, 0x1E, 0x81, 0x15, 0x00, 0x08, 0x80, 0x00,
+  0x53, 0x1E, 0x80, 0x0D, 0x01, 0x80, 0x0F, 0x53, 0x1E, 0x09, 0x81, 0x06, 0x1B, 0x50, 0x1E, 0x81,
+  0x1A, 0x04, 0x0B, 0x80, 0x06, 0x44, 0x1E, 0x80, 0x05, 0x00, 0x80, 0x12, 0x4A, 0x1E, 0x01, 0x80,
+  0x07, 0x44, 0x1E, 0x80, 0x0C, 0x11, 0x80, 0x1C, 0x43, 0x1E, 0x80, 0x17, 0x1B, 0x80, 0x00, 0x44,
+  0x1E, 0x81, 0x0A, 0x0D, 0x46, 0x1E, 0x81, 0x1C, 0x1D, 0x47, 0x1E, 0x81, 0x1B, 0x02, 0x0B, 0x80,
+  0x0B, 0x54, 0x1E, 0x80, 0x16, 0x08, 0x80, 0x00, 0x53, 0x1E, 0x80, 0x0D, 0x01, 0x80, 0x0F, 0x53,
+  0x1E, 0x08, 0x80, 0x09, 0x53, 0x1E, 0x81, 0x1C, 0x04, 0x0A, 0x80, 0x06, 0x44, 0x1E, 0x81, 0x05,
+  0x10, 0x4B, 0x1E, 0x02, 0x80, 0x1A, 0x43, 0x1E, 0x80, 0x19, 0x10, 0x80, 0x09, 0x44, 0x1E, 0x80,
+  0x0B, 0x1B, 0x80, 0x00, 0x44, 0x1E, 0x80, 0x11, 0x43, 0x1E, 0x82, 0x1A, 0x0C, 0x03, 0x02, 0x82,
+  0x02, 0x0C, 0x19, 0x45, 0x1E, 0x80, 0x18, 0x0B, 0x80, 0x0B, 0x43, 0x1E, 0x84, 0x15, 0x0E, 0x08,
+  0x03, 0x01, 0x01, 0x84, 0x00, 0x03, 0x0A, 0x13, 0x1D, 0x45, 0x1E, 0x80, 0x0E, 0x08, 0x42, 0x0B,
+  0x80, 0x0C, 0x44, 0x1E, 0x80, 0x11, 0x49, 0x0B, 0x80, 0x04, 0x01, 0x80, 0x05, 0x42, 0x0B, 0x80,
+  0x16, 0x43, 0x1E, 0x80, 0x1C, 0x49, 0x0B, 0x80, 0x0A, 0x07, 0x80, 0x07, 0x46, 0x1E, 0x83, 0x16,
+  0x0C, 0x04, 0x01, 0x01, 0x82, 0x02, 0x0A, 0x14, 0x45, 0x1E, 0x81, 0x1A, 0x01, 0x09, 0x80, 0x06,
+  0x44, 0x1E, 0x80, 0x0E, 0x43, 0x1E, 0x83, 0x1D, 0x14, 0x0C, 0x08, 0x41, 0x06, 0x82, 0x0B, 0x12,
+  0x1C, 0x02, 0x80, 0x0D, 0x44, 0x1E, 0x80, 0x05, 0x0F, 0x80, 0x16, 0x43, 0x1E, 0x81, 0x1C, 0x00,
+  0x1B, 0x80, 0x00, 0x48, 0x1E, 0x80, 0x10, 0x08, 0x80, 0x0E, 0x45, 0x1E, 0x80, 0x0E, 0x0A, 0x84,
+  0x0B, 0x1E, 0x17, 0x0A, 0x00, 0x0A, 0x81, 0x01, 0x13, 0x45, 0x1E, 0x80, 0x02, 0x0A, 0x80, 0x01,
+  0x44, 0x1E, 0x80, 0x09, 0x10, 0x80, 0x10, 0x43, 0x1E, 0x80, 0x1A, 0x11, 0x81, 0x02, 0x1C, 0x44,
+  0x1E, 0x81, 0x19, 0x05, 0x08, 0x81, 0x05, 0x1A, 0x44, 0x1E, 0x80, 0x13, 0x09, 0x80, 0x06, 0x48,
+  0x1E, 0x81, 0x11, 0x01, 0x06, 0x80, 0x00, 0x02, 0x81, 0x01, 0x1D, 0x43, 0x1E, 0x80, 0x12, 0x0E,
+  0x80, 0x03, 0x44, 0x1E, 0x80, 0x11, 0x1C, 0x80, 0x00, 0x47, 0x1E, 0x80, 0x0E, 0x0A, 0x80, 0x0C,
+  0x44, 0x1E, 0x81, 0x1D, 0x02, 0x09, 0x41, 0x06, 0x0F, 0x80, 0x0E, 0x44, 0x1E, 0x80, 0x11, 0x0A,
+  0x80, 0x01, 0x44, 0x1E, 0x80, 0x09, 0x10, 0x80, 0x10, 0x43, 0x1E, 0x80, 0x1A, 0x11, 0x80, 0x15,
+  0x44, 0x1E, 0x81, 0x14, 0x00, 0x0A, 0x81, 0x01, 0x19, 0x44, 0x1E, 0x80, 0x05, 0x08, 0x80, 0x06,
+  0x47, 0x1E, 0x80, 0x0A, 0x0D, 0x80, 0x12, 0x43, 0x1E, 0x81, 0x1D, 0x00, 0x0D, 0x80, 0x0F, 0x44,
+  0x1E, 0x80, 0x04, 0x1C, 0x80, 0x00, 0x46, 0x1E, 0x80, 0x15, 0x0C, 0x80, 0x13, 0x44, 0x1E, 0x80,
+  0x10, 0x1C, 0x80, 0x14, 0x43, 0x1E, 0x80, 0x1C, 0x0A, 0x80, 0x01, 0x44, 0x1E, 0x80, 0x09, 0x10,
+  0x80, 0x10, 0x43, 0x1E, 0x80, 0x1A, 0x10, 0x80, 0x07, 0x44, 0x1E, 0x80, 0x17, 0x0D, 0x81, 0x03,
+  0x1D, 0x43, 0x1E, 0x80, 0x15, 0x08, 0x80, 0x06, 0x46, 0x1E, 0x80, 0x0C, 0x0E, 0x80, 0x05, 0x44,
+  0x1E, 0x80, 0x0C, 0x0D, 0x80, 0x1B, 0x43, 0x1E, 0x80, 0x17, 0x1D, 0x80, 0x00, 0x46, 0x1E, 0x80,
+  0x03, 0x0C, 0x81, 0x02, 0x1D, 0x43, 0x1E, 0x81, 0x1D, 0x00, 0x1B, 0x80, 0x02, 0x44, 0x1E, 0x80,
+  0x06, 0x09, 0x80, 0x01, 0x44, 0x1E, 0x80, 0x09, 0x10, 0x80, 0x10, 0x43, 0x1E, 0x80, 0x1A, 0x10,
+  0x80, 0x16, 0x44, 0x1E, 0x80, 0x03, 0x0E, 0x80, 0x0D, 0x44, 0x1E, 0x80, 0x02, 0x07, 0x80, 0x06,
+  0x45, 0x1E, 0x80, 0x17, 0x10, 0x80, 0x18, 0x43, 0x1E, 0x80, 0x18, 0x0C, 0x80, 0x09, 0x44, 0x1E,
+  0x80, 0x0A, 0x1D, 0x80, 0x00, 0x45, 0x1E, 0x80, 0x12, 0x0E, 0x80, 0x10, 0x44, 0x1E, 0x80, 0x09,
+  0x1C, 0x80, 0x18, 0x43, 0x1E, 0x80, 0x0D, 0x09, 0x80, 0x01, 0x44, 0x1E, 0x80, 0x09, 0x10, 0x80,
+  0x10, 0x43, 0x1E, 0x80, 0x1A, 0x0F, 0x80, 0x02, 0x44, 0x1E, 0x80, 0x11, 0x0F, 0x81, 0x00, 0x1D,
+  0x43, 0x1E, 0x80, 0x0B, 0x07, 0x80, 0x06, 0x45, 0x1E, 0x80, 0x08, 0x10, 0x80, 0x0B, 0x44, 0x1E,
+  0x80, 0x05, 0x0B, 0x80, 0x16, 0x43, 0x1E, 0x81, 0x1C, 0x00, 0x1D, 0x80, 0x00, 0x45, 0x1E, 0x80,
+  0x07, 0x0E, 0x80, 0x05, 0x44, 0x1E, 0x80, 0x11, 0x1C, 0x80, 0x12, 0x43, 0x1E, 0x80, 0x13, 0x09,
+  0x80, 0x01, 0x44, 0x1E, 0x80, 0x09, 0x10, 0x80, 0x10, 0x43, 0x1E, 0x80, 0x1A, 0x0F, 0x80, 0x0C,
+  0x44, 0x1E, 0x80, 0x05, 0x10, 0x80, 0x15, 0x43, 0x1E, 0x80, 0x13, 0x07, 0x80, 0x06, 0x44, 0x1E,
+  0x80, 0x1B, 0x11, 0x81, 0x00, 0x1D, 0x43, 0x1E, 0x80, 0x12, 0x0A, 0x80, 0x03, 0x44, 0x1E, 0x80,
+  0x10, 0x1E, 0x80, 0x00, 0x44, 0x1E, 0x80, 0x1D, 0x10, 0x80, 0x1B, 0x43, 0x1E, 0x80, 0x19, 0x1C,
+  0x80, 0x0F, 0x43, 0x1E, 0x80, 0x17, 0x09, 0x80, 0x01, 0x44, 0x1E, 0x80, 0x09, 0x10, 0x80, 0x10,
+  0x43, 0x1E, 0x80, 0x1A, 0x0F, 0x80, 0x15, 0x43, 0x1E, 0x80, 0x1B, 0x11, 0x80, 0x0E, 0x43, 0x1E,
+  0x80, 0x19, 0x07, 0x80, 0x06, 0x44, 0x1E, 0x80, 0x14, 0x12, 0x80, 0x11, 0x43, 0x1E, 0x81, 0x1D,
+  0x00, 0x09, 0x80, 0x0F, 0x44, 0x1E, 0x80, 0x04, 0x1E, 0x80, 0x00, 0x44, 0x1E, 0x80, 0x17, 0x10,
+  0x80, 0x14, 0x44, 0x1E, 0x0F, 0x84, 0x06, 0x0B, 0x0F, 0x12, 0x14, 0x47, 0x15, 0x80, 0x1A, 0x43,
+  0x1E, 0x80, 0x1A, 0x09, 0x80, 0x01, 0x44, 0x1E, 0x80, 0x09, 0x10, 0x80, 0x10, 0x43, 0x1E, 0x80,
+  0x1A, 0x0F, 0x80, 0x1B, 0x43, 0x1E, 0x80, 0x15, 0x11, 0x80, 0x0A, 0x43, 0x1E, 0x80, 0x1D, 0x07,
+  0x80, 0x06, 0x44, 0x1E, 0x80, 0x0D, 0x12, 0x80, 0x04, 0x44, 0x1E, 0x80, 0x0C, 0x09, 0x80, 0x1B,
+  0x43, 0x1E, 0x80, 0x17, 0x1F, 0x80, 0x00, 0x44, 0x1E, 0x80, 0x11, 0x10, 0x80, 0x0F, 0x44, 0x1E,
+  0x80, 0x03, 0x0B, 0x82, 0x09, 0x15, 0x1D, 0x51, 0x1E, 0x80, 0x1B, 0x09, 0x80, 0x01, 0x44, 0x1E,
+  0x80, 0x09, 0x10, 0x80, 0x10, 0x43, 0x1E, 0x80, 0x1A, 0x0E, 0x80, 0x00, 0x44, 0x1E, 0x80, 0x15,
+  0x43, 0x08, 0x4D, 0x09, 0x80, 0x0F, 0x44, 0x1E, 0x80, 0x00, 0x06, 0x80, 0x06, 0x44, 0x1E, 0x80,
+  0x09, 0x13, 0x80, 0x16, 0x43, 0x1E, 0x80, 0x18, 0x08, 0x80, 0x09, 0x44, 0x1E, 0x80, 0x0A, 0x1F,
+  0x80, 0x00, 0x44, 0x1E, 0x80, 0x0E, 0x10, 0x80, 0x0B, 0x44, 0x1E, 0x80, 0x06, 0x09, 0x81, 0x08,
+  0x1A, 0x54, 0x1E, 0x80, 0x1B, 0x09, 0x80, 0x01, 0x44, 0x1E, 0x80, 0x09, 0x10, 0x80, 0x10, 0x43,
+  0x1E, 0x80, 0x1A, 0x0E, 0x80, 0x04, 0x5D, 0x1E, 0x80, 0x02, 0x06, 0x80, 0x06, 0x44, 0x1E, 0x80,
+  0x07, 0x13, 0x80, 0x09, 0x44, 0x1E, 0x80, 0x05, 0x07, 0x80, 0x16, 0x43, 0x1E, 0x80, 0x1C, 0x20,
+  0x80, 0x00, 0x44, 0x1E, 0x80, 0x0C, 0x10, 0x80, 0x0A, 0x44, 0x1E, 0x80, 0x07, 0x08, 0x80, 0x11,
+  0x56, 0x1E, 0x80, 0x1C, 0x09, 0x80, 0x01, 0x44, 0x1E, 0x80, 0x09, 0x10, 0x80, 0x10, 0x43, 0x1E,
+  0x80, 0x1A, 0x0E, 0x80, 0x06, 0x5D, 0x1E, 0x80, 0x03, 0x06, 0x80, 0x06, 0x44, 0x1E, 0x80, 0x05,
+  0x14, 0x80, 0x1B, 0x43, 0x1E, 0x80, 0x12, 0x06, 0x80, 0x03, 0x44, 0x1E, 0x80, 0x10, 0x20, 0x80,
+  0x00, 0x44, 0x1E, 0x80, 0x0B, 0x10, 0x80, 0x08, 0x44, 0x1E, 0x80, 0x08, 0x07, 0x80, 0x10, 0x47,
+  0x1E, 0x84, 0x1C, 0x17, 0x13, 0x11, 0x10, 0x45, 0x0F, 0x80, 0x16, 0x43, 0x1E, 0x80, 0x1C, 0x09,
+  0x80, 0x01, 0x44, 0x1E, 0x80, 0x09, 0x10, 0x80, 0x10, 0x43, 0x1E, 0x80, 0x1A, 0x0E, 0x80, 0x07,
+  0x5D, 0x1E, 0x80, 0x03, 0x06, 0x80, 0x06, 0x44, 0x1E, 0x80, 0x05, 0x14, 0x80, 0x0F, 0x43, 0x1E,
+  0x81, 0x1D, 0x00, 0x05, 0x80, 0x0F, 0x44, 0x1E, 0x80, 0x03, 0x20, 0x80, 0x00, 0x44, 0x1E, 0x80,
+  0x0C, 0x10, 0x80, 0x09, 0x44, 0x1E, 0x80, 0x07, 0x06, 0x80, 0x08, 0x45, 0x1E, 0x82, 0x18, 0x0B,
+  0x02, 0x0A, 0x80, 0x0E, 0x43, 0x1E, 0x80, 0x1C, 0x09, 0x80, 0x01, 0x44, 0x1E, 0x80, 0x09, 0x10,
+  0x80, 0x10, 0x43, 0x1E, 0x80, 0x1A, 0x0E, 0x80, 0x07, 0x44, 0x1E, 0x80, 0x1C, 0x57, 0x1B, 0x80,
+  0x02, 0x06, 0x80, 0x06, 0x44, 0x1E, 0x80, 0x05, 0x14, 0x80, 0x02, 0x44, 0x1E, 0x80, 0x0C, 0x05,
+  0x80, 0x1B, 0x43, 0x1E, 0x80, 0x16, 0x21, 0x80, 0x00, 0x44, 0x1E, 0x80, 0x0E, 0x10, 0x80, 0x0B,
+  0x44, 0x1E, 0x80, 0x06, 0x06, 0x80, 0x19, 0x44, 0x1E, 0x80, 0x0E, 0x0D, 0x80, 0x10, 0x43, 0x1E,
+  0x80, 0x1C, 0x09, 0x80, 0x01, 0x44, 0x1E, 0x80, 0x09, 0x10, 0x80, 0x10, 0x43, 0x1E, 0x80, 0x1A,
+  0x0E, 0x80, 0x06, 0x44, 0x1E, 0x80, 0x0C, 0x1F, 0x80, 0x06, 0x44, 0x1E, 0x80, 0x05, 0x15, 0x80,
+  0x15, 0x43, 0x1E, 0x80, 0x18, 0x04, 0x80, 0x09, 0x44, 0x1E, 0x80, 0x0A, 0x21, 0x80, 0x00, 0x44,
+  0x1E, 0x80, 0x10, 0x10, 0x80, 0x0D, 0x44, 0x1E, 0x80, 0x03, 0x05, 0x80, 0x05, 0x44, 0x1E, 0x80,
+  0x11, 0x0E, 0x80, 0x12, 0x43, 0x1E, 0x80, 0x1C, 0x09, 0x80, 0x01, 0x44, 0x1E, 0x80, 0x09, 0x10,
+  0x80, 0x10, 0x43, 0x1E, 0x80, 0x1A, 0x0E, 0x80, 0x03, 0x44, 0x1E, 0x80, 0x10, 0x1F, 0x80, 0x06,
+  0x44, 0x1E, 0x80, 0x05, 0x15, 0x80, 0x08, 0x44, 0x1E, 0x80, 0x05, 0x03, 0x80, 0x16, 0x43, 0x1E,
+  0x80, 0x1C, 0x22, 0x80, 0x00, 0x44, 0x1E, 0x80, 0x15, 0x10, 0x80, 0x13, 0x44, 0x1E, 0x80, 0x00,
+  0x05, 0x80, 0x0E, 0x44, 0x1E, 0x80, 0x01, 0x0E, 0x80, 0x16, 0x43, 0x1E, 0x80, 0x1C, 0x09, 0x80,
+  0x01, 0x44, 0x1E, 0x80, 0x09, 0x10, 0x80, 0x10, 0x43, 0x1E, 0x80, 0x1A, 0x0F, 0x44, 0x1E, 0x80,
+  0x15, 0x1F, 0x80, 0x06, 0x44, 0x1E, 0x80, 0x05, 0x16, 0x80, 0x1A, 0x43, 0x1E, 0x80, 0x12, 0x02,
+  0x80, 0x03, 0x44, 0x1E, 0x80, 0x10, 0x22, 0x80, 0x00, 0x44, 0x1E, 0x80, 0x1B, 0x10, 0x80, 0x19,
+  0x43, 0x1E, 0x80, 0x1A, 0x06, 0x80, 0x14, 0x43, 0x1E, 0x80, 0x17, 0x0F, 0x80, 0x1D, 0x43, 0x1E,
+  0x80, 0x1C, 0x09, 0x80, 0x01, 0x44, 0x1E, 0x80, 0x09, 0x10, 0x80, 0x10, 0x43, 0x1E, 0x80, 0x1A,
+  0x0F, 0x80, 0x18, 0x43, 0x1E, 0x80, 0x1D, 0x1F, 0x80, 0x06, 0x44, 0x1E, 0x80, 0x05, 0x16, 0x80,
+  0x0D, 0x43, 0x1E, 0x81, 0x1D, 0x00, 0x01, 0x80, 0x0F, 0x44, 0x1E, 0x80, 0x03, 0x22, 0x80, 0x00,
+  0x45, 0x1E, 0x80, 0x04, 0x0E, 0x80, 0x02, 0x44, 0x1E, 0x80, 0x13, 0x06, 0x80, 0x17, 0x43, 0x1E,
+  0x80, 0x13, 0x0E, 0x80, 0x05, 0x44, 0x1E, 0x80, 0x1C, 0x09, 0x80, 0x01, 0x44, 0x1E, 0x80, 0x0A,
+  0x10, 0x80, 0x10, 0x43, 0x1E, 0x80, 0x1B, 0x0F, 0x80, 0x11, 0x44, 0x1E, 0x80, 0x07, 0x1E, 0x80,
+  0x06, 0x44, 0x1E, 0x80, 0x05, 0x16, 0x80, 0x01, 0x44, 0x1E, 0x80, 0x0B, 0x01, 0x80, 0x1B, 0x43,
+  0x1E, 0x80, 0x16, 0x23, 0x80, 0x00, 0x45, 0x1E, 0x80, 0x0F, 0x0E, 0x80, 0x0D, 0x44, 0x1E, 0x80,
+  0x0B, 0x06, 0x80, 0x18, 0x43, 0x1E, 0x80, 0x12, 0x0E, 0x80, 0x12, 0x44, 0x1E, 0x80, 0x1C, 0x09,
+  0x80, 0x00, 0x44, 0x1E, 0x80, 0x0B, 0x10, 0x80, 0x0F, 0x43, 0x1E, 0x80, 0x1C, 0x0F, 0x80, 0x07,
+  0x44, 0x1E, 0x80, 0x15, 0x1E, 0x80, 0x06, 0x44, 0x1E, 0x80, 0x05, 0x17, 0x80, 0x13, 0x43, 0x1E,
+  0x80, 0x18, 0x00, 0x80, 0x09, 0x44, 0x1E, 0x80, 0x09, 0x23, 0x80, 0x00, 0x45, 0x1E, 0x81, 0x1C,
+  0x00, 0x0D, 0x80, 0x1A, 0x44, 0x1E, 0x80, 0x01, 0x06, 0x80, 0x16, 0x43, 0x1E, 0x80, 0x16, 0x0D,
+  0x81, 0x02, 0x1D, 0x44, 0x1E, 0x80, 0x1C, 0x0A, 0x44, 0x1E, 0x80, 0x0E, 0x10, 0x80, 0x0D, 0x44,
+  0x1E, 0x10, 0x80, 0x1A, 0x44, 0x1E, 0x80, 0x06, 0x1D, 0x80, 0x06, 0x44, 0x1E, 0x80, 0x05, 0x17,
+  0x80, 0x06, 0x44, 0x1E, 0x81, 0x05, 0x15, 0x43, 0x1E, 0x80, 0x1C, 0x24, 0x80, 0x00, 0x46, 0x1E,
+  0x80, 0x10, 0x0C, 0x80, 0x0E, 0x44, 0x1E, 0x80, 0x14, 0x07, 0x80, 0x13, 0x43, 0x1E, 0x81, 0x1D,
+  0x00, 0x0C, 0x80, 0x16, 0x45, 0x1E, 0x80, 0x1C, 0x0A, 0x80, 0x1A, 0x43, 0x1E, 0x80, 0x13, 0x10,
+  0x80, 0x09, 0x44, 0x1E, 0x80, 0x04, 0x0F, 0x80, 0x0C, 0x44, 0x1E, 0x81, 0x1B, 0x01, 0x1C, 0x80,
+  0x06, 0x44, 0x1E, 0x80, 0x05, 0x18, 0x80, 0x19, 0x43, 0x1E, 0x80, 0x16, 0x44, 0x1E, 0x80, 0x10,
+  0x24, 0x80, 0x00, 0x47, 0x1E, 0x80, 0x07, 0x0A, 0x81, 0x05, 0x1D, 0x44, 0x1E, 0x80, 0x05, 0x07,
+  0x80, 0x0B, 0x44, 0x1E, 0x80, 0x0F, 0x0B, 0x80, 0x10, 0x46, 0x1E, 0x80, 0x1C, 0x0A, 0x80, 0x14,
+  0x43, 0x1E, 0x81, 0x1C, 0x00, 0x0F, 0x80, 0x04, 0x44, 0x1E, 0x80, 0x0E, 0x10, 0x80, 0x1A, 0x44,
+  0x1E, 0x81, 0x18, 0x01, 0x10, 0x81, 0x03, 0x0E, 0x08, 0x80, 0x06, 0x44, 0x1E, 0x80, 0x05, 0x18,
+  0x80, 0x0C, 0x49, 0x1E, 0x80, 0x03, 0x24, 0x80, 0x00, 0x47, 0x1E, 0x81, 0x1D, 0x08, 0x08, 0x81,
+  0x06, 0x1C, 0x44, 0x1E, 0x80, 0x13, 0x08, 0x80, 0x02, 0x45, 0x1E, 0x80, 0x0A, 0x08, 0x81, 0x00,
+  0x12, 0x47, 0x1E, 0x80, 0x1C, 0x0A, 0x80, 0x0D, 0x44, 0x1E, 0x81, 0x13, 0x00, 0x0F, 0x80, 0x1C,
+  0x43, 0x1E, 0x81, 0x1D, 0x08, 0x0F, 0x80, 0x06, 0x45, 0x1E, 0x81, 0x1B, 0x08, 0x0D, 0x83, 0x07,
+  0x14, 0x1E, 0x1A, 0x08, 0x80, 0x06, 0x44, 0x1E, 0x80, 0x05, 0x18, 0x81, 0x00, 0x1D, 0x47, 0x1E,
+  0x80, 0x16, 0x25, 0x80, 0x00, 0x44, 0x1E, 0x80, 0x16, 0x43, 0x1E, 0x81, 0x13, 0x04, 0x04, 0x81,
+  0x04, 0x12, 0x45, 0x1E, 0x81, 0x1B, 0x01, 0x09, 0x80, 0x14, 0x45, 0x1E, 0x81, 0x13, 0x04, 0x04,
+  0x82, 0x02, 0x0C, 0x1B, 0x43, 0x1E, 0x80, 0x14, 0x43, 0x1E, 0x80, 0x1C, 0x0A, 0x80, 0x02, 0x45,
+  0x1E, 0x82, 0x1D, 0x16, 0x11, 0x45, 0x0F, 0x80, 0x06, 0x06, 0x80, 0x11, 0x45, 0x1E, 0x82, 0x1A,
+  0x13, 0x10, 0x44, 0x0F, 0x80, 0x0E, 0x07, 0x80, 0x0C, 0x46, 0x1E, 0x82, 0x18, 0x0B, 0x03, 0x06,
+  0x83, 0x04, 0x0A, 0x12, 0x1C, 0x42, 0x1E, 0x80, 0x1A, 0x08, 0x80, 0x06, 0x44, 0x1E, 0x80, 0x05,
+  0x19, 0x80, 0x11, 0x47, 0x1E, 0x80, 0x09, 0x25, 0x80, 0x00, 0x44, 0x1E, 0x81, 0x0A, 0x14, 0x44,
+  0x1E, 0x84, 0x1B, 0x16, 0x14, 0x16, 0x1A, 0x47, 0x1E, 0x80, 0x06, 0x0A, 0x81, 0x03, 0x1D, 0x46,
+  0x1E, 0x84, 0x1B, 0x16, 0x14, 0x16, 0x1A, 0x45, 0x1E, 0x81, 0x0D, 0x0E, 0x43, 0x1E, 0x80, 0x1C,
+  0x0B, 0x80, 0x12, 0x4D, 0x1E, 0x80, 0x0D, 0x06, 0x81, 0x02, 0x1D, 0x4D, 0x1E, 0x08, 0x80, 0x0D,
+  0x48, 0x1E, 0x85, 0x1C, 0x19, 0x17, 0x16, 0x18, 0x1A, 0x47, 0x1E, 0x80, 0x1A, 0x08, 0x80, 0x06,
+  0x44, 0x1E, 0x80, 0x05, 0x19, 0x80, 0x04, 0x46, 0x1E, 0x80, 0x1C, 0x26, 0x80, 0x00, 0x44, 0x1E,
+  0x82, 0x0A, 0x00, 0x17, 0x4F, 0x1E, 0x80, 0x08, 0x0C, 0x80, 0x08, 0x50, 0x1E, 0x80, 0x10, 0x00,
+  0x80, 0x0E, 0x43, 0x1E, 0x80, 0x1C, 0x0B, 0x81, 0x00, 0x18, 0x4C, 0x1E, 0x80, 0x0D, 0x07, 0x80,
+  0x09, 0x4D, 0x1E, 0x09, 0x81, 0x09, 0x1D, 0x54, 0x1E, 0x80, 0x1A, 0x08, 0x80, 0x06, 0x44, 0x1E,
+  0x80, 0x05, 0x1A, 0x80, 0x17, 0x45, 0x1E, 0x80, 0x0F, 0x26, 0x80, 0x00, 0x44, 0x1E, 0x80, 0x0A,
+  0x00, 0x81, 0x00, 0x14, 0x4C, 0x1E, 0x81, 0x1B, 0x06, 0x0E, 0x81, 0x08, 0x1C, 0x4C, 0x1E, 0x81,
+  0x1D, 0x0B, 0x01, 0x80, 0x0E, 0x43, 0x1E, 0x80, 0x1C, 0x0C, 0x82, 0x00, 0x10, 0x1D, 0x4A, 0x1E,
+  0x80, 0x0D, 0x08, 0x81, 0x06, 0x18, 0x4B, 0x1E, 0x0A, 0x81, 0x03, 0x14, 0x52, 0x1E, 0x81, 0x19,
+  0x0C, 0x08, 0x80, 0x06, 0x44, 0x1E, 0x80, 0x05, 0x1A, 0x80, 0x0A, 0x45, 0x1E, 0x80, 0x03, 0x26,
+  0x80, 0x00, 0x44, 0x1E, 0x80, 0x0A, 0x02, 0x81, 0x09, 0x19, 0x48, 0x1E, 0x82, 0x1D, 0x0F, 0x00,
+  0x10, 0x81, 0x02, 0x12, 0x49, 0x1E, 0x82, 0x1D, 0x12, 0x02, 0x02, 0x80, 0x0E, 0x43, 0x1E, 0x80,
+  0x1C, 0x0E, 0x85, 0x01, 0x0A, 0x12, 0x17, 0x1B, 0x1D, 0x45, 0x1E, 0x80, 0x0D, 0x0A, 0x84, 0x05,
+  0x0E, 0x15, 0x19, 0x1C, 0x46, 0x1E, 0x0C, 0x82, 0x05, 0x12, 0x1C, 0x4C, 0x1E, 0x82, 0x18, 0x0F,
+  0x05, 0x0A, 0x80, 0x06, 0x44, 0x1E, 0x80, 0x05, 0x1A, 0x80, 0x00, 0x44, 0x1E, 0x80, 0x16, 0x33,
+  0x83, 0x05, 0x0E, 0x14, 0x17, 0x41, 0x19, 0x83, 0x16, 0x11, 0x09, 0x00, 0x14, 0x8A, 0x01, 0x0A,
+  0x12, 0x16, 0x18, 0x19, 0x18, 0x15, 0x10, 0x09, 0x00, 0x3F, 0x0D, 0x8C, 0x06, 0x0D, 0x12, 0x16,
+  0x18, 0x19, 0x18, 0x17, 0x15, 0x11, 0x0C, 0x07, 0x01, 0x2F, 0x80, 0x0A, 0x44, 0x1E, 0x80, 0x09,
+  0x3F, 0x3F, 0x3F, 0x28, 0x80, 0x16, 0x43, 0x1E, 0x80, 0x1B, 0x3F, 0x3F, 0x3F, 0x28, 0x80, 0x03,
+  0x44, 0x1E, 0x80, 0x0F, 0x3F, 0x3F, 0x3F, 0x28, 0x80, 0x11, 0x44, 0x1E, 0x80, 0x02, 0x3F, 0x3F,
+  0x3F, 0x27, 0x81, 0x01, 0x1D, 0x43, 0x1E, 0x80, 0x15, 0x3F, 0x3F, 0x3F, 0x28, 0x80, 0x11, 0x44,
+  0x1E, 0x80, 0x07, 0x3F, 0x3F, 0x3F, 0x27, 0x80, 0x08, 0x44, 0x1E, 0x80, 0x17, 0x3F, 0x3F, 0x3F,
+  0x22, 0x42, 0x00, 0x82, 0x01, 0x05, 0x11, 0x45, 0x1E, 0x80, 0x07, 0x3F, 0x3F, 0x3F, 0x21, 0x80,
+  0x07, 0x4A, 0x1E, 0x80, 0x14, 0x3F, 0x3F, 0x3F, 0x22, 0x80, 0x07, 0x49, 0x1E, 0x81, 0x1B, 0x01,
+  0x3F, 0x3F, 0x3F, 0x22, 0x80, 0x07, 0x48, 0x1E, 0x81, 0x1A, 0x03, 0x3F, 0x3F, 0x3F, 0x23, 0x80,
+  0x07, 0x46, 0x1E, 0x82, 0x1C, 0x0F, 0x00, 0x3F, 0x3F, 0x3F, 0x24, 0x80, 0x03, 0x43, 0x0E, 0x82,
+  0x0D, 0x0B, 0x05, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x23,
+};
+
+static constexpr ImageAsset low_battery = {
+  240, 240, ImageFormat::RLE_INDEXED, 0x0000,
+  0x0000, low_battery_palette, 31, low_battery_data,
+  sizeof(low_battery_data)};
+
+#endif /* IMAGELIBRARY_LOW_BATTERY_H_ */
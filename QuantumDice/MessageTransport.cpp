@@ -0,0 +1,27 @@
+#include "MessageTransport.hpp"
+
+#include "EspNowSensor.hpp"
+
+void EspNowTransport::begin() {
+    EspNowSensor<message>::Init();
+}
+
+void EspNowTransport::addPeer(uint8_t *address) {
+    EspNowSensor<message>::AddPeer(address);
+}
+
+auto EspNowTransport::send(const message &data, uint8_t *target) -> SendResult {
+    return EspNowSensor<message>::Send(data, target);
+}
+
+auto EspNowTransport::poll(message *data, uint8_t *source, int32_t *rssi) -> bool {
+    return EspNowSensor<message>::Poll(data, source, rssi);
+}
+
+void EspNowTransport::printMacAddress() {
+    EspNowSensor<message>::PrintMacAddress();
+}
+
+void EspNowTransport::getMacAddress(uint8_t *address) {
+    EspNowSensor<message>::GetMacAddress(address);
+}
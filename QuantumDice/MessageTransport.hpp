@@ -0,0 +1,133 @@
+#ifndef MESSAGETRANSPORT_H_
+#define MESSAGETRANSPORT_H_
+
+#include "ScreenStateDefs.hpp"
+#include "SendResult.hpp"
+#include "StateMachine.hpp"
+#include "WireFormat.hpp"
+
+#include <array>
+#include <cstdint>
+
+/*
+   MessageTransport - how the dice talk to each other
+
+   The StateMachine sends and receives its messages through a MessageTransport instead of calling
+   ESP-NOW directly. EspNowTransport is the normal backend. A different transport, for example
+   an in-process one that connects several StateMachines, can be set with
+   StateMachine::setTransport() before begin().
+
+   Usage in main code:
+   stateMachine.setTransport(new EspNowTransport());
+*/
+
+using message_type = enum message_type : uint8_t {
+    MESSAGE_TYPE_WATCH_DOG,
+    MESSAGE_TYPE_MEASUREMENT,
+    MESSAGE_TYPE_ENTANGLE_REQUEST,
+    MESSAGE_TYPE_ENTANGLE_CONFIRM,
+    MESSAGE_TYPE_ENTANGLE_DENIED,
+    MESSAGE_TYPE_TELEPORT_REQUEST,
+    MESSAGE_TYPE_TELEPORT_CONFIRM,
+    MESSAGE_TYPE_TELEPORT_PAYLOAD,
+    MESSAGE_TYPE_TELEPORT_PARTNER
+};
+
+using message = struct message {
+    message_type type;
+
+    union _data {
+        struct _watchDogData {
+            State state;
+        } watchDog;
+
+        struct _measurementData {
+            State          state;
+            MeasuredAxises measureAxis;
+            DiceNumbers    diceNumber;
+            UpSide         upSide;
+        } measurement;
+
+        struct _entangleConfirmData {
+            uint16_t color; // RGB565 color for this entanglement
+        } entangleConfirm;
+
+        struct _teleportRequestData {
+            uint8_t target_dice[6]; // MAC address of dice B (the target for teleportation)
+        } teleportRequest;
+
+        struct _teleportPayloadData {
+            State          state;             // State of dice M to be transferred to B
+            MeasuredAxises measureAxis;       // Measurement axis if observed
+            DiceNumbers    diceNumber;        // Dice number if observed
+            UpSide         upSide;            // Up side if observed
+            uint8_t        entangled_peer[6]; // MAC of N if M is entangled to N
+            uint16_t       color;             // Entanglement color (RGB565)
+        } teleportPayload;
+
+        struct _teleportPartnerData {
+            uint8_t new_partner[6]; // MAC address of B (the new partner for N)
+        } teleportPartner;
+    } data;
+};
+
+/*
+   Wire format of a message
+
+   Frames are packed and only as long as their type needs. The first byte holds WIRE_VERSION in
+   the high nibble and the message_type in the low nibble; a frame with another version, an
+   unknown type or the wrong length for its type is rejected. Then, per type:
+
+     WATCH_DOG         state
+     MEASUREMENT       state, observation
+     ENTANGLE_CONFIRM  color
+     TELEPORT_REQUEST  target_dice
+     TELEPORT_PAYLOAD  state, observation, entangled_peer, color
+     TELEPORT_PARTNER  new_partner
+
+   state is stateId(), observation is two bytes (measureAxis | upSide << 4, diceNumber), colors
+   are little-endian and MAC addresses are 6 bytes. The other types are the header byte alone.
+*/
+
+constexpr uint8_t WIRE_VERSION       = 1;
+constexpr uint8_t MESSAGE_TYPE_COUNT = 9;
+
+template <> struct WireFormat<message> {
+    // Frame length per message_type
+    static constexpr std::array<uint8_t, MESSAGE_TYPE_COUNT> FRAME_SIZES = {2, 4, 1, 3, 1,
+                                                                            7, 1, 12, 7};
+    static constexpr size_t MAX_SIZE = 12;
+
+    static auto encode(const message &data, uint8_t *frame) -> size_t;
+    static auto decode(const uint8_t *frame, size_t length, message &data) -> bool;
+};
+
+class MessageTransport {
+  public:
+    virtual ~MessageTransport() = default;
+
+    // Bring up the radio; called once by StateMachine::begin()
+    virtual void begin() = 0;
+
+    virtual void addPeer(uint8_t *address) = 0;
+
+    virtual auto send(const message &data, uint8_t *target) -> SendResult = 0;
+
+    // Returns false when no message is waiting
+    virtual auto poll(message *data, uint8_t *source, int32_t *rssi) -> bool = 0;
+
+    virtual void printMacAddress() = 0;
+    virtual void getMacAddress(uint8_t *address) = 0;
+};
+
+class EspNowTransport : public MessageTransport {
+  public:
+    void begin() override;
+    void addPeer(uint8_t *address) override;
+    auto send(const message &data, uint8_t *target) -> SendResult override;
+    auto poll(message *data, uint8_t *source, int32_t *rssi) -> bool override;
+    void printMacAddress() override;
+    void getMacAddress(uint8_t *address) override;
+};
+
+#endif /* MESSAGETRANSPORT_H_ */
@@ -0,0 +1,190 @@
+#include "MessageTransport.hpp"
+
+#include <cstring>
+
+static_assert(MESSAGE_TYPE_TELEPORT_PARTNER + 1 == MESSAGE_TYPE_COUNT, "Update the wire format");
+static_assert(STATE_COUNT <= UINT8_MAX, "A state must fit in one byte");
+
+static constexpr auto largestFrame() -> size_t {
+    size_t largest = 0;
+    for (uint8_t size : WireFormat<message>::FRAME_SIZES) {
+        largest = size > largest ? size : largest;
+    }
+    return largest;
+}
+static_assert(largestFrame() == WireFormat<message>::MAX_SIZE, "Update MAX_SIZE");
+
+namespace {
+    constexpr uint8_t OBSERVATION_SIZE = 2;
+    constexpr uint8_t MAC_SIZE         = 6;
+
+    constexpr auto header(message_type type) -> uint8_t {
+        return (WIRE_VERSION << 4) | type;
+    }
+
+    class FrameWriter {
+      public:
+        explicit FrameWriter(uint8_t *frame) : start(frame), out(frame) {}
+
+        void byte(uint8_t value) {
+            *out++ = value;
+        }
+
+        void color(uint16_t value) {
+            byte(value & 0xFF);
+            byte(value >> 8);
+        }
+
+        void mac(const uint8_t *address) {
+            memcpy(out, address, MAC_SIZE);
+            out += MAC_SIZE;
+        }
+
+        void state(State value) {
+            byte(stateId(value));
+        }
+
+        void observation(MeasuredAxises axis, UpSide upSide, DiceNumbers number) {
+            byte(static_cast<uint8_t>(axis) | (static_cast<uint8_t>(upSide) << 4));
+            byte(static_cast<uint8_t>(number));
+        }
+
+        auto length() const -> size_t {
+            return out - start;
+        }
+
+      private:
+        uint8_t *start;
+        uint8_t *out;
+    };
+
+    // The frame length is checked before reading, the reader only validates the values
+    class FrameReader {
+      public:
+        explicit FrameReader(const uint8_t *frame) : in(frame) {}
+
+        auto byte() -> uint8_t {
+            return *in++;
+        }
+
+        auto color() -> uint16_t {
+            uint16_t low = byte();
+            return low | (byte() << 8);
+        }
+
+        void mac(uint8_t *address) {
+            memcpy(address, in, MAC_SIZE);
+            in += MAC_SIZE;
+        }
+
+        auto state() -> State {
+            uint8_t id = byte();
+            valid      = valid && id < STATE_COUNT;
+            return stateFromId(valid ? id : 0);
+        }
+
+        void observation(MeasuredAxises &axis, UpSide &upSide, DiceNumbers &number) {
+            uint8_t packed = byte();
+            uint8_t value  = byte();
+            valid = valid && (packed & 0x0F) <= static_cast<uint8_t>(MeasuredAxises::NA)
+                    && (packed >> 4) <= static_cast<uint8_t>(UpSide::NA)
+                    && value <= static_cast<uint8_t>(DiceNumbers::SIX);
+            axis   = static_cast<MeasuredAxises>(packed & 0x0F);
+            upSide = static_cast<UpSide>(packed >> 4);
+            number = static_cast<DiceNumbers>(value);
+        }
+
+        bool valid = true;
+
+      private:
+        const uint8_t *in;
+    };
+} // namespace
+
+auto WireFormat<message>::encode(const message &data, uint8_t *frame) -> size_t {
+    if (data.type >= MESSAGE_TYPE_COUNT) {
+        return 0;
+    }
+
+    FrameWriter writer(frame);
+    writer.byte(header(data.type));
+    switch (data.type) {
+        case MESSAGE_TYPE_WATCH_DOG:
+            writer.state(data.data.watchDog.state);
+            break;
+        case MESSAGE_TYPE_MEASUREMENT:
+            writer.state(data.data.measurement.state);
+            writer.observation(data.data.measurement.measureAxis, data.data.measurement.upSide,
+                               data.data.measurement.diceNumber);
+            break;
+        case MESSAGE_TYPE_ENTANGLE_CONFIRM:
+            writer.color(data.data.entangleConfirm.color);
+            break;
+        case MESSAGE_TYPE_TELEPORT_REQUEST:
+            writer.mac(data.data.teleportRequest.target_dice);
+            break;
+        case MESSAGE_TYPE_TELEPORT_PAYLOAD:
+            writer.state(data.data.teleportPayload.state);
+            writer.observation(data.data.teleportPayload.measureAxis,
+                               data.data.teleportPayload.upSide,
+                               data.data.teleportPayload.diceNumber);
+            writer.mac(data.data.teleportPayload.entangled_peer);
+            writer.color(data.data.teleportPayload.color);
+            break;
+        case MESSAGE_TYPE_TELEPORT_PARTNER:
+            writer.mac(data.data.teleportPartner.new_partner);
+            break;
+        case MESSAGE_TYPE_ENTANGLE_REQUEST:
+        case MESSAGE_TYPE_ENTANGLE_DENIED:
+        case MESSAGE_TYPE_TELEPORT_CONFIRM:
+            break;
+    }
+    return writer.length();
+}
+
+auto WireFormat<message>::decode(const uint8_t *frame, size_t length, message &data) -> bool {
+    if (length == 0 || (frame[0] >> 4) != WIRE_VERSION) {
+        return false;
+    }
+    uint8_t type = frame[0] & 0x0F;
+    if (type >= MESSAGE_TYPE_COUNT || length != FRAME_SIZES[type]) {
+        return false;
+    }
+
+    memset(&data, 0, sizeof(data));
+    data.type = static_cast<message_type>(type);
+
+    FrameReader reader(frame + 1);
+    switch (data.type) {
+        case MESSAGE_TYPE_WATCH_DOG:
+            data.data.watchDog.state = reader.state();
+            break;
+        case MESSAGE_TYPE_MEASUREMENT:
+            data.data.measurement.state = reader.state();
+            reader.observation(data.data.measurement.measureAxis, data.data.measurement.upSide,
+                               data.data.measurement.diceNumber);
+            break;
+        case MESSAGE_TYPE_ENTANGLE_CONFIRM:
+            data.data.entangleConfirm.color = reader.color();
+            break;
+        case MESSAGE_TYPE_TELEPORT_REQUEST:
+            reader.mac(data.data.teleportRequest.target_dice);
+            break;
+        case MESSAGE_TYPE_TELEPORT_PAYLOAD:
+            data.data.teleportPayload.state = reader.state();
+            reader.observation(data.data.teleportPayload.measureAxis,
+                               data.data.teleportPayload.upSide,
+                               data.data.teleportPayload.diceNumber);
+            reader.mac(data.data.teleportPayload.entangled_peer);
+            data.data.teleportPayload.color = reader.color();
+            break;
+        case MESSAGE_TYPE_TELEPORT_PARTNER:
+            reader.mac(data.data.teleportPartner.new_partner);
+            break;
+        case MESSAGE_TYPE_ENTANGLE_REQUEST:
+        case MESSAGE_TYPE_ENTANGLE_DENIED:
+        case MESSAGE_TYPE_TELEPORT_CONFIRM:
+            break;
+    }
+    return reader.valid;
+}
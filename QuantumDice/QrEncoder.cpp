@@ -0,0 +1,370 @@
+#include "QrEncoder.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+// Error correction level M: codewords and blocks per version, from the QR code specification
+struct QrVersion {
+    uint16_t totalCodewords;
+    uint8_t  ecCodewordsPerBlock;
+    uint8_t  blocks;
+};
+
+constexpr std::array<QrVersion, QrEncoder::MAX_VERSION> VERSIONS = {{
+  {26, 10, 1},
+  {44, 16, 1},
+  {70, 26, 1},
+  {100, 18, 2},
+  {134, 24, 2},
+  {172, 16, 4},
+}};
+
+constexpr uint8_t  MAX_EC_PER_BLOCK = 26;
+constexpr uint8_t  MAX_BLOCKS       = 4;
+constexpr uint8_t  MODE_BYTE        = 0x4;
+constexpr uint8_t  FORMAT_LEVEL_M   = 0x0;
+constexpr uint16_t FORMAT_GENERATOR = 0x537;
+constexpr uint16_t FORMAT_XOR_MASK  = 0x5412;
+constexpr uint16_t GF_POLYNOMIAL    = 0x11D; // x^8 + x^4 + x^3 + x^2 + 1
+constexpr uint8_t  MASK_COUNT       = 8;
+
+// Penalty weights of the mask evaluation
+constexpr uint32_t PENALTY_RUN     = 3;
+constexpr uint32_t PENALTY_BLOCK   = 3;
+constexpr uint32_t PENALTY_FINDER  = 40;
+constexpr uint32_t PENALTY_BALANCE = 10;
+
+// The blocks of a version must all have the same length for the interleaving below
+constexpr auto equalBlocks() -> bool {
+    for (const QrVersion &version : VERSIONS) {
+        uint16_t dataCodewords
+          = version.totalCodewords - (version.ecCodewordsPerBlock * version.blocks);
+        if ((dataCodewords % version.blocks) != 0 || version.blocks > MAX_BLOCKS
+            || version.ecCodewordsPerBlock > MAX_EC_PER_BLOCK
+            || version.totalCodewords > QrEncoder::MAX_CODEWORDS) {
+            return false;
+        }
+    }
+    return true;
+}
+static_assert(equalBlocks(), "Version table does not match the buffers");
+
+// Multiply in GF(2^8)
+static auto gfMultiply(uint8_t x, uint8_t y) -> uint8_t {
+    uint16_t product = 0;
+    for (int8_t bit = 7; bit >= 0; bit--) {
+        product = (product << 1) ^ ((product >> 7) * GF_POLYNOMIAL);
+        product ^= ((y >> bit) & 1) * x;
+    }
+    return static_cast<uint8_t>(product);
+}
+
+// Reed-Solomon generator polynomial of the given degree, highest coefficient (always 1) omitted
+static void rsGenerator(uint8_t degree, uint8_t *generator) {
+    memset(generator, 0, degree);
+    generator[degree - 1] = 1;
+    uint8_t root          = 1;
+    for (uint8_t i = 0; i < degree; i++) {
+        for (uint8_t j = 0; j < degree; j++) {
+            generator[j] = gfMultiply(generator[j], root);
+            if (j + 1 < degree) {
+                generator[j] ^= generator[j + 1];
+            }
+        }
+        root = gfMultiply(root, 0x02);
+    }
+}
+
+static void rsRemainder(const uint8_t *data, uint16_t length, const uint8_t *generator,
+                        uint8_t degree, uint8_t *remainder) {
+    memset(remainder, 0, degree);
+    for (uint16_t i = 0; i < length; i++) {
+        uint8_t factor = data[i] ^ remainder[0];
+        memmove(remainder, remainder + 1, degree - 1);
+        remainder[degree - 1] = 0;
+        for (uint8_t j = 0; j < degree; j++) {
+            remainder[j] ^= gfMultiply(generator[j], factor);
+        }
+    }
+}
+
+void QrEncoder::setBit(Grid &grid, uint8_t x, uint8_t y, bool value) {
+    uint16_t index = (y * symbolSize) + x;
+    if (value) {
+        grid[index / 8] |= (1 << (index % 8));
+    } else {
+        grid[index / 8] &= ~(1 << (index % 8));
+    }
+}
+
+void QrEncoder::setFunction(uint8_t x, uint8_t y, bool dark) {
+    setBit(modules, x, y, dark);
+    setBit(isFunction, x, y, true);
+}
+
+// 7x7 finder with its light separator
+void QrEncoder::drawFinder(uint8_t centerX, uint8_t centerY) {
+    for (int8_t dy = -4; dy <= 4; dy++) {
+        for (int8_t dx = -4; dx <= 4; dx++) {
+            int16_t x = centerX + dx;
+            int16_t y = centerY + dy;
+            if (x < 0 || y < 0 || x >= symbolSize || y >= symbolSize) {
+                continue;
+            }
+            int8_t distance = static_cast<int8_t>(std::max(abs(dx), abs(dy)));
+            setFunction(x, y, distance != 2 && distance != 4);
+        }
+    }
+}
+
+void QrEncoder::drawAlignment(uint8_t centerX, uint8_t centerY) {
+    for (int8_t dy = -2; dy <= 2; dy++) {
+        for (int8_t dx = -2; dx <= 2; dx++) {
+            setFunction(centerX + dx, centerY + dy, std::max(abs(dx), abs(dy)) != 1);
+        }
+    }
+}
+
+void QrEncoder::drawFormat(uint8_t mask) {
+    uint16_t data      = (FORMAT_LEVEL_M << 3) | mask;
+    uint16_t remainder = data;
+    for (uint8_t i = 0; i < 10; i++) {
+        remainder = (remainder << 1) ^ ((remainder >> 9) * FORMAT_GENERATOR);
+    }
+    uint16_t bits = ((data << 10) | remainder) ^ FORMAT_XOR_MASK;
+    auto     bit  = [bits](uint8_t i) { return ((bits >> i) & 1) != 0; };
+
+    // Around the top left finder
+    for (uint8_t i = 0; i <= 5; i++) {
+        setFunction(8, i, bit(i));
+    }
+    setFunction(8, 7, bit(6));
+    setFunction(8, 8, bit(7));
+    setFunction(7, 8, bit(8));
+    for (uint8_t i = 9; i < 15; i++) {
+        setFunction(14 - i, 8, bit(i));
+    }
+
+    // Copy next to the other two finders
+    for (uint8_t i = 0; i < 8; i++) {
+        setFunction(symbolSize - 1 - i, 8, bit(i));
+    }
+    for (uint8_t i = 8; i < 15; i++) {
+        setFunction(8, symbolSize - 15 + i, bit(i));
+    }
+    setFunction(8, symbolSize - 8, true); // Always dark
+}
+
+void QrEncoder::drawFunctionPatterns() {
+    for (uint8_t i = 0; i < symbolSize; i++) {
+        setFunction(6, i, i % 2 == 0);
+        setFunction(i, 6, i % 2 == 0);
+    }
+
+    drawFinder(3, 3);
+    drawFinder(symbolSize - 4, 3);
+    drawFinder(3, symbolSize - 4);
+
+    // Up to version 6 there is one alignment pattern, the others would overlap the finders
+    if (version >= 2) {
+        drawAlignment(symbolSize - 7, symbolSize - 7);
+    }
+
+    // Reserve the format areas; the real bits are drawn once the mask is known
+    drawFormat(0);
+}
+
+// Zigzag through column pairs from the bottom right, skipping the vertical timing pattern. The
+// remainder bits after the last codeword stay light.
+void QrEncoder::placeCodewords(const uint8_t *codewords, uint16_t count) {
+    uint32_t bitIndex = 0;
+    for (int16_t right = symbolSize - 1; right >= 1; right -= 2) {
+        if (right == 6) {
+            right = 5;
+        }
+        bool upward = ((right + 1) & 2) == 0;
+        for (uint8_t vertical = 0; vertical < symbolSize; vertical++) {
+            uint8_t y = upward ? symbolSize - 1 - vertical : vertical;
+            for (uint8_t j = 0; j < 2; j++) {
+                uint8_t x = right - j;
+                if (getBit(isFunction, x, y) || bitIndex >= (uint32_t)count * 8) {
+                    continue;
+                }
+                bool dark = ((codewords[bitIndex / 8] >> (7 - (bitIndex % 8))) & 1) != 0;
+                setBit(modules, x, y, dark);
+                bitIndex++;
+            }
+        }
+    }
+}
+
+// XOR the data modules with a mask pattern; applying the same mask again undoes it
+void QrEncoder::applyMask(uint8_t mask) {
+    for (uint8_t y = 0; y < symbolSize; y++) {
+        for (uint8_t x = 0; x < symbolSize; x++) {
+            bool invert = false;
+            switch (mask) {
+                case 0: invert = (x + y) % 2 == 0; break;
+                case 1: invert = y % 2 == 0; break;
+                case 2: invert = x % 3 == 0; break;
+                case 3: invert = (x + y) % 3 == 0; break;
+                case 4: invert = ((x / 3) + (y / 2)) % 2 == 0; break;
+                case 5: invert = ((x * y) % 2) + ((x * y) % 3) == 0; break;
+                case 6: invert = (((x * y) % 2) + ((x * y) % 3)) % 2 == 0; break;
+                case 7: invert = (((x + y) % 2) + ((x * y) % 3)) % 2 == 0; break;
+            }
+            if (invert && !getBit(isFunction, x, y)) {
+                setBit(modules, x, y, !getBit(modules, x, y));
+            }
+        }
+    }
+}
+
+auto QrEncoder::penalty() const -> uint32_t {
+    uint32_t result = 0;
+
+    // Modules outside the symbol count as light
+    auto dark = [this](int16_t x, int16_t y) {
+        return x >= 0 && y >= 0 && x < symbolSize && y < symbolSize && module(x, y);
+    };
+    // 1:1:3:1:1 finder-like pattern with four light modules on one side, along a row or column
+    auto finderLike = [&dark](int16_t x, int16_t y, int8_t stepX, int8_t stepY) {
+        static constexpr bool PATTERN[] = {true, false, true, true, true, false, true};
+        for (uint8_t i = 0; i < 7; i++) {
+            if (dark(x + (i * stepX), y + (i * stepY)) != PATTERN[i]) {
+                return false;
+            }
+        }
+        bool lightBefore = true;
+        bool lightAfter  = true;
+        for (uint8_t i = 1; i <= 4; i++) {
+            lightBefore = lightBefore && !dark(x - (i * stepX), y - (i * stepY));
+            lightAfter  = lightAfter && !dark(x + ((6 + i) * stepX), y + ((6 + i) * stepY));
+        }
+        return lightBefore || lightAfter;
+    };
+
+    uint16_t darkModules = 0;
+    for (uint8_t a = 0; a < symbolSize; a++) {
+        // Runs of five or more modules of one colour, in row a and in column a
+        uint8_t rowRun    = 0;
+        uint8_t columnRun = 0;
+        for (uint8_t b = 0; b < symbolSize; b++) {
+            rowRun    = (b > 0 && module(b, a) == module(b - 1, a)) ? rowRun + 1 : 1;
+            columnRun = (b > 0 && module(a, b) == module(a, b - 1)) ? columnRun + 1 : 1;
+            result += (rowRun == 5) ? PENALTY_RUN : (rowRun > 5) ? 1 : 0;
+            result += (columnRun == 5) ? PENALTY_RUN : (columnRun > 5) ? 1 : 0;
+
+            if (finderLike(b, a, 1, 0)) {
+                result += PENALTY_FINDER;
+            }
+            if (finderLike(a, b, 0, 1)) {
+                result += PENALTY_FINDER;
+            }
+            darkModules += module(b, a) ? 1 : 0;
+        }
+    }
+
+    // 2x2 blocks of one colour
+    for (uint8_t y = 0; y + 1 < symbolSize; y++) {
+        for (uint8_t x = 0; x + 1 < symbolSize; x++) {
+            bool color = module(x, y);
+            if (color == module(x + 1, y) && color == module(x, y + 1)
+                && color == module(x + 1, y + 1)) {
+                result += PENALTY_BLOCK;
+            }
+        }
+    }
+
+    // Every 5% the dark share is away from 50%
+    uint16_t total = symbolSize * symbolSize;
+    uint32_t steps = ((abs((darkModules * 20) - (total * 10)) + total - 1) / total) - 1;
+    return result + (steps * PENALTY_BALANCE);
+}
+
+auto QrEncoder::encode(const char *text) -> bool {
+    symbolSize      = 0;
+    version         = 0;
+    uint16_t length = strlen(text);
+
+    // Smallest version whose data capacity holds the mode, the 8-bit length and the bytes
+    for (uint8_t v = 1; v <= MAX_VERSION; v++) {
+        const QrVersion &info = VERSIONS[v - 1];
+        uint16_t dataCodewords = info.totalCodewords - (info.ecCodewordsPerBlock * info.blocks);
+        if (4 + 8 + (length * 8) <= dataCodewords * 8) {
+            version = v;
+            break;
+        }
+    }
+    if (version == 0) {
+        return false;
+    }
+
+    const QrVersion &info          = VERSIONS[version - 1];
+    uint16_t         dataCodewords = info.totalCodewords - (info.ecCodewordsPerBlock * info.blocks);
+    symbolSize                     = 17 + (4 * version);
+
+    // Data bit stream: mode, length, bytes, terminator and padding
+    std::array<uint8_t, MAX_CODEWORDS> data      = {};
+    uint16_t                           bitLength = 0;
+    auto appendBits = [&data, &bitLength](uint16_t value, uint8_t count) {
+        for (int8_t bit = count - 1; bit >= 0; bit--, bitLength++) {
+            data[bitLength / 8] |= ((value >> bit) & 1) << (7 - (bitLength % 8));
+        }
+    };
+    appendBits(MODE_BYTE, 4);
+    appendBits(length, 8);
+    for (uint16_t i = 0; i < length; i++) {
+        appendBits(static_cast<uint8_t>(text[i]), 8);
+    }
+    appendBits(0, std::min<uint16_t>(4, (dataCodewords * 8) - bitLength));
+    bitLength = (bitLength + 7) / 8 * 8;
+    for (uint8_t pad = 0xEC; bitLength < dataCodewords * 8; pad ^= 0xEC ^ 0x11) {
+        appendBits(pad, 8);
+    }
+
+    // Error correction per block, then interleave the blocks codeword by codeword
+    uint8_t generator[MAX_EC_PER_BLOCK];
+    uint8_t errorCorrection[MAX_BLOCKS][MAX_EC_PER_BLOCK];
+    uint8_t blockLength = dataCodewords / info.blocks;
+    rsGenerator(info.ecCodewordsPerBlock, generator);
+    for (uint8_t block = 0; block < info.blocks; block++) {
+        rsRemainder(&data[block * blockLength], blockLength, generator, info.ecCodewordsPerBlock,
+                    errorCorrection[block]);
+    }
+
+    std::array<uint8_t, MAX_CODEWORDS> codewords = {};
+    uint16_t                           index     = 0;
+    for (uint8_t i = 0; i < blockLength; i++) {
+        for (uint8_t block = 0; block < info.blocks; block++) {
+            codewords[index++] = data[(block * blockLength) + i];
+        }
+    }
+    for (uint8_t i = 0; i < info.ecCodewordsPerBlock; i++) {
+        for (uint8_t block = 0; block < info.blocks; block++) {
+            codewords[index++] = errorCorrection[block][i];
+        }
+    }
+
+    modules    = {};
+    isFunction = {};
+    drawFunctionPatterns();
+    placeCodewords(codewords.data(), info.totalCodewords);
+
+    uint8_t  bestMask    = 0;
+    uint32_t bestPenalty = UINT32_MAX;
+    for (uint8_t mask = 0; mask < MASK_COUNT; mask++) {
+        applyMask(mask);
+        drawFormat(mask);
+        uint32_t score = penalty();
+        if (score < bestPenalty) {
+            bestPenalty = score;
+            bestMask    = mask;
+        }
+        applyMask(mask);
+    }
+    applyMask(bestMask);
+    drawFormat(bestMask);
+    return true;
+}
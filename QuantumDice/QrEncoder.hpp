@@ -0,0 +1,62 @@
+#ifndef QRENCODER_H_
+#define QRENCODER_H_
+
+#include <array>
+#include <cstdint>
+
+/*
+   QrEncoder - QR codes generated on the dice
+
+   Encodes a short text (a URL) as a QR code in byte mode with error correction level M, in the
+   smallest of versions 1 - 6 that fits (up to 106 bytes). Versions above 6 would need the version
+   information blocks and are not supported. The mask with the lowest penalty score is chosen, as
+   the standard prescribes. All storage is fixed size, nothing is allocated.
+*/
+
+class QrEncoder {
+  public:
+    static constexpr uint8_t  MAX_VERSION   = 6;
+    static constexpr uint8_t  MAX_SIZE      = 17 + (4 * MAX_VERSION); // Modules per side
+    static constexpr uint16_t MAX_CODEWORDS = 172;                    // Version 6
+    static constexpr uint8_t  QUIET_ZONE    = 4;                      // Light modules around a code
+
+    // Returns false when the text does not fit; size() is then 0
+    auto encode(const char *text) -> bool;
+
+    // Modules per side of the encoded symbol, 0 when nothing is encoded
+    auto size() const -> uint8_t {
+        return symbolSize;
+    }
+
+    // True for a dark module
+    auto module(uint8_t x, uint8_t y) const -> bool {
+        return getBit(modules, x, y);
+    }
+
+  private:
+    static constexpr uint16_t GRID_BYTES = ((MAX_SIZE * MAX_SIZE) + 7) / 8;
+
+    using Grid = std::array<uint8_t, GRID_BYTES>;
+
+    auto getBit(const Grid &grid, uint8_t x, uint8_t y) const -> bool {
+        uint16_t index = (y * symbolSize) + x;
+        return (grid[index / 8] & (1 << (index % 8))) != 0;
+    }
+    void setBit(Grid &grid, uint8_t x, uint8_t y, bool value);
+    void setFunction(uint8_t x, uint8_t y, bool dark);
+
+    void drawFinder(uint8_t centerX, uint8_t centerY);
+    void drawAlignment(uint8_t centerX, uint8_t centerY);
+    void drawFormat(uint8_t mask);
+    void drawFunctionPatterns();
+    void placeCodewords(const uint8_t *codewords, uint16_t count);
+    void applyMask(uint8_t mask);
+    auto penalty() const -> uint32_t;
+
+    uint8_t version    = 0;
+    uint8_t symbolSize = 0;
+    Grid    modules    = {};
+    Grid    isFunction = {}; // Finder, timing, alignment and format modules are never masked
+};
+
+#endif /* QRENCODER_H_ */
@@ -7,6 +7,7 @@
 #include "Screenfunctions.hpp"
 #include "handyHelpers.hpp"
 #include "StateMachine.hpp"
+#include "MessageTransport.hpp"
 #include "DiceConfigManager.hpp"
 
 constexpr uint16_t UPDATE_INTERVAL = 50;  //loop functions
@@ -86,7 +87,7 @@ void setup() {
     usleep(SECOND);
 
     welcomeInfo(screenselections::X0);
-    voltageIndicator(screenselections::X0);
+    voltageIndicator(screenselections::X0, readBatteryCentivolts());
     displayQRcode(screenselections::X1);
 
     displayEinstein(screenselections::ZZ);
@@ -102,6 +103,9 @@ void setup() {
     // Set IMU sensor in state machine
     stateMachine.setImuSensor(imuSensor);
 
+    // Set the radio transport in state machine
+    stateMachine.setTransport(new EspNowTransport());
+
     // Initialize button
     initButton();
 
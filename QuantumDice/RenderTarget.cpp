@@ -0,0 +1,179 @@
+#include "RenderTarget.hpp"
+
+#include "defines.hpp"
+#include "DisplayCommit.hpp"
+#include "handyHelpers.hpp"
+#include "RoundDisplay.hpp"
+#include "Screenfunctions.hpp"
+
+#include <Adafruit_GC9A01A.h>
+#include <algorithm>
+#include <cstring>
+#include <esp_heap_caps.h>
+
+extern Adafruit_GC9A01A tft;
+
+static PanelTarget   panelTarget;
+static RenderTarget *activeTarget = &panelTarget;
+
+auto renderTarget() -> RenderTarget & {
+    return *activeTarget;
+}
+
+void setRenderTarget(RenderTarget &target) {
+    displayFence();
+    activeTarget = &target;
+}
+
+auto RenderTarget::textWidth(const char *text, const GFXfont *font) -> uint16_t {
+    // Only font metrics are used, nothing is sent to the panels
+    int16_t  x1 = 0;
+    int16_t  y1 = 0;
+    uint16_t w  = 0;
+    uint16_t h  = 0;
+    tft.setFont(font);
+    tft.setTextSize(1);
+    tft.getTextBounds(text, 0, 0, &x1, &y1, &w, &h);
+    return w;
+}
+
+// PanelTarget
+
+void PanelTarget::select(uint8_t screens) {
+    selectScreens(screens);
+}
+
+void PanelTarget::fill(uint16_t color) {
+    commitFill(color);
+}
+
+void PanelTarget::blit(uint16_t *frame) {
+    commitFrame(frame);
+}
+
+auto PanelTarget::acquireRows() -> uint16_t * {
+    return acquireBand();
+}
+
+void PanelTarget::blitRows(uint16_t *rows, uint16_t firstRow, uint16_t count) {
+    commitBand(rows, firstRow, count);
+}
+
+void PanelTarget::circle(int16_t x, int16_t y, int16_t radius, uint16_t color) {
+    displayFence();
+    tft.fillCircle(x, y, radius, color);
+}
+
+void PanelTarget::textRun(const char *text, int16_t x, int16_t y, const GFXfont *font,
+                          uint16_t color) {
+    displayFence();
+    tft.setFont(font);
+    tft.setTextSize(1);
+    tft.setTextColor(color);
+    tft.setCursor(x, y);
+    tft.print(text);
+}
+
+// MemoryTarget
+
+// Like the panels, MemoryTarget only writes the visible chord of each row. The corners of the
+// frames stay black, so a captured frame matches what the panels show.
+
+// Lets the GFX circle and text code draw into every selected frame
+class MemoryCanvas : public Adafruit_GFX {
+  public:
+    explicit MemoryCanvas(MemoryTarget &target) : Adafruit_GFX(WIDTH, HEIGHT), target(target) {}
+
+    void drawPixel(int16_t x, int16_t y, uint16_t color) override {
+        if (y < 0 || y >= HEIGHT) {
+            return;
+        }
+        const ScanlineChord &chord = ROUND_CHORDS[y];
+        if (x < chord.start || x >= chord.start + chord.width) {
+            return;
+        }
+        for (uint8_t face = 0; face < RENDER_FACES; face++) {
+            if ((target.selected & (1 << face)) != 0) {
+                target.frames[face][(y * WIDTH) + x] = color;
+            }
+        }
+    }
+
+  private:
+    MemoryTarget &target;
+};
+
+auto MemoryTarget::begin() -> bool {
+    for (auto &face : frames) {
+        if (face == nullptr) {
+            face = static_cast<uint16_t *>(
+              heap_caps_calloc((size_t)WIDTH * HEIGHT, sizeof(uint16_t), MALLOC_CAP_SPIRAM));
+        }
+        if (face == nullptr) {
+            errorln("Failed to allocate memory render target");
+            return false;
+        }
+    }
+    if (rows == nullptr) {
+        rows = static_cast<uint16_t *>(
+          heap_caps_malloc((size_t)WIDTH * BAND_ROWS * sizeof(uint16_t), MALLOC_CAP_8BIT));
+    }
+    return rows != nullptr;
+}
+
+auto MemoryTarget::frame(uint8_t face) const -> const uint16_t * {
+    return (face < RENDER_FACES) ? frames[face] : nullptr;
+}
+
+void MemoryTarget::select(uint8_t screens) {
+    selected = hwPins.screenAddress[screens];
+}
+
+void MemoryTarget::fill(uint16_t color) {
+    for (uint8_t face = 0; face < RENDER_FACES; face++) {
+        if ((selected & (1 << face)) == 0 || frames[face] == nullptr) {
+            continue;
+        }
+        for (uint16_t y = 0; y < HEIGHT; y++) {
+            const ScanlineChord &chord = ROUND_CHORDS[y];
+            std::fill_n(frames[face] + (y * WIDTH) + chord.start, chord.width, color);
+        }
+    }
+}
+
+void MemoryTarget::blit(uint16_t *frame) {
+    blitRows(frame, 0, HEIGHT);
+}
+
+auto MemoryTarget::acquireRows() -> uint16_t * {
+    return rows;
+}
+
+void MemoryTarget::blitRows(uint16_t *band, uint16_t firstRow, uint16_t count) {
+    for (uint8_t face = 0; face < RENDER_FACES; face++) {
+        if ((selected & (1 << face)) == 0 || frames[face] == nullptr) {
+            continue;
+        }
+        for (uint16_t row = 0; row < count; row++) {
+            const ScanlineChord &chord  = ROUND_CHORDS[firstRow + row];
+            const uint32_t       offset = ((firstRow + row) * WIDTH) + chord.start;
+            memcpy(frames[face] + offset, band + (row * WIDTH) + chord.start,
+                   chord.width * sizeof(uint16_t));
+        }
+    }
+}
+
+void MemoryTarget::circle(int16_t x, int16_t y, int16_t radius, uint16_t color) {
+    MemoryCanvas canvas(*this);
+    canvas.fillCircle(x, y, radius, color);
+}
+
+void MemoryTarget::textRun(const char *text, int16_t x, int16_t y, const GFXfont *font,
+                           uint16_t color) {
+    MemoryCanvas canvas(*this);
+    canvas.setFont(font);
+    canvas.setTextSize(1);
+    canvas.setTextColor(color);
+    canvas.setCursor(x, y);
+    canvas.print(text);
+}
@@ -0,0 +1,81 @@
+#ifndef RENDERTARGET_H_
+#define RENDERTARGET_H_
+
+#include <Adafruit_GFX.h>
+#include <array>
+#include <cstdint>
+
+/*
+   RenderTarget - where the screen functions draw to
+
+   Every draw path in Screenfunctions.cpp goes through the active render target instead of the
+   global tft, using a handful of primitives: select screens, fill, blit (a full frame or a band
+   of rows), circle and text run. Coordinates are those of a single 240x240 face.
+
+   PanelTarget is the normal backend and drives the GC9A01A panels through DisplayCommit.
+   MemoryTarget keeps one RGB565 frame per face in PSRAM, so a render path can be timed or its
+   output compared without the panels in the loop.
+*/
+
+constexpr uint8_t RENDER_FACES = 6;
+
+class RenderTarget {
+  public:
+    virtual ~RenderTarget() = default;
+
+    // Direct the following calls to a screenselections combination
+    virtual void select(uint8_t screens) = 0;
+    virtual void fill(uint16_t color)    = 0;
+    // Full 240x240 frame; the buffer must stay untouched until the next displayFence()
+    virtual void blit(uint16_t *frame) = 0;
+    // Band of BAND_ROWS full-width rows; every acquireRows() must be followed by blitRows()
+    virtual auto acquireRows() -> uint16_t *                                 = 0;
+    virtual void blitRows(uint16_t *rows, uint16_t firstRow, uint16_t count) = 0;
+    virtual void circle(int16_t x, int16_t y, int16_t radius, uint16_t color) = 0;
+    // Text with its baseline starting at (x, y)
+    virtual void textRun(const char *text, int16_t x, int16_t y, const GFXfont *font,
+                         uint16_t color)
+      = 0;
+
+    static auto textWidth(const char *text, const GFXfont *font) -> uint16_t;
+};
+
+class PanelTarget : public RenderTarget {
+  public:
+    void select(uint8_t screens) override;
+    void fill(uint16_t color) override;
+    void blit(uint16_t *frame) override;
+    auto acquireRows() -> uint16_t * override;
+    void blitRows(uint16_t *rows, uint16_t firstRow, uint16_t count) override;
+    void circle(int16_t x, int16_t y, int16_t radius, uint16_t color) override;
+    void textRun(const char *text, int16_t x, int16_t y, const GFXfont *font,
+                 uint16_t color) override;
+};
+
+class MemoryTarget : public RenderTarget {
+  public:
+    // Allocates the six frames in PSRAM, returns false if that fails
+    auto begin() -> bool;
+    auto frame(uint8_t face) const -> const uint16_t *;
+
+    void select(uint8_t screens) override;
+    void fill(uint16_t color) override;
+    void blit(uint16_t *frame) override;
+    auto acquireRows() -> uint16_t * override;
+    void blitRows(uint16_t *rows, uint16_t firstRow, uint16_t count) override;
+    void circle(int16_t x, int16_t y, int16_t radius, uint16_t color) override;
+    void textRun(const char *text, int16_t x, int16_t y, const GFXfont *font,
+                 uint16_t color) override;
+
+  private:
+    friend class MemoryCanvas;
+
+    std::array<uint16_t *, RENDER_FACES> frames   = {};
+    uint16_t                            *rows     = nullptr;
+    uint8_t                              selected = 0; // Bit per face, as hwPins.screenAddress
+};
+
+auto renderTarget() -> RenderTarget &;
+void setRenderTarget(RenderTarget &target);
+
+#endif /* RENDERTARGET_H_ */
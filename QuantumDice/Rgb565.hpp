@@ -0,0 +1,79 @@
+#ifndef RGB565_H_
+#define RGB565_H_
+
+#include <cstddef>
+#include <cstdint>
+
+/*
+   Rgb565 - integer RGB565 blending
+
+   Alpha is fixed point in 1/32 steps: 0 shows the background, RGB565_ALPHA_ONE shows the
+   foreground. The blend spreads the three channels over a 32-bit word (green in the upper half,
+   red and blue in the lower half) so all channels are blended with one multiply per colour
+   (SWAR). blendRgb565Reference() is the per-channel scalar version of the same arithmetic.
+
+   Compared to the float blend that was used before, results differ by at most one LSB per
+   channel, caused by the quantisation of alpha to 1/32.
+*/
+
+constexpr uint8_t  RGB565_ALPHA_ONE = 32;
+constexpr uint32_t RGB565_SWAR_MASK = 0x07E0F81F;
+
+// Convert a 0.0 - 1.0 opacity to fixed point, rounded to the nearest step
+constexpr auto rgb565AlphaFromFloat(float alpha) -> uint8_t {
+    if (alpha <= 0.0F) {
+        return 0;
+    }
+    if (alpha >= 1.0F) {
+        return RGB565_ALPHA_ONE;
+    }
+    return static_cast<uint8_t>((alpha * RGB565_ALPHA_ONE) + 0.5F);
+}
+
+constexpr auto rgb565Expand(uint16_t color) -> uint32_t {
+    return (color | (static_cast<uint32_t>(color) << 16)) & RGB565_SWAR_MASK;
+}
+
+constexpr auto rgb565Compact(uint32_t expanded) -> uint16_t {
+    expanded &= RGB565_SWAR_MASK;
+    return static_cast<uint16_t>(expanded | (expanded >> 16));
+}
+
+constexpr auto blendRgb565(uint16_t foreground, uint16_t background, uint8_t alpha) -> uint16_t {
+    uint32_t blended = (rgb565Expand(foreground) * alpha)
+                       + (rgb565Expand(background) * (RGB565_ALPHA_ONE - alpha));
+    return rgb565Compact(blended >> 5);
+}
+
+constexpr auto blendRgb565Reference(uint16_t foreground, uint16_t background, uint8_t alpha)
+  -> uint16_t {
+    uint16_t inverse = RGB565_ALPHA_ONE - alpha;
+    uint16_t r = ((((foreground >> 11) & 0x1F) * alpha) + (((background >> 11) & 0x1F) * inverse))
+                 >> 5;
+    uint16_t g = ((((foreground >> 5) & 0x3F) * alpha) + (((background >> 5) & 0x3F) * inverse))
+                 >> 5;
+    uint16_t b = (((foreground & 0x1F) * alpha) + ((background & 0x1F) * inverse)) >> 5;
+    return (r << 11) | (g << 5) | b;
+}
+
+// Blend one colour with a constant alpha over a span of pixels
+inline void blendRgb565Span(uint16_t *pixels, size_t count, uint16_t color, uint8_t alpha) {
+    uint32_t foreground = rgb565Expand(color) * alpha;
+    uint8_t  inverse    = RGB565_ALPHA_ONE - alpha;
+    for (size_t i = 0; i < count; i++) {
+        pixels[i] = rgb565Compact((foreground + (rgb565Expand(pixels[i]) * inverse)) >> 5);
+    }
+}
+
+// Blend one colour over a span of pixels with a per-pixel alpha (e.g. anti-aliased coverage)
+inline void blendRgb565Span(uint16_t *pixels, size_t count, uint16_t color,
+                            const uint8_t *alphas) {
+    uint32_t foreground = rgb565Expand(color);
+    for (size_t i = 0; i < count; i++) {
+        uint8_t alpha = alphas[i];
+        pixels[i]     = rgb565Compact(
+          ((foreground * alpha) + (rgb565Expand(pixels[i]) * (RGB565_ALPHA_ONE - alpha))) >> 5);
+    }
+}
+
+#endif /* RGB565_H_ */
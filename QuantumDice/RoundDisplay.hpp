@@ -0,0 +1,62 @@
+#ifndef ROUNDDISPLAY_H_
+#define ROUNDDISPLAY_H_
+
+#include <array>
+#include <cstdint>
+
+/*
+   RoundDisplay - visible area of the round GC9A01A panels
+
+   The panels are 240x240 but only the inscribed circle is visible. For every scanline the table
+   below holds the run of columns that touches that circle, so pushes can send one address window
+   per row instead of the full square and skip the ~21% of pixels hidden in the corners.
+
+   The circle is symmetric, so the same table is valid for every rotation.
+*/
+
+constexpr uint16_t ROUND_PANEL_SIZE = 240;
+
+struct ScanlineChord {
+    uint8_t  start; // First visible column
+    uint16_t width; // Number of visible columns
+};
+
+// Any pixel whose square touches the circle is considered visible
+constexpr auto makeRoundChords() -> std::array<ScanlineChord, ROUND_PANEL_SIZE> {
+    std::array<ScanlineChord, ROUND_PANEL_SIZE> chords{};
+    constexpr int32_t                           centre = ROUND_PANEL_SIZE / 2;
+    constexpr int32_t                           radius = ROUND_PANEL_SIZE / 2;
+
+    for (int32_t y = 0; y < ROUND_PANEL_SIZE; y++) {
+        int32_t dy    = (y < centre) ? (centre - 1 - y) : (y - centre);
+        int32_t start = 0;
+        while (start < centre) {
+            int32_t dx = centre - 1 - start;
+            if ((dx * dx) + (dy * dy) < radius * radius) {
+                break;
+            }
+            start++;
+        }
+        chords[y] = {static_cast<uint8_t>(start),
+                     static_cast<uint16_t>(ROUND_PANEL_SIZE - (2 * start))};
+    }
+    return chords;
+}
+
+constexpr std::array<ScanlineChord, ROUND_PANEL_SIZE> ROUND_CHORDS = makeRoundChords();
+
+constexpr auto roundVisiblePixels() -> uint32_t {
+    uint32_t total = 0;
+    for (const auto &chord : ROUND_CHORDS) {
+        total += chord.width;
+    }
+    return total;
+}
+
+constexpr uint32_t ROUND_VISIBLE_PIXELS = roundVisiblePixels();
+
+static_assert(ROUND_CHORDS[ROUND_PANEL_SIZE / 2].start == 0, "Centre row must span the panel");
+static_assert(ROUND_VISIBLE_PIXELS < (uint32_t)ROUND_PANEL_SIZE * ROUND_PANEL_SIZE,
+              "Corners must be clipped");
+
+#endif /* ROUNDDISPLAY_H_ */
@@ -17,6 +17,15 @@ struct ScreenConfiguration {
     ScreenStates x0, x1, y0, y1, z0, z1;
 };
 
+/**
+ * Face of an entangled superposition. With the colors hidden, the entanglement color is only
+ * flashed, and the flash shows the entanglement glyph in that color instead of the dots.
+ */
+inline auto entangledScreen() -> ScreenStates {
+    return (flashColor && !showColors) ? ScreenStates::ENTANGLED
+                                       : ScreenStates::MIX1TO6_ENTANGLED;
+}
+
 /**
  * Determine which screens to show based on current dice state
  */
@@ -38,8 +47,9 @@ inline auto determineScreens(State state, DiceNumbers diceNumber, UpSide upSide)
 
     // === LOW BATTERY MODE ===
     if (state.mode == Mode::LOW_BATTERY) {
-        config.x0 = config.x1 = config.y0 = config.y1 = config.z0 = config.z1
-          = ScreenStates::LOWBATTERY;
+        // Battery readout on the X faces, refreshed by whileLowBattery()
+        config.x0 = config.x1 = ScreenStates::DIAGNOSE;
+        config.y0 = config.y1 = config.z0 = config.z1 = ScreenStates::LOWBATTERY;
         return config;
     }
 
@@ -52,7 +62,7 @@ inline auto determineScreens(State state, DiceNumbers diceNumber, UpSide upSide)
 
         if (state.entanglementState == EntanglementState::ENTANGLED) {
             // Entangled: show special entangled superposition
-            throwingScreen = ScreenStates::MIX1TO6_ENTANGLED;
+            throwingScreen = entangledScreen();
         } else {
             // Pure superposition (including ENTANGLE_REQUESTED)
             throwingScreen = ScreenStates::MIX1TO6;
@@ -68,7 +78,7 @@ inline auto determineScreens(State state, DiceNumbers diceNumber, UpSide upSide)
 
         if (state.entanglementState == EntanglementState::ENTANGLED) {
             // Entangled: show entangled superposition
-            idleScreen = ScreenStates::MIX1TO6_ENTANGLED;
+            idleScreen = entangledScreen();
         } else {
             // Pure quantum: show superposition (including ENTANGLE_REQUESTED)
             idleScreen = ScreenStates::MIX1TO6;
@@ -96,7 +106,7 @@ inline auto determineScreens(State state, DiceNumbers diceNumber, UpSide upSide)
 
         // Default all to superposition
         ScreenStates defaultScreen = (state.entanglementState == EntanglementState::ENTANGLED)
-                                       ? ScreenStates::MIX1TO6_ENTANGLED
+                                       ? entangledScreen()
                                        : ScreenStates::MIX1TO6;
 
         config.x0 = config.x1 = config.y0 = config.y1 = config.z0 = config.z1 = defaultScreen;
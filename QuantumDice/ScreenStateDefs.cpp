@@ -5,26 +5,43 @@
 #include "ScreenDeterminator.hpp" // Use new dynamic screen determination
 #include "Screenfunctions.hpp"
 
+#include <algorithm>
 #include <Arduino.h>
+#include <array>
 
 State          stateSelf, stateSister;
 MeasuredAxises measureAxisSelf, prevMeasureAxisSelf, measureAxisSister;
 DiceNumbers    diceNumberSelf, diceNumberSister;
 UpSide         upSideSelf, prevUpSideSelf, upSideSister;
 uint16_t       entanglement_color_self = 0xFFE0; // Default yellow
-uint16_t       prev_entanglement_color = 0xFFE0; // Track previous color for change detection
 bool           showColors              = true;   // Toggle for showing entanglement colors
-bool           prev_showColors         = true;   // Track previous showColors state
 bool           flashColor              = false;  // Whether to flash color briefly
-bool           prev_flashColor         = false;  // Track previous flashColor state
 unsigned long  flashColorStartTime     = 0;      // When the color flash started
 ScreenStates   x0ReqScreenState, x1ReqScreenState, y0ReqScreenState, y1ReqScreenState,
   z0ReqScreenState, z1ReqScreenState;
 
 BlinkStates blinkState;
 
-constexpr uint8_t DICE_MIN = 1;
-constexpr uint8_t DICE_MAX = 6;
+constexpr uint8_t DICE_MIN   = 1;
+constexpr uint8_t DICE_MAX   = 6;
+constexpr uint8_t FACE_COUNT = 6;
+
+// Everything that determines the pixels of one face. Two equal keys draw identical faces.
+// Each face is always drawn through its own single selection, on a black background and with
+// its panel's fixed rotation, so neither needs to be part of the key.
+struct FaceKey {
+    ScreenStates state;
+    uint16_t     foreground;        // Effective dot/text colour
+    uint16_t     batteryCentivolts; // Battery readout shown by DIAGNOSE, 0 otherwise
+
+    auto operator==(const FaceKey &other) const -> bool {
+        return state == other.state && foreground == other.foreground
+               && batteryCentivolts == other.batteryCentivolts;
+    }
+    auto operator!=(const FaceKey &other) const -> bool { return !(*this == other); }
+};
+
+static FaceRedrawStats redrawStats = {0, 0};
 
 auto findValues(State state, DiceNumbers diceNumber, UpSide upSide, ScreenStates &x0ScreenState,
                 ScreenStates &x1ScreenState, ScreenStates &y0ScreenState,
@@ -36,8 +53,8 @@ auto findValues(State state, DiceNumbers diceNumber, UpSide upSide, ScreenStates
                                  z1ScreenState);
 }
 
-static void callFunction(ScreenStates result, screenselections screens) {
-    switch (result) {
+static void callFunction(const FaceKey &face, screenselections screens) {
+    switch (face.state) {
         case ScreenStates::GODDICE:
             debugln("Entering GODDICE case");
             displayEinstein(screens);
@@ -78,6 +95,10 @@ static void callFunction(ScreenStates result, screenselections screens) {
             debugln("Entering MIX1TO6_ENTANGLED case");
             displayMix1to6_entangled(screens);
             return;
+        case ScreenStates::ENTANGLED:
+            debugln("Entering ENTANGLED case");
+            displayEntangled(screens);
+            return;
         case ScreenStates::LOWBATTERY:
             debugln("Entering LOWBATTERY case");
             displayLowBattery(screens);
@@ -88,7 +109,9 @@ static void callFunction(ScreenStates result, screenselections screens) {
             return;
         case ScreenStates::DIAGNOSE:
             debugln("Entering DIAGNOSE case");
-            voltageIndicator(screens);
+            // The start-up screen: firmware and dice id above, the battery readout below
+            welcomeInfo(screens);
+            voltageIndicator(screens, face.batteryCentivolts);
             return;
         case ScreenStates::RESET:
             debugln("Entering RESET case");
@@ -110,120 +133,145 @@ static void callFunction(ScreenStates result, screenselections screens) {
     }
 }
 
-void checkAndCallFunctions(ScreenStates x0, ScreenStates x1, ScreenStates y0, ScreenStates y1,
-                           ScreenStates z0, ScreenStates z1) {
-    static ScreenStates prevX0 = ScreenStates::BLANC;
-    static ScreenStates prevY0 = ScreenStates::BLANC;
-    static ScreenStates prevZ0 = ScreenStates::BLANC;
-    static ScreenStates prevX1 = ScreenStates::BLANC;
-    static ScreenStates prevY1 = ScreenStates::BLANC;
-    static ScreenStates prevZ1 = ScreenStates::BLANC;
-
-    // Check if color changed - if so, force refresh of all entangled screens
-    bool colorChanged      = (entanglement_color_self != prev_entanglement_color);
-    bool showColorsChanged = (showColors != prev_showColors);
-    bool flashColorChanged = (flashColor != prev_flashColor);
-
-    if (colorChanged || showColorsChanged || flashColorChanged) {
-        if (showColorsChanged) {
-            debugf("Show colors toggled from %s to %s - forcing screen refresh\n",
-                   prev_showColors ? "ON" : "OFF", showColors ? "ON" : "OFF");
-            prev_showColors = showColors;
-        }
-        if (colorChanged) {
-            debugf("Entanglement color changed from 0x%04X to 0x%04X - forcing screen refresh\n",
-                   prev_entanglement_color, entanglement_color_self);
-            prev_entanglement_color = entanglement_color_self;
-        }
-        // Force refresh of any entangled screens by resetting their prev state
-        if (x0 == ScreenStates::MIX1TO6_ENTANGLED) {
-            prevX0 = ScreenStates::BLANC;
-        }
-        if (y0 == ScreenStates::MIX1TO6_ENTANGLED) {
-            prevY0 = ScreenStates::BLANC;
-        }
-        if (z0 == ScreenStates::MIX1TO6_ENTANGLED) {
-            prevZ0 = ScreenStates::BLANC;
-        }
-        if (x1 == ScreenStates::MIX1TO6_ENTANGLED) {
-            prevX1 = ScreenStates::BLANC;
-        }
-        if (y1 == ScreenStates::MIX1TO6_ENTANGLED) {
-            prevY1 = ScreenStates::BLANC;
-        }
-        if (z1 == ScreenStates::MIX1TO6_ENTANGLED) {
-            prevZ1 = ScreenStates::BLANC;
-        }
+// Combined screen selections, largest first. Used to cover a group of faces that show the same
+// content with as few pushes as possible.
+static constexpr std::array<screenselections, 15> MULTICAST_SELECTIONS = {
+  ALL, XXYY, XXZZ, YYZZ, ODD, EVEN, XX, YY, ZZ, X0, X1, Y0, Y1, Z0, Z1};
 
-        if (flashColorChanged) {
-            debugf("Flash color toggled from %s to %s - forcing screen refresh\n",
-                   prev_flashColor ? "ON" : "OFF", flashColor ? "ON" : "OFF");
-            prev_flashColor = flashColor;
+// Image faces drawn through a combined selection (XX/YY/ZZ) get that axis' configured background
+// instead of black, so they are only ever drawn through single selections. Everything else draws
+// the same pixels regardless of the selected screens. The panels apply their own rotation, so
+// faces with different rotations can share a push.
+static auto isMulticastSafe(ScreenStates state) -> bool {
+    switch (state) {
+        case ScreenStates::GODDICE:
+        case ScreenStates::ENTANGLED:
+        case ScreenStates::QLAB_LOGO:
+        case ScreenStates::QRCODE:
+        case ScreenStates::UT_LOGO:
+        case ScreenStates::RESET:   return false;
+        default:                    return true;
+    }
+}
 
-            if (x0 == ScreenStates::MIX1TO6_ENTANGLED) {
-                prevX0 = ScreenStates::BLANC;
-            }
-            if (y0 == ScreenStates::MIX1TO6_ENTANGLED) {
-                prevY0 = ScreenStates::BLANC;
-            }
-            if (z0 == ScreenStates::MIX1TO6_ENTANGLED) {
-                prevZ0 = ScreenStates::BLANC;
-            }
-            if (x1 == ScreenStates::MIX1TO6_ENTANGLED) {
-                prevX1 = ScreenStates::BLANC;
+// Render every face whose bit is set in redrawFaces. Faces with identical content are grouped and
+// each group is rendered once through the combined chip-select masks of hwPins.screenAddress.
+static void renderPlanned(const std::array<FaceKey, FACE_COUNT> &faces, uint8_t redrawFaces) {
+    uint8_t pushes = 0;
+    uint8_t drawn  = 0;
+
+    for (uint8_t face = 0; face < FACE_COUNT; face++) {
+        if ((redrawFaces & (1 << face)) == 0) {
+            continue;
+        }
+
+        // Collect all remaining faces that show the same content
+        const FaceKey &key       = faces[face];
+        uint8_t        groupMask = 0;
+        for (uint8_t other = face; other < FACE_COUNT; other++) {
+            if ((redrawFaces & (1 << other)) != 0 && faces[other] == key) {
+                groupMask |= hwPins.screenAddress[other];
+                redrawFaces &= ~(1 << other);
+                drawn++;
             }
-            if (y1 == ScreenStates::MIX1TO6_ENTANGLED) {
-                prevY1 = ScreenStates::BLANC;
+        }
+
+        // Cover the group with the largest selections that fit inside it
+        for (screenselections selection : MULTICAST_SELECTIONS) {
+            uint8_t selectionMask = hwPins.screenAddress[selection];
+            if (groupMask == 0) {
+                break;
             }
-            if (z1 == ScreenStates::MIX1TO6_ENTANGLED) {
-                prevZ1 = ScreenStates::BLANC;
+            if (selectionMask == 0 || (selectionMask & ~groupMask) != 0) {
+                continue;
             }
-
-            if (!flashColor) { // Flash ended, refresh to normal color
-                debugln("Flash ended - refreshing entangled screens to normal color");
-                x0 = ScreenStates::MIX1TO6;
-                y0 = ScreenStates::MIX1TO6;
-                z0 = ScreenStates::MIX1TO6;
-                x1 = ScreenStates::MIX1TO6;
-                y1 = ScreenStates::MIX1TO6;
-                z1 = ScreenStates::MIX1TO6;
+            if (!isMulticastSafe(key.state) && selection > Z1) {
+                continue;
             }
+            callFunction(key, selection);
+            groupMask &= ~selectionMask;
+            pushes++;
         }
     }
 
-    if (x0 != prevX0) {
-        // debug("X0:");
-        callFunction(x0, screenselections::X0);
-        prevX0 = x0;
-    }
-    if (y0 != prevY0) {
-        // debug("Y0:");
-        callFunction(y0, screenselections::Y0);
-        prevY0 = y0;
-    }
-    if (z0 != prevZ0) {
-        // debug("Z0:");
-        callFunction(z0, screenselections::Z0);
-        prevZ0 = z0;
+    if (drawn > 0) {
+        debugf("Rendered %d faces in %d pushes\n", drawn, pushes);
     }
-    if (x1 != prevX1) {
-        // debug("X1:");
-        callFunction(x1, screenselections::X1);
-        prevX1 = x1;
+}
+
+static auto faceKeyFor(ScreenStates state, uint16_t batteryCentivolts) -> FaceKey {
+    FaceKey key = {state, GC9A01A_WHITE, 0};
+    switch (state) {
+        case ScreenStates::MIX1TO6_ENTANGLED: key.foreground = entangledDotColor(); break;
+        case ScreenStates::ENTANGLED:         key.foreground = entanglement_color_self; break;
+        case ScreenStates::LOWBATTERY:        key.foreground = GC9A01A_RED; break;
+        case ScreenStates::DIAGNOSE:          key.batteryCentivolts = batteryCentivolts; break;
+        case ScreenStates::BLANC:             key.foreground = GC9A01A_BLACK; break;
+        default:                              break;
     }
-    if (y1 != prevY1) {
-        // debug("Y1:");
-        callFunction(y1, screenselections::Y1);
-        prevY1 = y1;
+    return key;
+}
+
+void checkAndCallFunctions(ScreenStates x0, ScreenStates x1, ScreenStates y0, ScreenStates y1,
+                           ScreenStates z0, ScreenStates z1) {
+    // Indexed like the single screenselections (X0, X1, Y0, Y1, Z0, Z1). Nothing is known about
+    // the panels before the first commit, so that one draws every face.
+    static std::array<FaceKey, FACE_COUNT> prevKeys = {};
+    static bool                            drawnOnce = false;
+    std::array<ScreenStates, FACE_COUNT>   states    = {x0, x1, y0, y1, z0, z1};
+    std::array<FaceKey, FACE_COUNT>        faces     = {};
+
+    // The ADC is read once per commit, and only when a face shows the readout. The faces draw
+    // the value in their key, so the text always matches what the diff compared.
+    uint16_t batteryCentivolts = 0;
+    if (std::find(states.begin(), states.end(), ScreenStates::DIAGNOSE) != states.end()) {
+        batteryCentivolts = readBatteryCentivolts();
     }
-    if (z1 != prevZ1) {
-        // debug("Z1:");
-        callFunction(z1, screenselections::Z1);
-        prevZ1 = z1;
+
+    // Redraw a face only when what it would show differs from what it shows now. Colour,
+    // showColors and flashColor changes are part of the key, so they need no special casing.
+    uint8_t redrawFaces = 0;
+    for (uint8_t face = 0; face < FACE_COUNT; face++) {
+        FaceKey key = faceKeyFor(states[face], batteryCentivolts);
+        faces[face] = key;
+        if (!drawnOnce || key != prevKeys[face]) {
+            redrawFaces |= (1 << face);
+            prevKeys[face] = key;
+            redrawStats.performed++;
+        } else {
+            redrawStats.skipped++;
+        }
     }
+    drawnOnce = true;
+
+    renderPlanned(faces, redrawFaces);
 }
 
+auto getFaceRedrawStats() -> FaceRedrawStats {
+    return redrawStats;
+}
+
+// Refresh requests since the last commit; the faces are dirty when non-zero
+static uint8_t pendingRefreshes = 0;
+
 void refreshScreens() {
+    // Only mark the faces dirty. Handlers, the click toggle, the flash timeout and the teleport
+    // path can all ask for a refresh in the same tick; commitScreens() renders the final state
+    // once, so intermediate frames never reach the displays.
+    if (pendingRefreshes < UINT8_MAX) {
+        pendingRefreshes++;
+    }
+}
+
+void commitScreens() {
+    if (pendingRefreshes == 0) {
+        return;
+    }
+    if (pendingRefreshes > 1) {
+        debugf("Coalesced %d screen refreshes into one commit\n", pendingRefreshes);
+    }
+    pendingRefreshes = 0;
+
     // set screens, depending of states
     if (findValues(stateSelf, diceNumberSelf, upSideSelf, x0ReqScreenState, x1ReqScreenState,
                    y0ReqScreenState, y1ReqScreenState, z0ReqScreenState, z1ReqScreenState)) {
@@ -65,6 +65,7 @@ enum class ScreenStates : uint8_t {
     // Quantum superposition states
     MIX1TO6,           // Normal quantum superposition
     MIX1TO6_ENTANGLED, // Entangled superposition (different color)
+    ENTANGLED,         // Entanglement glyph in the entanglement color, during a color flash
 
     // Special states
     LOWBATTERY,
@@ -93,9 +94,17 @@ auto findValues(State state, DiceNumbers diceNumber, UpSide upSide, ScreenStates
 
 void callFunction(ScreenStates result);
 
+// Face redraws done and avoided by checkAndCallFunctions() since boot
+struct FaceRedrawStats {
+    uint32_t performed;
+    uint32_t skipped;
+};
+
 void checkAndCallFunctions(ScreenStates x0, ScreenStates x1, ScreenStates y0, ScreenStates y1,
                            ScreenStates z0, ScreenStates z1);
 void refreshScreens();
+void commitScreens();
+auto getFaceRedrawStats() -> FaceRedrawStats;
 auto selectOneToSix() -> DiceNumbers;
 auto selectOppositeOneToSix(DiceNumbers diceNumberTop) -> DiceNumbers;
 void printDiceStateName(const char *objectName, DiceStates diceState);
@@ -1,26 +1,61 @@
 #include "Screenfunctions.hpp"
 
+#include "AssetStore.hpp"
+#include "BandCanvas.hpp"
 #include "defines.hpp"
 #include "DiceConfigManager.hpp"
+#include "DisplayCommit.hpp"
+#include "FaceSprites.hpp"
 #include "handyHelpers.hpp"
-#include "ImageLibrary/ImageLibrary.hpp"
+#include "ImageAsset.hpp"
+#include "QrEncoder.hpp"
+#include "RenderTarget.hpp"
+#include "Rgb565.hpp"
 #include "ScreenStateDefs.hpp"
 
 #include <Adafruit_GC9A01A.h>
 #include <algorithm>
 #include <Arduino.h>
 
+#if EMBED_IMAGES == 1
+#include "ImageLibrary/ImageLibrary.hpp"
+#define BUILT_IN(image) (&(image))
+#else
+#define BUILT_IN(image) nullptr
+#endif
+
 // Global TFT object - will be initialized dynamically
 Adafruit_GC9A01A tft(-1, -1, -1); // Temporary pins, will be reinitialized
 
-// Global canvas declarations
-static GFXcanvas16 backgroundCanvas(240, 240);
-static GFXcanvas16 imageCanvas(240, 240);
-static GFXcanvas16 staticCanvas(240, 100);
+#if EMBED_IMAGES == 1
+// The image descriptors are constexpr, so an image that does not fit the displays fails the build
+constexpr auto fitsDisplay(const ImageAsset &image) -> bool {
+    return image.width == WIDTH && image.height == HEIGHT;
+}
+static_assert(fitsDisplay(entangled) && fitsDisplay(God_does_not_play_dice)
+                && fitsDisplay(new_die) && fitsDisplay(quantum_labs_twente_RGB)
+                && fitsDisplay(UTwente_logo),
+              "Image size does not match the displays");
+#endif
+
+// Top of the battery readout drawn by voltageIndicator(), below the lines of welcomeInfo()
+constexpr uint16_t VOLTAGE_TOP = 140;
+
+// Side of the largest square that fits on the round panel (240 / sqrt(2)). The QR code and its
+// quiet zone are scaled to fit inside it, so scanners see light modules all around the symbol.
+constexpr uint16_t QR_FIT = 169;
+static_assert(2 * QR_FIT * QR_FIT <= WIDTH * WIDTH
+                && 2 * (QR_FIT + 1) * (QR_FIT + 1) > WIDTH * WIDTH,
+              "QR_FIT must be the side of the square inscribed in the panel");
+static_assert(QrEncoder::MAX_SIZE + (2 * QrEncoder::QUIET_ZONE) <= QR_FIT,
+              "The largest QR code must fit at one pixel per module");
 
 screenselections selectScreen;
 
 void selectScreens(uint8_t binaryCode) {
+    // Chip-select changes must not overtake a frame that is still being pushed
+    displayFence();
+
     // Use hwPins from handyHelpers
     for (int i = 0; i < 6; i++) {
         if ((hwPins.screenAddress[binaryCode] & (1 << i)) != 0) {
@@ -47,58 +82,59 @@ void initDisplays() {
     delay(500);
     tft.begin(); // Initialize the display
     delay(1000);
-    tft.fillScreen(GC9A01A_BLACK);
+    tft.fillScreen(GC9A01A_BLACK); // Full clear once, later pushes skip the hidden corners
 
     selectScreens(XXYY);
-    tft.setRotation(1);
+    tft.setRotation(XY_ROTATION);
 
     selectScreens(ZZ);
-    tft.setRotation(2);
+    tft.setRotation(Z_ROTATION);
 
     selectScreens(NO_ONE); // Deactivate all screens
     delay(100);
 
+    // Map the images in the assets partition
+    initAssetStore();
+
+    // Start the asynchronous frame push
+    initDisplayCommit();
+
+    // Pre-render the dice faces into PSRAM
+    initFaceSprites();
+
     Serial.println("Displays initialized successfully!");
 }
 
 void blankScreen(uint8_t screens) {
-    selectScreens(screens);
-    tft.fillScreen(GC9A01A_BLACK);
+    RenderTarget &target = renderTarget();
+    target.select(screens);
+    target.fill(GC9A01A_BLACK);
 }
 
 // Function to blend colors with transparency
 auto blendColor(uint16_t foreground, uint16_t background, float alpha) -> uint16_t {
-    // Constrain alpha between 0 and 1
-    alpha = constrain(alpha, 0.0, 1.0);
-
-    // Extract color components
-    uint8_t fR = (foreground >> 11) & 0x1F;
-    uint8_t fG = (foreground >> 5) & 0x3F;
-    uint8_t fB = foreground & 0x1F;
-
-    uint8_t bR = (background >> 11) & 0x1F;
-    uint8_t bG = (background >> 5) & 0x3F;
-    uint8_t bB = background & 0x1F;
-
-    // Blend color components
-    uint8_t rR = ((fR * alpha) + (bR * (1 - alpha)));
-    uint8_t rG = ((fG * alpha) + (bG * (1 - alpha)));
-    uint8_t rB = ((fB * alpha) + (bB * (1 - alpha)));
-
-    // Reconstruct 16-bit color
-    return ((rR & 0x1F) << 11) | ((rG & 0x3F) << 5) | (rB & 0x1F);
+    return blendRgb565(foreground, background, rgb565AlphaFromFloat(alpha));
 }
 
 // Function to draw dot on dice with transparency
 void drawDot(int x, int y, float alpha, uint16_t color, uint16_t bgColor) {
     uint16_t blendedColor = blendColor(color, bgColor, alpha);
-    tft.fillCircle(x, y, DOT_RADIUS, blendedColor);
+    renderTarget().circle(x, y, DOT_RADIUS, blendedColor);
 }
 
-void displayImageWithBackground(const unsigned short *image, uint8_t screens) {
-    // Select the appropriate screens
-    selectScreens(screens);
+// Draw a single line of text horizontally centred on the face
+static void drawTextCentered(RenderTarget &target, const char *text, int16_t y,
+                             const GFXfont *font, uint16_t color) {
+    int16_t x = (WIDTH - RenderTarget::textWidth(text, font)) / 2;
+    target.textRun(text, x, y, font, color);
+}
+
+void displayImageWithBackground(const ImageAsset &image, uint8_t screens) {
+    displayImageWithBackground(image, screens, image.foreground);
+}
 
+// Mask images are drawn in `foreground`, so a new colour is a re-blit rather than a new image
+void displayImageWithBackground(const ImageAsset &image, uint8_t screens, uint16_t foreground) {
     // Choose background color based on screen - use config values
     uint16_t backgroundColor = 0;
     switch (screens) {
@@ -108,245 +144,206 @@ void displayImageWithBackground(const unsigned short *image, uint8_t screens) {
         default: backgroundColor = 0x0000; // Black
     }
 
-    // Fill background canvas with selected color
-    backgroundCanvas.fillScreen(backgroundColor);
-
-    // Clear image canvas
-    imageCanvas.fillScreen(0x0000); // Transparent black
-
-    // Draw image on image canvas
-    for (int y = 0; y < HEIGHT; y++) {
-        for (int x = 0; x < WIDTH; x++) {
-            // Calculate pixel index
-            uint32_t pixelIndex = (y * WIDTH) + x;
-
-            // Read pixel color from PROGMEM
-            uint16_t pixelColor = pgm_read_word(&image[pixelIndex]);
-
-            // Draw non-transparent pixels
-            if (pixelColor != 0x0000) {
-                imageCanvas.drawPixel(x, y, pixelColor);
-            }
-        }
+    if (image.width != WIDTH || image.height != HEIGHT) {
+        warnln("Image does not match the display size");
+        return;
     }
 
-    // Overlay image canvas onto background canvas
-    for (int y = 0; y < HEIGHT; y++) {
-        for (int x = 0; x < WIDTH; x++) {
-            // Get pixel from image canvas
-            uint16_t imagePixel = imageCanvas.getPixel(x, y);
-
-            // If pixel is not transparent, draw it on background canvas
-            if (imagePixel != 0x0000) {
-                backgroundCanvas.drawPixel(x, y, imagePixel);
-            }
+    // Decode one band at a time straight into the line buffer; transparent runs become the
+    // background. Decoding the next band overlaps with pushing the previous one.
+    RenderTarget &target = renderTarget();
+    target.select(screens);
+    ImageDecoder decoder(image, backgroundColor, foreground);
+    uint32_t     startMicros = micros();
+    for (uint16_t top = 0; top < HEIGHT; top += BAND_ROWS) {
+        uint16_t *band = target.acquireRows();
+        if (band == nullptr) {
+            return;
         }
+        if (!decoder.decodeRows(band, BAND_ROWS)) {
+            warnln("Image data ended early");
+        }
+        target.blitRows(band, top, BAND_ROWS);
     }
-
-    // Push final canvas to display
-    tft.drawRGBBitmap(0, 0, backgroundCanvas.getBuffer(), WIDTH, HEIGHT);
+    debugf("Image streamed in %lu us\n", (unsigned long)(micros() - startMicros));
 }
 
-void displayCircle(uint8_t screens) {
-    displayImageWithBackground(circle, screens);
-    debug("Circle on screen: ");
-    debugln(screens);
-}
-
-void displayCross(uint8_t screens) {
-    displayImageWithBackground(cross, screens);
-    debug("Cross on screen: ");
-    debugln(screens);
+// Look an image up in the asset pack, so it can be replaced without rebuilding the firmware, and
+// fall back to the built-in copy
+static auto findImage(const char *name, const ImageAsset *builtIn, ImageAsset &image) -> bool {
+    if (findAsset(name, image)) {
+        return true;
+    }
+    if (builtIn != nullptr) {
+        image = *builtIn;
+        return true;
+    }
+    warnf("Image %s not found\n", name);
+    return false;
 }
 
-void displayCrossCircle(uint8_t screens) {
-    displayImageWithBackground(crossCircle, screens);
-    debug("CrossCircle on screen: ");
-    debugln(screens);
+static void displayImage(const char *name, const ImageAsset *builtIn, uint8_t screens) {
+    ImageAsset image;
+    if (findImage(name, builtIn, image)) {
+        displayImageWithBackground(image, screens);
+    }
 }
 
 void displayEinstein(uint8_t screens) {
-    displayImageWithBackground(God_does_not_play_dice, screens);
+    displayImage("God_does_not_play_dice", BUILT_IN(God_does_not_play_dice), screens);
     debug("Einstein on screen: ");
     debugln(screens);
 }
 
 void displayEntangled(uint8_t screens) {
-    displayImageWithBackground(entangled, screens);
+    // The glyph is a mask, drawn in the colour of the current entanglement
+    ImageAsset image;
+    if (findImage("entangled", BUILT_IN(entangled), image)) {
+        displayImageWithBackground(image, screens, entanglement_color_self);
+    }
     debug("entangled on screen: ");
     debugln(screens);
 }
 
 void displayLowBattery(uint8_t screens) {
-    selectScreens(screens);
+    RenderTarget &target = renderTarget();
+    target.select(screens);
     // Clear the screen
-    tft.fillScreen(GC9A01A_BLACK);
-
-    // Set text color
-    tft.setTextColor(GC9A01A_RED);
+    target.fill(GC9A01A_BLACK);
 
-    // First line configuration
-    tft.setFont(&FreeSansBold18pt7b);
-    tft.setTextSize(1);
-
-    drawStringCentered(tft, "Low Battery", (tft.height() / 2) + 9);
+    drawTextCentered(target, "Low Battery", (HEIGHT / 2) + 9, &FreeSansBold18pt7b, GC9A01A_RED);
 }
 
 void displayNewDie(uint8_t screens) {
-    displayImageWithBackground(new_die, screens);
+    displayImage("new_die", BUILT_IN(new_die), screens);
     debug("Reset Ok on screen: ");
     debugln(screens);
 }
 
 void displayQLab(uint8_t screens) {
-    displayImageWithBackground(quantum_labs_twente_RGB, screens);
+    displayImage("quantum_labs_twente_RGB", BUILT_IN(quantum_labs_twente_RGB), screens);
     debug("Qlab logo on screen: ");
     debugln(screens);
 }
 
 void displayUTlogo(uint8_t screens) {
-    displayImageWithBackground(UTwente_logo, screens);
+    displayImage("UTwente_logo", BUILT_IN(UTwente_logo), screens);
     debug("UTwente logo on screen: ");
     debugln(screens);
 }
 
 void displayQRcode(uint8_t screens) {
-    displayImageWithBackground(QRCode, screens);
+    // The URL only changes with the config, so the code is encoded once
+    static QrEncoder qr;
+    static String    encodedUrl;
+    if (qr.size() == 0 || encodedUrl != currentConfig.qrUrl) {
+        encodedUrl = currentConfig.qrUrl;
+        if (!qr.encode(encodedUrl.c_str())) {
+            warnf("QR URL is too long (%u characters)\n", encodedUrl.length());
+        }
+    }
+
+    RenderTarget &target = renderTarget();
+    target.select(screens);
+    if (qr.size() == 0) {
+        target.fill(GC9A01A_BLACK);
+        return;
+    }
+
+    // Dark modules on a white face; the white around the code is the quiet zone. Every run of
+    // dark modules is a filled rect, clipped to the band being composed.
+    uint8_t  scale  = QR_FIT / (qr.size() + (2 * QrEncoder::QUIET_ZONE));
+    uint16_t side   = qr.size() * scale;
+    uint16_t origin = (WIDTH - side) / 2;
+    for (uint16_t top = 0; top < HEIGHT; top += BAND_ROWS) {
+        uint16_t *band = target.acquireRows();
+        if (band == nullptr) {
+            return;
+        }
+        std::fill_n(band, WIDTH * BAND_ROWS, GC9A01A_WHITE);
+        for (uint16_t row = 0; row < BAND_ROWS; row++) {
+            uint16_t y = top + row;
+            if (y < origin || y >= origin + side) {
+                continue;
+            }
+            uint8_t   moduleY = (y - origin) / scale;
+            uint16_t *line    = band + (row * WIDTH) + origin;
+            for (uint8_t x = 0; x < qr.size();) {
+                uint8_t end = x;
+                while (end < qr.size() && qr.module(end, moduleY)) {
+                    end++;
+                }
+                std::fill_n(line + (x * scale), (end - x) * scale, GC9A01A_BLACK);
+                x = end + 1;
+            }
+        }
+        target.blitRows(band, top, BAND_ROWS);
+    }
     debug("QR code on screen: ");
     debugln(screens);
 }
 
-void displayN1(uint8_t screens) {
-    selectScreens(screens);
-    tft.fillScreen(GC9A01A_BLACK);
-    int centerX = tft.width() / 2;
-    int centerY = tft.height() / 2;
+// Show a dice face from the sprite cache, or draw it directly when there is no PSRAM
+static void displayFace(FaceSprite sprite, uint16_t dotColor, uint8_t screens) {
+    uint16_t     *pixels = getFaceSprite(sprite, dotColor, GC9A01A_BLACK);
+    RenderTarget &target = renderTarget();
+    target.select(screens);
+    if (pixels != nullptr) {
+        target.blit(pixels);
+    } else {
+        drawFaceDirect(target, sprite, dotColor, GC9A01A_BLACK);
+    }
+}
 
-    drawDot(centerX, centerY);
+void displayN1(uint8_t screens) {
+    displayFace(FaceSprite::N1, GC9A01A_WHITE, screens);
 }
 
 void displayN2(uint8_t screens) {
-    selectScreens(screens);
-    tft.fillScreen(GC9A01A_BLACK);
-    int centerX = tft.width() / 2;
-    int centerY = tft.height() / 2;
-    int offset  = DOT_OFFSET;
-
-    drawDot(centerX - offset, centerY + offset);
-    drawDot(centerX + offset, centerY - offset);
+    displayFace(FaceSprite::N2, GC9A01A_WHITE, screens);
 }
 
 void displayN3(uint8_t screens) {
-    selectScreens(screens);
-    tft.fillScreen(GC9A01A_BLACK);
-    int centerX = tft.width() / 2;
-    int centerY = tft.height() / 2;
-    int offset  = DOT_OFFSET;
-
-    drawDot(centerX - offset, centerY + offset);
-    drawDot(centerX, centerY);
-    drawDot(centerX + offset, centerY - offset);
+    displayFace(FaceSprite::N3, GC9A01A_WHITE, screens);
 }
 
 void displayN4(uint8_t screens) {
-    selectScreens(screens);
-    tft.fillScreen(GC9A01A_BLACK);
-    int centerX = tft.width() / 2;
-    int centerY = tft.height() / 2;
-    int offset  = DOT_OFFSET;
-
-    drawDot(centerX - offset, centerY - offset);
-    drawDot(centerX + offset, centerY - offset);
-    drawDot(centerX - offset, centerY + offset);
-    drawDot(centerX + offset, centerY + offset);
+    displayFace(FaceSprite::N4, GC9A01A_WHITE, screens);
 }
 
 void displayN5(uint8_t screens) {
-    selectScreens(screens);
-    tft.fillScreen(GC9A01A_BLACK);
-    int centerX = tft.width() / 2;
-    int centerY = tft.height() / 2;
-    int offset  = DOT_OFFSET;
-
-    drawDot(centerX - offset, centerY - offset);
-    drawDot(centerX + offset, centerY - offset);
-    drawDot(centerX, centerY, 1.0);
-    drawDot(centerX - offset, centerY + offset);
-    drawDot(centerX + offset, centerY + offset);
+    displayFace(FaceSprite::N5, GC9A01A_WHITE, screens);
 }
 
 void displayN6(uint8_t screens) {
-    selectScreens(screens);
-    tft.fillScreen(GC9A01A_BLACK);
-    int centerX = tft.width() / 2;
-    int centerY = tft.height() / 2;
-    int offset  = DOT_OFFSET;
-
-    drawDot(centerX - offset, centerY - offset);
-    drawDot(centerX + offset, centerY - offset);
-    drawDot(centerX - offset, centerY);
-    drawDot(centerX + offset, centerY);
-    drawDot(centerX - offset, centerY + offset);
-    drawDot(centerX + offset, centerY + offset);
+    displayFace(FaceSprite::N6, GC9A01A_WHITE, screens);
 }
 
 void displayMix1to6(uint8_t screens) {
-    selectScreens(screens);
-    tft.fillScreen(GC9A01A_BLACK);
-    int centerX = tft.width() / 2;
-    int centerY = tft.height() / 2;
-    int offset  = DOT_OFFSET;
-
-    drawDot(centerX - offset, centerY - offset, (3 * 0.16) + 0.2);
-    drawDot(centerX + offset, centerY - offset, (5 * 0.16) + 0.2);
-    drawDot(centerX - offset, centerY, (1 * 0.16) + 0.2);
-    drawDot(centerX + offset, centerY, 1 * 0.2);
-    drawDot(centerX - offset, centerY + offset, (5 * 0.16) + 0.2);
-    drawDot(centerX + offset, centerY + offset, (3 * 0.16) + 0.2);
-    drawDot(centerX, centerY, 3 * 0.2);
+    displayFace(FaceSprite::MIX1TO6, GC9A01A_WHITE, screens);
 }
 
-void displayMix1to6_entangled(uint8_t screens) {
-    selectScreens(screens);
-    tft.fillScreen(GC9A01A_BLACK);
-    int centerX = tft.width() / 2;
-    int centerY = tft.height() / 2;
-    int offset  = DOT_OFFSET;
-
-    // Determine color to show
-    uint16_t color;
-    if (showColors) {
-        // Show colors enabled - always show the entanglement color
-        color = entanglement_color_self;
-    } else {
-        // Show colors disabled - check if we're in flash mode
-        if (flashColor) {
-            // Flash active - show actual color
-            color = entanglement_color_self;
-        } else {
-            // Flash inactive - show white
-            color = 0xFFFF;
-        }
+// Dot colour of the entangled superposition face
+auto entangledDotColor() -> uint16_t {
+    // Show colors enabled - always show the entanglement color
+    // Show colors disabled - only show the actual color while flashing
+    if (showColors || flashColor) {
+        return entanglement_color_self;
     }
+    // Flash inactive - show white
+    return 0xFFFF;
+}
 
-    drawDot(centerX - offset, centerY - offset, (3 * 0.16) + 0.2, color);
-    drawDot(centerX + offset, centerY - offset, (5 * 0.16) + 0.2, color);
-    drawDot(centerX - offset, centerY, (1 * 0.16) + 0.2, color);
-    drawDot(centerX + offset, centerY, (1 * 0.16) + 0.2, color);
-    drawDot(centerX - offset, centerY + offset, (5 * 0.16) + 0.2, color);
-    drawDot(centerX + offset, centerY + offset, (3 * 0.16) + 0.2, color);
-    drawDot(centerX, centerY, (3 * 0.16) + 0.2, color);
+void displayMix1to6_entangled(uint8_t screens) {
+    displayFace(FaceSprite::MIX1TO6_ENTANGLED, entangledDotColor(), screens);
 }
 
 void printChar(uint8_t screens, char *letters, uint16_t fontcolor, uint16_t bckcolor, int x,
                int y) {
-    selectScreens(screens);
-    tft.fillScreen(bckcolor);
-    tft.setTextColor(fontcolor);
-    tft.setFont(&FreeSansBold18pt7b);
-    tft.setTextSize(1);
-    tft.setCursor(x, y);
-    tft.print(letters);
+    RenderTarget &target = renderTarget();
+    target.select(screens);
+    target.fill(bckcolor);
+    target.textRun(letters, x, y, &FreeSansBold18pt7b, fontcolor);
 }
 
 void drawStringCentered(Adafruit_GFX &gfx, const String &text, int16_t y) {
@@ -369,13 +366,20 @@ void drawStringCentered(Adafruit_GFX &gfx, const String &text, int16_t y) {
     gfx.print(text);
 }
 
-void voltageIndicator(uint8_t screens) {
+auto readBatteryCentivolts() -> uint16_t {
+    // Use hwPins.adc_pin from configuration; the battery sits behind a 1:2 divider
+    return (uint16_t)((analogReadMilliVolts(hwPins.adc_pin) * 2 + 5) / 10);
+}
+
+void voltageIndicator(uint8_t screens, uint16_t batteryCentivolts) {
     char bufferV[10];
     char bufferPerc[10];
-    selectScreens(screens);
 
-    // Use hwPins.adc_pin from configuration
-    double voltage = analogReadMilliVolts(hwPins.adc_pin) / 1000.0 * 2.0;
+    RenderTarget &target = renderTarget();
+    target.select(screens);
+
+    // The caller's reading, already rounded to the two decimals that are shown
+    double voltage = batteryCentivolts / 100.0;
     double percentage
       = mapFloat((float)voltage, MINBATERYVOLTAGE, MAXBATERYVOLTAGE, 0.0, 100.0, true);
     percentage = std::min<double>(percentage, 100.0);
@@ -384,69 +388,71 @@ void voltageIndicator(uint8_t screens) {
     dtostrf(percentage, 3, 0, (char *)bufferPerc);
     strcat((char *)bufferPerc, "%");
 
-    // Clear the canvas
-    staticCanvas.fillScreen(GC9A01A_BLACK);
-
-    // Set text properties
-    (percentage > 20) ? staticCanvas.setTextColor(GC9A01A_WHITE)
-                      : staticCanvas.setTextColor(GC9A01A_RED);
-    staticCanvas.setTextSize(1);
-    staticCanvas.setFont(&FreeSans18pt7b);
+    uint16_t textColor = (percentage > 20) ? GC9A01A_WHITE : GC9A01A_RED;
 
-    // Draw centered text
-    int16_t  x1 = 0;
-    int16_t  y1 = 0;
-    uint16_t w  = 0;
-    uint16_t h  = 0;
-
-    // Center voltage text
-    staticCanvas.getTextBounds((char *)bufferV, 0, 0, &x1, &y1, &w, &h);
-    int16_t x = (staticCanvas.width() - w) / 2;
-    staticCanvas.setCursor(x, 30);
-    staticCanvas.print((char *)bufferV);
-
-    // Center percentage text
-    staticCanvas.getTextBounds((char *)bufferPerc, 0, 0, &x1, &y1, &w, &h);
-    x = (staticCanvas.width() - w) / 2;
-    staticCanvas.setCursor(x, 70);
-    staticCanvas.print((char *)bufferPerc);
-
-    // Draw a horizontal line
-    staticCanvas.drawFastHLine(0, 40, 5, GC9A01A_RED);
-
-    // Draw the canvas to the TFT
-    tft.drawRGBBitmap(0, 140, staticCanvas.getBuffer(), staticCanvas.width(),
-                      staticCanvas.height());
+    // Stream the readout in bands; the text is replayed into every band it crosses
+    for (uint16_t top = VOLTAGE_TOP; top < HEIGHT; top += BAND_ROWS) {
+        uint16_t  rows = std::min<uint16_t>(BAND_ROWS, HEIGHT - top);
+        uint16_t *band = target.acquireRows();
+        if (band == nullptr) {
+            return;
+        }
+        BandCanvas canvas(band, top, rows);
+
+        // Clear the band
+        canvas.fillScreen(GC9A01A_BLACK);
+
+        // Set text properties
+        canvas.setTextColor(textColor);
+        canvas.setTextSize(1);
+        canvas.setFont(&FreeSans18pt7b);
+
+        // Draw centered text
+        int16_t  x1 = 0;
+        int16_t  y1 = 0;
+        uint16_t w  = 0;
+        uint16_t h  = 0;
+
+        // Center voltage text
+        canvas.getTextBounds((char *)bufferV, 0, 0, &x1, &y1, &w, &h);
+        int16_t x = (canvas.width() - w) / 2;
+        canvas.setCursor(x, VOLTAGE_TOP + 30);
+        canvas.print((char *)bufferV);
+
+        // Center percentage text
+        canvas.getTextBounds((char *)bufferPerc, 0, 0, &x1, &y1, &w, &h);
+        x = (canvas.width() - w) / 2;
+        canvas.setCursor(x, VOLTAGE_TOP + 70);
+        canvas.print((char *)bufferPerc);
+
+        // Draw a horizontal line
+        canvas.drawFastHLine(0, VOLTAGE_TOP + 40, 5, GC9A01A_RED);
+
+        target.blitRows(band, top, rows);
+    }
 }
 
 void welcomeInfo(uint8_t screens) {
     char displayText1[10];
     char displayText2[20];
-    selectScreens(screens);
-    tft.fillScreen(GC9A01A_BLACK);
-    tft.setTextSize(1);
-    tft.setFont(&FreeSans18pt7b);
+    RenderTarget &target = renderTarget();
+    target.select(screens);
+    target.fill(GC9A01A_BLACK);
 
     strcpy((char *)displayText1, "FW");
     strcat((char *)displayText1, VERSION);
-    drawStringCentered(tft, (char *)displayText1, 62);
+    drawTextCentered(target, (char *)displayText1, 62, &FreeSans18pt7b, GC9A01A_WHITE);
 
     // Use DICE_ID from config
     strcpy((char *)displayText2, (char *)currentConfig.diceId.c_str());
-    drawStringCentered(tft, (char *)displayText2, 104);
+    drawTextCentered(target, (char *)displayText2, 104, &FreeSans18pt7b, GC9A01A_WHITE);
 }
 
 void showConfigMode(uint8_t screens) {
-    selectScreens(screens);
+    RenderTarget &target = renderTarget();
+    target.select(screens);
     // Clear the screen
-    tft.fillScreen(GC9A01A_BLACK);
-
-    // Set text color
-    tft.setTextColor(GC9A01A_RED);
-
-    // First line configuration
-    tft.setFont(&FreeSansBold18pt7b);
-    tft.setTextSize(1);
+    target.fill(GC9A01A_BLACK);
 
-    drawStringCentered(tft, "Setup Mode", (tft.height() / 2) + 9);
+    drawTextCentered(target, "Setup Mode", (HEIGHT / 2) + 9, &FreeSansBold18pt7b, GC9A01A_RED);
 }
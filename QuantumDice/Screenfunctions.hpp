@@ -1,5 +1,7 @@
 #ifndef SCREENFUNCTIONS_H_
 #define SCREENFUNCTIONS_H_
+#include "ImageAsset.hpp"
+
 #include <Adafruit_GC9A01A.h>
 #include <Adafruit_GFX.h>
 #include <Fonts/FreeSans18pt7b.h>
@@ -14,6 +16,10 @@
 #define DOT_RADIUS 20
 #define DOT_OFFSET 60
 
+// Panel rotations set in initDisplays()
+constexpr uint8_t XY_ROTATION = 1;
+constexpr uint8_t Z_ROTATION  = 2;
+
 // Screen selection enum (moved from conditional compilation)
 enum screenselections : uint8_t {
     X0,
@@ -41,12 +47,10 @@ void selectScreens(uint8_t binaryCode);
 auto blendColor(uint16_t foreground, uint16_t background, float alpha) -> uint16_t;
 void drawDot(int x, int y, float alpha = 1.0, uint16_t color = GC9A01A_WHITE,
              uint16_t bgColor = GC9A01A_BLACK);
-void displayImageWithBackground(const unsigned short *image, uint8_t screens);
+void displayImageWithBackground(const ImageAsset &image, uint8_t screens);
+void displayImageWithBackground(const ImageAsset &image, uint8_t screens, uint16_t foreground);
 void initDisplays();
 void blankScreen(uint8_t screens);
-void displayCircle(uint8_t screens);
-void displayCross(uint8_t screens);
-void displayCrossCircle(uint8_t screens);
 void displayEinstein(uint8_t screens);
 void displayEntangled(uint8_t screens);
 void displayLowBattery(uint8_t screens);
@@ -64,8 +68,10 @@ void displayN5(uint8_t screens);
 void displayN6(uint8_t screens);
 void displayMix1to6(uint8_t screens);
 void displayMix1to6_entangled(uint8_t screens);
+auto entangledDotColor() -> uint16_t;
 void printChar(uint8_t screens, char *letters, uint16_t fontcolor, uint16_t bckcolor, int x, int y);
-void voltageIndicator(uint8_t screens);
+auto readBatteryCentivolts() -> uint16_t;
+void voltageIndicator(uint8_t screens, uint16_t batteryCentivolts);
 void welcomeInfo(uint8_t screens);
 void drawStringCentered(Adafruit_GFX &gfx, const String &text, int16_t y);
 void showConfigMode(uint8_t screens);
@@ -0,0 +1,12 @@
+#ifndef SENDRESULT_H_
+#define SENDRESULT_H_
+
+#include <cstdint>
+
+enum class SendResult : uint8_t {
+    SENT,        // Handed to the radio; delivery is reported later
+    WOULD_BLOCK, // All send buffers are in flight, try again later
+    FAILED,      // Refused by the radio
+};
+
+#endif /* SENDRESULT_H_ */
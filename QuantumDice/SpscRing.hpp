@@ -0,0 +1,80 @@
+#ifndef SPSCRING_H_
+#define SPSCRING_H_
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+/*
+   SpscRing - fixed-capacity lock-free queue for one producer and one consumer
+
+   Used between the ESP-NOW callbacks, which run in the Wi-Fi task, and the main loop.
+   push() is only called by the producer and pop() only by the consumer; both are wait-free and
+   never allocate. The indices count up freely and are reduced modulo the power-of-two capacity,
+   so a full ring uses every slot.
+
+   The policy when full is drop-newest: push() discards the new item and counts it in drops().
+   The items already queued are older and the consumer has not seen them yet, so overwriting them
+   from the producer side would race with a pop() that is copying them out.
+*/
+
+// The two indices are written by different cores; keeping them on separate cache lines stops
+// one core's writes from invalidating the line the other core is polling
+constexpr size_t SPSC_CACHE_LINE = 32; // ESP32-S3 data cache line
+
+template <typename T, size_t N> class SpscRing {
+    static_assert(N > 0 && (N & (N - 1)) == 0, "Capacity must be a power of two");
+
+  public:
+    // Producer only. Returns false and counts a drop when the ring is full.
+    auto push(const T &item) -> bool {
+        uint32_t tail = tailIndex.load(std::memory_order_relaxed);
+        if (tail - headIndex.load(std::memory_order_acquire) == N) {
+            dropCount.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        slots[tail % N] = item;
+        tailIndex.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer only. Returns false when the ring is empty.
+    auto pop(T &item) -> bool {
+        uint32_t head = headIndex.load(std::memory_order_relaxed);
+        if (head == tailIndex.load(std::memory_order_acquire)) {
+            return false;
+        }
+        item = slots[head % N];
+        headIndex.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Exact from the consumer, a snapshot from anywhere else
+    [[nodiscard]] auto size() const -> size_t {
+        return tailIndex.load(std::memory_order_acquire)
+               - headIndex.load(std::memory_order_acquire);
+    }
+
+    [[nodiscard]] auto isEmpty() const -> bool {
+        return size() == 0;
+    }
+
+    [[nodiscard]] auto drops() const -> uint32_t {
+        return dropCount.load(std::memory_order_relaxed);
+    }
+
+    static constexpr auto capacity() -> size_t {
+        return N;
+    }
+
+  private:
+    // Written by the consumer
+    alignas(SPSC_CACHE_LINE) std::atomic<uint32_t> headIndex = 0;
+    // Written by the producer
+    alignas(SPSC_CACHE_LINE) std::atomic<uint32_t> tailIndex = 0;
+    std::atomic<uint32_t>                          dropCount = 0;
+    std::array<T, N>                               slots     = {};
+};
+
+#endif /* SPSCRING_H_ */
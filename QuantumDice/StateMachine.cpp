@@ -2,123 +2,100 @@
 
 #include "defines.hpp"
 #include "DiceConfigManager.hpp"
-#include "EspNowSensor.hpp"
 #include "handyHelpers.hpp"
 #include "IMUhelpers.hpp"
+#include "MessageTransport.hpp"
 #include "Screenfunctions.hpp"
 #include "ScreenStateDefs.hpp"
 
-#include <map>
-
-using message_type = enum message_type : uint8_t {
-    MESSAGE_TYPE_WATCH_DOG,
-    MESSAGE_TYPE_MEASUREMENT,
-    MESSAGE_TYPE_ENTANGLE_REQUEST,
-    MESSAGE_TYPE_ENTANGLE_CONFIRM,
-    MESSAGE_TYPE_ENTANGLE_DENIED,
-    MESSAGE_TYPE_TELEPORT_REQUEST,
-    MESSAGE_TYPE_TELEPORT_CONFIRM,
-    MESSAGE_TYPE_TELEPORT_PAYLOAD,
-    MESSAGE_TYPE_TELEPORT_PARTNER
-};
+static uint8_t last_source[6];
+static int32_t last_rssi = INT32_MIN;
 
-using message = struct message {
-    message_type type;
-
-    union _data {
-        struct _watchDogData {
-            State state;
-        } watchDog;
-
-        struct _measurementData {
-            State          state;
-            MeasuredAxises measureAxis;
-            DiceNumbers    diceNumber;
-            UpSide         upSide;
-        } measurement;
-
-        struct _entangleConfirmData {
-            uint16_t color; // RGB565 color for this entanglement
-        } entangleConfirm;
-
-        struct _teleportRequestData {
-            uint8_t target_dice[6]; // MAC address of dice B (the target for teleportation)
-        } teleportRequest;
-
-        struct _teleportPayloadData {
-            State          state;             // State of dice M to be transferred to B
-            MeasuredAxises measureAxis;       // Measurement axis if observed
-            DiceNumbers    diceNumber;        // Dice number if observed
-            UpSide         upSide;            // Up side if observed
-            uint8_t        entangled_peer[6]; // MAC of N if M is entangled to N
-            uint16_t       color;             // Entanglement color (RGB565)
-        } teleportPayload;
-
-        struct _teleportPartnerData {
-            uint8_t new_partner[6]; // MAC address of B (the new partner for N)
-        } teleportPartner;
-    } data;
+// A send that found every transport buffer in use, see StateMachine::sendMessage()
+struct DeferredSend {
+    message       data;
+    uint8_t       target[MAC_ADDRESS_LENGTH];
+    unsigned long deferredAt; // millis()
 };
 
-static uint8_t last_source[6];
-static int32_t last_rssi = INT32_MIN;
+// Ring buffer of sends waiting for retryDeferredSends()
+static std::array<DeferredSend, DEFERRED_SEND_SIZE> deferredSends = {};
+static uint8_t                                      deferredHead  = 0;
+static uint8_t                                      deferredCount = 0;
 
 // State function mappings for the quantum dice system
-// Maps each state combination to its enter and while functions
-const std::map<State, StateMachine::StateFunction> StateMachine::stateFunctions = {
-  // === CLASSIC MODE ===
-  {State{Mode::CLASSIC, ThrowState::IDLE, EntanglementState::PURE},
-   {&StateMachine::enterClassicIdle, &StateMachine::whileClassicIdle}},
-
-  // === QUANTUM MODE - IDLE ===
-  // Pure quantum state (no entanglement)
-  {State{Mode::QUANTUM, ThrowState::IDLE, EntanglementState::PURE},
-   {&StateMachine::enterQuantumIdle, &StateMachine::whileQuantumIdle}},
-
-  // Entanglement requested (waiting for partner confirmation)
-  {State{Mode::QUANTUM, ThrowState::IDLE, EntanglementState::ENTANGLE_REQUESTED},
-   {&StateMachine::enterQuantumIdle, &StateMachine::whileQuantumIdle}},
-
-  // Entangled with partner
-  {State{Mode::QUANTUM, ThrowState::IDLE, EntanglementState::ENTANGLED},
-   {&StateMachine::enterQuantumIdle, &StateMachine::whileQuantumIdle}},
-
-  // Post-entanglement (partner has measured, waiting for our measurement)
-  {State{Mode::QUANTUM, ThrowState::IDLE, EntanglementState::POST_ENTANGLEMENT},
-   {&StateMachine::enterQuantumIdle, &StateMachine::whileQuantumIdle}},
-
-  // Teleported state (received teleported measurement, waiting for our measurement)
-  {State{Mode::QUANTUM, ThrowState::IDLE, EntanglementState::TELEPORTED},
-   {&StateMachine::enterQuantumIdle, &StateMachine::whileQuantumIdle}},
-
-  // === QUANTUM MODE - THROWING ===
-  {State{Mode::QUANTUM, ThrowState::THROWING, EntanglementState::PURE},
-   {&StateMachine::enterThrowing, &StateMachine::whileThrowing}      },
-  {State{Mode::QUANTUM, ThrowState::THROWING, EntanglementState::ENTANGLE_REQUESTED},
-   {&StateMachine::enterThrowing, &StateMachine::whileThrowing}      },
-  {State{Mode::QUANTUM, ThrowState::THROWING, EntanglementState::ENTANGLED},
-   {&StateMachine::enterThrowing, &StateMachine::whileThrowing}      },
-  {State{Mode::QUANTUM, ThrowState::THROWING, EntanglementState::POST_ENTANGLEMENT},
-   {&StateMachine::enterThrowing, &StateMachine::whileThrowing}      },
-  {State{Mode::QUANTUM, ThrowState::THROWING, EntanglementState::TELEPORTED},
-   {&StateMachine::enterThrowing, &StateMachine::whileThrowing}      },
-
-  // === QUANTUM MODE - OBSERVED ===
-  {State{Mode::QUANTUM, ThrowState::OBSERVED, EntanglementState::PURE},
-   {&StateMachine::enterObserved, &StateMachine::whileObserved}      },
-  {State{Mode::QUANTUM, ThrowState::OBSERVED, EntanglementState::ENTANGLE_REQUESTED},
-   {&StateMachine::enterObserved, &StateMachine::whileObserved}      },
-  {State{Mode::QUANTUM, ThrowState::OBSERVED, EntanglementState::ENTANGLED},
-   {&StateMachine::enterObserved, &StateMachine::whileObserved}      },
-  {State{Mode::QUANTUM, ThrowState::OBSERVED, EntanglementState::POST_ENTANGLEMENT},
-   {&StateMachine::enterObserved, &StateMachine::whileObserved}      },
-  {State{Mode::QUANTUM, ThrowState::OBSERVED, EntanglementState::TELEPORTED},
-   {&StateMachine::enterObserved, &StateMachine::whileObserved}      },
-
-  // === LOW BATTERY MODE ===
-  {State{Mode::LOW_BATTERY, ThrowState::IDLE, EntanglementState::PURE},
-   {&StateMachine::enterLowBattery, &StateMachine::whileLowBattery}}
-};
+// Maps each state combination to its enter and while functions, in a table indexed by stateId().
+// States that are not listed have no handlers; handlersCoverReachableStates() checks at compile
+// time that no transition leads into one of them.
+constexpr auto StateMachine::buildStateFunctions() -> StateFunctionTable {
+    struct StateHandler {
+        State         state;
+        StateFunction functions;
+    };
+
+    constexpr StateHandler handlers[] = {
+      // === CLASSIC MODE ===
+      {State{Mode::CLASSIC, ThrowState::IDLE, EntanglementState::PURE},
+       {&StateMachine::enterClassicIdle, &StateMachine::whileClassicIdle}},
+
+      // === QUANTUM MODE - IDLE ===
+      // Pure quantum state (no entanglement)
+      {State{Mode::QUANTUM, ThrowState::IDLE, EntanglementState::PURE},
+       {&StateMachine::enterQuantumIdle, &StateMachine::whileQuantumIdle}},
+
+      // Entanglement requested (waiting for partner confirmation)
+      {State{Mode::QUANTUM, ThrowState::IDLE, EntanglementState::ENTANGLE_REQUESTED},
+       {&StateMachine::enterQuantumIdle, &StateMachine::whileQuantumIdle}},
+
+      // Entangled with partner
+      {State{Mode::QUANTUM, ThrowState::IDLE, EntanglementState::ENTANGLED},
+       {&StateMachine::enterQuantumIdle, &StateMachine::whileQuantumIdle}},
+
+      // Post-entanglement (partner has measured, waiting for our measurement)
+      {State{Mode::QUANTUM, ThrowState::IDLE, EntanglementState::POST_ENTANGLEMENT},
+       {&StateMachine::enterQuantumIdle, &StateMachine::whileQuantumIdle}},
+
+      // Teleported state (received teleported measurement, waiting for our measurement)
+      {State{Mode::QUANTUM, ThrowState::IDLE, EntanglementState::TELEPORTED},
+       {&StateMachine::enterQuantumIdle, &StateMachine::whileQuantumIdle}},
+
+      // === QUANTUM MODE - THROWING ===
+      {State{Mode::QUANTUM, ThrowState::THROWING, EntanglementState::PURE},
+       {&StateMachine::enterThrowing, &StateMachine::whileThrowing}},
+      {State{Mode::QUANTUM, ThrowState::THROWING, EntanglementState::ENTANGLE_REQUESTED},
+       {&StateMachine::enterThrowing, &StateMachine::whileThrowing}},
+      {State{Mode::QUANTUM, ThrowState::THROWING, EntanglementState::ENTANGLED},
+       {&StateMachine::enterThrowing, &StateMachine::whileThrowing}},
+      {State{Mode::QUANTUM, ThrowState::THROWING, EntanglementState::POST_ENTANGLEMENT},
+       {&StateMachine::enterThrowing, &StateMachine::whileThrowing}},
+      {State{Mode::QUANTUM, ThrowState::THROWING, EntanglementState::TELEPORTED},
+       {&StateMachine::enterThrowing, &StateMachine::whileThrowing}},
+
+      // === QUANTUM MODE - OBSERVED ===
+      {State{Mode::QUANTUM, ThrowState::OBSERVED, EntanglementState::PURE},
+       {&StateMachine::enterObserved, &StateMachine::whileObserved}},
+      {State{Mode::QUANTUM, ThrowState::OBSERVED, EntanglementState::ENTANGLE_REQUESTED},
+       {&StateMachine::enterObserved, &StateMachine::whileObserved}},
+      {State{Mode::QUANTUM, ThrowState::OBSERVED, EntanglementState::ENTANGLED},
+       {&StateMachine::enterObserved, &StateMachine::whileObserved}},
+      {State{Mode::QUANTUM, ThrowState::OBSERVED, EntanglementState::POST_ENTANGLEMENT},
+       {&StateMachine::enterObserved, &StateMachine::whileObserved}},
+      {State{Mode::QUANTUM, ThrowState::OBSERVED, EntanglementState::TELEPORTED},
+       {&StateMachine::enterObserved, &StateMachine::whileObserved}},
+
+      // === LOW BATTERY MODE ===
+      {State{Mode::LOW_BATTERY, ThrowState::IDLE, EntanglementState::PURE},
+       {&StateMachine::enterLowBattery, &StateMachine::whileLowBattery}}
+    };
+
+    StateFunctionTable table = {};
+    for (const StateHandler &handler : handlers) {
+        table[stateId(handler.state)] = handler.functions;
+    }
+    return table;
+}
+
+constexpr StateMachine::StateFunctionTable StateMachine::stateFunctions = buildStateFunctions();
 
 namespace {
     inline auto getModeName(Mode mode) -> char * {
@@ -156,24 +133,127 @@ namespace {
                        getEntanglementStateName(state.entanglementState));
         return (char *)stateName;
     }
+
+    inline auto getTriggerName(Trigger trigger) -> char * {
+        switch (trigger) {
+            case Trigger::BUTTON_PRESSED:       return "BUTTON_PRESSED";
+            case Trigger::START_ROLLING:        return "START_ROLLING";
+            case Trigger::STOP_ROLLING:         return "STOP_ROLLING";
+            case Trigger::CLOSE_BY:             return "CLOSE_BY";
+            case Trigger::ENTANGLE_REQUEST:     return "ENTANGLE_REQUEST";
+            case Trigger::ENTANGLE_CONFIRM:     return "ENTANGLE_CONFIRM";
+            case Trigger::ENTANGLE_STOP:        return "ENTANGLE_STOP";
+            case Trigger::MEASUREMENT_RECEIVED: return "MEASUREMENT_RECEIVED";
+            case Trigger::TELEPORT_INITIATED:   return "TELEPORT_INITIATED";
+            case Trigger::TELEPORT_CONFIRMED:   return "TELEPORT_CONFIRMED";
+            case Trigger::TELEPORT_RECEIVED:    return "TELEPORT_RECEIVED";
+            case Trigger::MEASURE:              return "MEASURE";
+            case Trigger::MEASURE_FAIL:         return "MEASURE_FAIL";
+            case Trigger::TIMED:                return "TIMED";
+            case Trigger::LOW_BATTERY:          return "LOW_BATTERY";
+            default:                            return "UNKNOWN";
+        }
+    }
 }
 
 void printStateName(const char *objectName, State state) {
     debugf("%s: %s\n", objectName, getStateName(state));
 }
 
-void StateMachine::sendWatchDog() {
+// Hands a message to the transport. A refused message is counted and otherwise treated as lost
+// on the air, which the state machine copes with.
+auto StateMachine::transmit(const message &data, uint8_t *target) -> SendResult {
+    SendResult result = _transport->send(data, target);
+    if (result == SendResult::FAILED) {
+        if (sendStats.failed < UINT16_MAX) {
+            sendStats.failed++;
+        }
+        warnf("Send of message type %u failed\n", data.type);
+    }
+    return result;
+}
+
+// Sends a message, or queues it when every transport buffer is in use. A message queues behind
+// those already waiting, so messages to a dice keep their order. update() retries the queue.
+void StateMachine::sendMessage(const message &data, uint8_t *target) {
+    retryDeferredSends();
+    if (deferredCount == 0 && transmit(data, target) != SendResult::WOULD_BLOCK) {
+        return;
+    }
+
+    if (deferredCount == DEFERRED_SEND_SIZE) {
+        if (sendStats.dropped < UINT16_MAX) {
+            sendStats.dropped++;
+        }
+        warnf("Deferred sends full, dropping message type %u\n", data.type);
+        return;
+    }
+    DeferredSend &deferred = deferredSends[(deferredHead + deferredCount) % DEFERRED_SEND_SIZE];
+    deferred.data          = data;
+    memcpy((void *)deferred.target, (void *)target, 6);
+    deferred.deferredAt = millis();
+    deferredCount++;
+    if (sendStats.deferred < UINT16_MAX) {
+        sendStats.deferred++;
+    }
+}
+
+// Sends the deferred messages, oldest first, until the transport is full again. One that waited
+// longer than DEFERRED_SEND_TIMEOUT is dropped, as the state it reports may be gone.
+void StateMachine::retryDeferredSends() {
+    unsigned long now = millis();
+    while (deferredCount > 0) {
+        DeferredSend &deferred = deferredSends[deferredHead];
+        if (now - deferred.deferredAt > DEFERRED_SEND_TIMEOUT) {
+            if (sendStats.expired < UINT16_MAX) {
+                sendStats.expired++;
+            }
+            warnf("Deferred message type %u expired\n", deferred.data.type);
+        } else if (transmit(deferred.data, deferred.target) == SendResult::WOULD_BLOCK) {
+            return;
+        }
+        deferredHead = (deferredHead + 1) % DEFERRED_SEND_SIZE;
+        deferredCount--;
+    }
+}
+
+// Returns whether the watchdog went out. It is not deferred: updateWatchDog() tries again on the
+// next update, with the state as it is then.
+auto StateMachine::sendWatchDog() -> bool {
     message watchDog;
     watchDog.type                = message_type::MESSAGE_TYPE_WATCH_DOG;
     watchDog.data.watchDog.state = stateSelf;
     uint8_t target[6];
     memset((uint8_t *)target, 0xFF, 6);
-    EspNowSensor<message>::Send(watchDog, (uint8_t *)target);
+    return transmit(watchDog, (uint8_t *)target) == SendResult::SENT;
+}
+
+// The watchdog broadcasts our state to nearby dice. It is sent as soon as the state changes, then
+// again after WATCHDOG_MIN_INTERVAL, with the interval doubling up to WATCHDOG_MAX_INTERVAL while
+// the state stays the same. A message from a dice close by resets the interval.
+void StateMachine::updateWatchDog(unsigned long currentTime) {
+    if (!watchDogSent || !(stateSelf == watchDogState)) {
+        watchDogInterval = WATCHDOG_MIN_INTERVAL;
+    } else if (currentState.mode == Mode::CLASSIC
+               || currentTime - watchDogTime < watchDogInterval) {
+        // Not repeating in CLASSIC mode ensures we don't get contacted about entanglement
+        // and reduces power consumption and network traffic
+        return;
+    } else {
+        watchDogInterval = std::min(watchDogInterval * 2, WATCHDOG_MAX_INTERVAL);
+    }
+
+    if (!sendWatchDog()) {
+        return;
+    }
+    watchDogSent  = true;
+    watchDogState = stateSelf;
+    watchDogTime  = currentTime;
 }
 
 void StateMachine::sendMeasurements(uint8_t *target, State state, DiceNumbers diceNumber,
                                     UpSide upSide, MeasuredAxises measureAxis) {
-    EspNowSensor<message>::AddPeer(target);
+    _transport->addPeer(target);
     message myData;
     debugln("Send Measurements message initated");
     myData.type                         = message_type::MESSAGE_TYPE_MEASUREMENT;
@@ -181,18 +261,19 @@ void StateMachine::sendMeasurements(uint8_t *target, State state, DiceNumbers di
     myData.data.measurement.measureAxis = measureAxis;
     myData.data.measurement.diceNumber  = diceNumber;
     myData.data.measurement.upSide      = upSide;
-    EspNowSensor<message>::Send(myData, target);
+    sendMessage(myData, target);
 }
 
 void StateMachine::sendEntangleRequest(uint8_t *target) {
-    EspNowSensor<message>::AddPeer(target);
+    _transport->addPeer(target);
     message myData;
     myData.type = message_type::MESSAGE_TYPE_ENTANGLE_REQUEST;
-    EspNowSensor<message>::Send(myData, target);
+    sendMessage(myData, target);
+    entangleRequestTime = millis();
 }
 
 void StateMachine::sendEntanglementConfirm(uint8_t *target) {
-    EspNowSensor<message>::AddPeer(target);
+    _transport->addPeer(target);
     debugln("Send entanglement confirm");
     message myData;
     myData.type = message_type::MESSAGE_TYPE_ENTANGLE_CONFIRM;
@@ -218,38 +299,47 @@ void StateMachine::sendEntanglementConfirm(uint8_t *target) {
         debugln("Triggering color flash (accepting entanglement)");
     }
 
-    EspNowSensor<message>::Send(myData, target);
+    sendMessage(myData, target);
+}
+
+// The confirm we sent before, in the colour we agreed on, for a partner that did not get it
+void StateMachine::repeatEntanglementConfirm(uint8_t *target) {
+    debugln("Send entanglement confirm again");
+    message myData;
+    myData.type                       = message_type::MESSAGE_TYPE_ENTANGLE_CONFIRM;
+    myData.data.entangleConfirm.color = this->entanglement_color;
+    sendMessage(myData, target);
 }
 
 void StateMachine::sendEntangleDenied(uint8_t *target) {
-    EspNowSensor<message>::AddPeer(target);
+    _transport->addPeer(target);
     debugln("Send entangle denied");
     message myData;
     myData.type = message_type::MESSAGE_TYPE_ENTANGLE_DENIED;
-    EspNowSensor<message>::Send(myData, target);
+    sendMessage(myData, target);
 }
 
 void StateMachine::sendTeleportRequest(uint8_t *target_m, uint8_t *target_b) {
-    EspNowSensor<message>::AddPeer(target_m);
+    _transport->addPeer(target_m);
     debugln("Send teleport request");
     message myData;
     myData.type = message_type::MESSAGE_TYPE_TELEPORT_REQUEST;
     memcpy((void *)myData.data.teleportRequest.target_dice, (void *)target_b, 6);
-    EspNowSensor<message>::Send(myData, target_m);
+    sendMessage(myData, target_m);
 }
 
 void StateMachine::sendTeleportConfirm(uint8_t *target) {
-    EspNowSensor<message>::AddPeer(target);
+    _transport->addPeer(target);
     debugln("Send teleport confirm");
     message myData;
     myData.type = message_type::MESSAGE_TYPE_TELEPORT_CONFIRM;
-    EspNowSensor<message>::Send(myData, target);
+    sendMessage(myData, target);
 }
 
 void StateMachine::sendTeleportPayload(uint8_t *target, State state, DiceNumbers diceNumber,
                                        UpSide upSide, MeasuredAxises measureAxis,
                                        uint8_t *entangled_peer, uint16_t color) {
-    EspNowSensor<message>::AddPeer(target);
+    _transport->addPeer(target);
     debugf("Send teleport payload with colour 0x%04X\n", color);
     message myData;
     myData.type                             = message_type::MESSAGE_TYPE_TELEPORT_PAYLOAD;
@@ -259,16 +349,16 @@ void StateMachine::sendTeleportPayload(uint8_t *target, State state, DiceNumbers
     myData.data.teleportPayload.upSide      = upSide;
     myData.data.teleportPayload.color       = color;
     memcpy((void *)myData.data.teleportPayload.entangled_peer, (void *)entangled_peer, 6);
-    EspNowSensor<message>::Send(myData, target);
+    sendMessage(myData, target);
 }
 
 void StateMachine::sendTeleportPartner(uint8_t *target_n, uint8_t *new_partner_b) {
-    EspNowSensor<message>::AddPeer(target_n);
+    _transport->addPeer(target_n);
     debugln("Send teleport partner update");
     message myData;
     myData.type = message_type::MESSAGE_TYPE_TELEPORT_PARTNER;
     memcpy((void *)myData.data.teleportPartner.new_partner, (void *)new_partner_b, 6);
-    EspNowSensor<message>::Send(myData, target_n);
+    sendMessage(myData, target_n);
 }
 
 void setInitialState() {
@@ -281,8 +371,9 @@ void setInitialState() {
 }
 
 // State transitions for the quantum dice system
-// Note: This must be accessible by getStateTransition function
-const std::array<StateTransition, 37> StateMachine::stateTransitions = {
+// An unset current field is a wildcard. When several entries match, the first one wins, so a more
+// specific entry must come before a more general one; this is checked at compile time below.
+static constexpr std::array<StateTransition, 37> STATE_TRANSITIONS = {
   {// Order: currentMode, nextMode, currentThrowState, nextThrowState, currentEntanglementState,
    // nextEntanglementState, trigger
 
@@ -390,116 +481,337 @@ const std::array<StateTransition, 37> StateMachine::stateTransitions = {
                    Trigger::MEASUREMENT_RECEIVED},
 
    // === LOW BATTERY ===
-   StateTransition{std::nullopt, Mode::LOW_BATTERY, std::nullopt, std::nullopt, std::nullopt,
-                   std::nullopt, Trigger::LOW_BATTERY}}
+   StateTransition{std::nullopt, Mode::LOW_BATTERY, std::nullopt, ThrowState::IDLE, std::nullopt,
+                   EntanglementState::PURE, Trigger::LOW_BATTERY}}
 };
 
-auto StateMachine::getStateTransition(State currentState, Trigger trigger) -> StateTransition {
-    for (const StateTransition &transition : StateMachine::stateTransitions) {
-        bool modeMatch = !transition.currentMode.has_value()
-                         || transition.currentMode.value() == currentState.mode;
-        bool throwStateMatch = !transition.currentThrowState.has_value()
-                               || transition.currentThrowState.value() == currentState.throwState;
-        bool entanglementStateMatch
-          = !transition.currentEntanglementState.has_value()
-            || transition.currentEntanglementState.value() == currentState.entanglementState;
-
-        if (modeMatch && throwStateMatch && entanglementStateMatch
-            && transition.trigger == trigger) {
-            return transition;
+// The wildcard table above is expanded at compile time into a dense table with the index of the
+// winning transition for every (state, trigger) pair, so a lookup is a single array load
+using TransitionTable = std::array<uint8_t, STATE_COUNT * TRIGGER_COUNT>;
+
+constexpr uint8_t NO_TRANSITION = 0xFF;
+static_assert(STATE_TRANSITIONS.size() < NO_TRANSITION, "Transition index must fit in a byte");
+
+static constexpr auto transitionKey(State state, Trigger trigger) -> size_t {
+    return (stateId(state) * TRIGGER_COUNT) + static_cast<size_t>(trigger);
+}
+
+template <typename T>
+static constexpr auto fieldMatches(const std::optional<T> &pattern, T value) -> bool {
+    return !pattern.has_value() || *pattern == value;
+}
+
+static constexpr auto transitionMatches(const StateTransition &transition, State state,
+                                        Trigger trigger) -> bool {
+    return transition.trigger == trigger && fieldMatches(transition.currentMode, state.mode)
+           && fieldMatches(transition.currentThrowState, state.throwState)
+           && fieldMatches(transition.currentEntanglementState, state.entanglementState);
+}
+
+// First-match linear scan over the wildcard table, the reference the dense table is checked against
+static constexpr auto scanTransitions(State state, Trigger trigger) -> uint8_t {
+    for (size_t i = 0; i < STATE_TRANSITIONS.size(); i++) {
+        if (transitionMatches(STATE_TRANSITIONS[i], state, trigger)) {
+            return static_cast<uint8_t>(i);
+        }
+    }
+    return NO_TRANSITION;
+}
+
+static constexpr auto buildTransitionTable() -> TransitionTable {
+    TransitionTable table = {};
+    for (size_t key = 0; key < table.size(); key++) {
+        table[key] = NO_TRANSITION;
+    }
+    // Paint from the last entry to the first, so earlier entries overwrite later ones
+    for (size_t i = STATE_TRANSITIONS.size(); i-- > 0;) {
+        for (size_t id = 0; id < STATE_COUNT; id++) {
+            State state = stateFromId(id);
+            if (transitionMatches(STATE_TRANSITIONS[i], state, STATE_TRANSITIONS[i].trigger)) {
+                table[transitionKey(state, STATE_TRANSITIONS[i].trigger)] = static_cast<uint8_t>(i);
+            }
+        }
+    }
+    return table;
+}
+
+static constexpr TransitionTable TRANSITION_TABLE = buildTransitionTable();
+
+static constexpr auto tableMatchesScan() -> bool {
+    for (size_t id = 0; id < STATE_COUNT; id++) {
+        for (size_t trigger = 0; trigger < TRIGGER_COUNT; trigger++) {
+            State state = stateFromId(id);
+            if (stateId(state) != id
+                || TRANSITION_TABLE[transitionKey(state, static_cast<Trigger>(trigger))]
+                     != scanTransitions(state, static_cast<Trigger>(trigger))) {
+                return false;
+            }
         }
     }
-    throw std::runtime_error("No valid state transition found");
+    return true;
+}
+
+template <typename T>
+static constexpr auto fieldsOverlap(const std::optional<T> &a, const std::optional<T> &b) -> bool {
+    return !a.has_value() || !b.has_value() || *a == *b;
+}
+
+// True when every state matched by `inner` is also matched by `outer`
+template <typename T>
+static constexpr auto fieldCovers(const std::optional<T> &outer, const std::optional<T> &inner)
+  -> bool {
+    return !outer.has_value() || (inner.has_value() && *inner == *outer);
+}
+
+// Two entries for the same trigger that both match some state must be nested, with the more
+// specific one first. Anything else makes the outcome depend on the order of the table.
+static constexpr auto transitionsUnambiguous() -> bool {
+    for (size_t i = 0; i < STATE_TRANSITIONS.size(); i++) {
+        for (size_t j = i + 1; j < STATE_TRANSITIONS.size(); j++) {
+            const StateTransition &first  = STATE_TRANSITIONS[i];
+            const StateTransition &second = STATE_TRANSITIONS[j];
+            bool overlap = first.trigger == second.trigger
+                           && fieldsOverlap(first.currentMode, second.currentMode)
+                           && fieldsOverlap(first.currentThrowState, second.currentThrowState)
+                           && fieldsOverlap(first.currentEntanglementState,
+                                            second.currentEntanglementState);
+            bool nested
+              = fieldCovers(second.currentMode, first.currentMode)
+                && fieldCovers(second.currentThrowState, first.currentThrowState)
+                && fieldCovers(second.currentEntanglementState, first.currentEntanglementState);
+            if (overlap && !nested) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// An entry that never wins is dead and most likely misplaced
+static constexpr auto everyTransitionReachable() -> bool {
+    for (size_t i = 0; i < STATE_TRANSITIONS.size(); i++) {
+        bool reachable = false;
+        for (uint8_t index : TRANSITION_TABLE) {
+            reachable = reachable || index == i;
+        }
+        if (!reachable) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static_assert(tableMatchesScan(), "Dense transition table differs from the wildcard table");
+static_assert(transitionsUnambiguous(),
+              "Overlapping state transitions must be nested, the specific one first");
+static_assert(everyTransitionReachable(), "A state transition is shadowed by an earlier one");
+
+auto StateMachine::getStateTransition(State currentState, Trigger trigger)
+  -> std::optional<StateTransition> {
+    uint8_t index = TRANSITION_TABLE[transitionKey(currentState, trigger)];
+    if (index == NO_TRANSITION) {
+        return std::nullopt;
+    }
+    return STATE_TRANSITIONS[index];
+}
+
+// Unset next fields keep the current value
+static constexpr auto applyTransition(const StateTransition &transition, State state) -> State {
+    if (transition.nextMode.has_value()) {
+        state.mode = *transition.nextMode;
+    }
+    if (transition.nextThrowState.has_value()) {
+        state.throwState = *transition.nextThrowState;
+    }
+    if (transition.nextEntanglementState.has_value()) {
+        state.entanglementState = *transition.nextEntanglementState;
+    }
+    return state;
+}
+
+// Classic mode has its own LOW_BATTERY entry ahead of the catch-all one, so it stays classic
+static constexpr auto classicIgnoresLowBattery() -> bool {
+    State   classic = {Mode::CLASSIC, ThrowState::IDLE, EntanglementState::PURE};
+    uint8_t index   = TRANSITION_TABLE[transitionKey(classic, Trigger::LOW_BATTERY)];
+    return index != NO_TRANSITION
+           && applyTransition(STATE_TRANSITIONS[index], classic).mode == Mode::CLASSIC;
+}
+
+static_assert(classicIgnoresLowBattery(), "Classic mode ignores LOW_BATTERY");
+
+// The initial state has state functions, and every transition out of a state with state
+// functions leads to a state with state functions, so dispatch never hits an empty slot
+constexpr auto StateMachine::handlersCoverReachableStates() -> bool {
+    auto handled = [](State state) {
+        const StateFunction &functions = stateFunctions[stateId(state)];
+        return functions.onEntry != nullptr && functions.whileInState != nullptr;
+    };
+
+    if (!handled(INITIAL_STATE)) {
+        return false;
+    }
+    for (size_t id = 0; id < STATE_COUNT; id++) {
+        State state = stateFromId(id);
+        if (!handled(state)) {
+            continue;
+        }
+        for (size_t trigger = 0; trigger < TRIGGER_COUNT; trigger++) {
+            uint8_t index = TRANSITION_TABLE[transitionKey(state, static_cast<Trigger>(trigger))];
+            if (index != NO_TRANSITION
+                && !handled(applyTransition(STATE_TRANSITIONS[index], state))) {
+                return false;
+            }
+        }
+    }
+    return true;
 }
 
 // declaration of instance
 StateMachine::StateMachine()
-  : currentState{.mode              = Mode::CLASSIC,
-                 .throwState        = ThrowState::IDLE,
-                 .entanglementState = EntanglementState::PURE},
-    stateEntryTime(0), partnerMeasurementAxis(MeasuredAxises::UNDEFINED),
-    partnerDiceNumber(DiceNumbers::NONE), teleportedMeasurementAxis(MeasuredAxises::UNDEFINED),
-    teleportedDiceNumber(DiceNumbers::NONE), lastRollBasis(MeasuredAxises::UNDEFINED),
-    lastRollNumber(DiceNumbers::NONE) {
+  : _transport(nullptr), currentState(INITIAL_STATE), stateEntryTime(0),
+    partnerMeasurementAxis(MeasuredAxises::UNDEFINED), partnerDiceNumber(DiceNumbers::NONE),
+    teleportedMeasurementAxis(MeasuredAxises::UNDEFINED), teleportedDiceNumber(DiceNumbers::NONE),
+    lastRollBasis(MeasuredAxises::UNDEFINED), lastRollNumber(DiceNumbers::NONE) {
     // Constructor does not call onEntry. That's done in StateMachine::begin()
     memset((void *)this->current_peer, 0xFF, 6);
     memset((void *)this->next_peer, 0xFF, 6);
+    memset((void *)this->own_address, 0xFF, 6);
     memset((void *)last_source, 0xFF, 6);
     last_rssi = INT32_MIN;
 }
 
 void StateMachine::begin() {
-    // Initialize ESP-NOW with device A MAC from config
-    EspNowSensor<message>::Init();
+    // Initialize the radio, ESP-NOW unless a different transport was set
+    _transport->begin();
 
     infoln("ESP-NOW initialized successfully!");
 
-    EspNowSensor<message>::PrintMacAddress();
+    _transport->printMacAddress();
+    _transport->getMacAddress(own_address);
 
     infoln("StateMachine Begin: Calling onEntry for initial state");
     printStateName("StateMachine", currentState);
 
     // Call the onEntry function for the initial state
-    auto it = stateFunctions.find(currentState);
-    if (it != stateFunctions.end()) {
-        (this->*it->second.onEntry)();
-    } else {
-        errorln("ERROR: No state function found for initial state!");
-    }
+    static_assert(handlersCoverReachableStates(),
+                  "A state reachable from the initial state has no state functions");
+    (this->*stateFunctions[stateId(currentState)].onEntry)();
+    processTriggers();
+    commitScreens();
 }
 
 void StateMachine::changeState(Trigger trigger) {
     // Get the state transition for the current state and trigger
-    try {
-        StateTransition transition = getStateTransition(currentState, trigger);
+    std::optional<StateTransition> transition = getStateTransition(currentState, trigger);
+    if (!transition.has_value()) {
+        // Not an error: peers can send messages that do not apply to our state
+        uint16_t &rejected = rejectedTriggers[transitionKey(currentState, trigger)];
+        if (rejected < UINT16_MAX) {
+            rejected++;
+        }
+        debugf("Trigger %s ignored in state %s\n", getTriggerName(trigger),
+               getStateName(currentState));
+        return;
+    }
 
-        // Create new state based on transition
-        State newState = currentState; // Start with current state
+    // Create new state based on transition
+    State newState = applyTransition(*transition, currentState);
 
-        // Apply transitions if specified
-        if (transition.nextMode.has_value()) {
-            newState.mode = transition.nextMode.value();
-        }
-        if (transition.nextThrowState.has_value()) {
-            newState.throwState = transition.nextThrowState.value();
+    // Only change if the state actually changed
+    if (!(newState == currentState)) {
+        currentState = newState;
+        printStateName("stateMachine", currentState);
+
+        // Call onEntry function for new state
+        (this->*stateFunctions[stateId(currentState)].onEntry)();
+    }
+}
+
+void StateMachine::postTrigger(Trigger trigger) {
+    if (pendingCount > 0) {
+        PendingTrigger &last
+          = pendingTriggers[(pendingHead + pendingCount - 1) % TRIGGER_QUEUE_SIZE];
+        if (last.trigger == trigger) {
+            if (triggerQueueStats.merged < UINT16_MAX) {
+                triggerQueueStats.merged++;
+            }
+            return;
         }
-        if (transition.nextEntanglementState.has_value()) {
-            newState.entanglementState = transition.nextEntanglementState.value();
+    }
+    if (pendingCount == TRIGGER_QUEUE_SIZE) {
+        if (triggerQueueStats.dropped < UINT16_MAX) {
+            triggerQueueStats.dropped++;
         }
+        warnf("Trigger queue full, dropping trigger %s\n", getTriggerName(trigger));
+        return;
+    }
 
-        // Only change if the state actually changed
-        if (!(newState == currentState)) {
-            currentState = newState;
-            printStateName("stateMachine", currentState);
+    pendingTriggers[(pendingHead + pendingCount) % TRIGGER_QUEUE_SIZE] = {trigger, millis()};
+    pendingCount++;
+    if (pendingCount > triggerQueueStats.highWater) {
+        triggerQueueStats.highWater = pendingCount;
+    }
+}
 
-            // Call onEntry function for new state
-            auto it = stateFunctions.find(currentState);
-            if (it != stateFunctions.end()) {
-                (this->*it->second.onEntry)();
-            } else {
-                errorf("ERROR: No state function found for state: %s\n",
-                       getStateName(currentState));
-            }
+// Apply pending triggers one at a time. Triggers posted by an entry function are appended and
+// handled in the same call; at most one queue's worth is handled, so two entry functions that
+// keep triggering each other cannot stall update().
+void StateMachine::processTriggers() {
+    for (size_t handled = 0; pendingCount > 0 && handled < TRIGGER_QUEUE_SIZE; handled++) {
+        PendingTrigger pending = pendingTriggers[pendingHead];
+        pendingHead            = (pendingHead + 1) % TRIGGER_QUEUE_SIZE;
+        pendingCount--;
+
+        debugf("Trigger %s after %lu ms\n", getTriggerName(pending.trigger),
+               millis() - pending.postedAt);
+        changeState(pending.trigger);
+    }
+}
+
+auto StateMachine::getRejectedTriggers(State state, Trigger trigger) const -> uint16_t {
+    return rejectedTriggers[transitionKey(state, trigger)];
+}
+
+auto StateMachine::getRejectedTriggerTotal() const -> uint32_t {
+    uint32_t total = 0;
+    for (uint16_t count : rejectedTriggers) {
+        total += count;
+    }
+    return total;
+}
+
+void StateMachine::printRejectedTriggers() const {
+    infof("Rejected triggers: %lu\n", (unsigned long)getRejectedTriggerTotal());
+    for (size_t key = 0; key < rejectedTriggers.size(); key++) {
+        if (rejectedTriggers[key] != 0) {
+            infof("  %s + %s: %u\n", getStateName(stateFromId(key / TRIGGER_COUNT)),
+                  getTriggerName(static_cast<Trigger>(key % TRIGGER_COUNT)), rejectedTriggers[key]);
         }
-    } catch (const std::runtime_error &e) {
-        errorf("State transition error: %s\n", e.what());
-        debugf("Current state: %s, Trigger: %d\n", getStateName(currentState),
-               static_cast<int>(trigger));
     }
 }
 
 void StateMachine::update() {
     static unsigned long lastUpdateTime   = 0;
-    static unsigned long lastWatchdogTime = 0;
 
     message data;
     uint8_t source[6];
     int32_t current_rssi;
 
-    while (EspNowSensor<message>::Poll(&data, (unsigned char *)source, &current_rssi)) {
-        // Update RSSI and source for ALL messages to track nearby dice
-        last_rssi = current_rssi;
-        memcpy((void *)last_source, (void *)source, 6);
+    // Buffers freed since the last update go to deferred sends before any new message
+    retryDeferredSends();
+
+    while (_transport->poll(&data, (unsigned char *)source, &current_rssi)) {
+        // Only the watchdog beacon makes a dice a candidate for entanglement or teleportation.
+        // A reply such as ENTANGLE_DENIED would have the dice that sent it asked again at once.
+        if (data.type == message_type::MESSAGE_TYPE_WATCH_DOG) {
+            last_rssi = current_rssi;
+            memcpy((void *)last_source, (void *)source, 6);
+        }
+
+        // A dice close by is a candidate for entanglement, let it hear from us often
+        if (current_rssi > currentConfig.rssiLimit && current_rssi < -1) {
+            watchDogInterval = WATCHDOG_MIN_INTERVAL;
+        }
 
         switch (data.type) {
             case message_type::MESSAGE_TYPE_WATCH_DOG: // watch dog, send by all dices
@@ -524,7 +836,7 @@ void StateMachine::update() {
                     memset(this->current_peer, 0xFF, 6);
 
                     // Trigger state transition
-                    changeState(Trigger::MEASUREMENT_RECEIVED);
+                    postTrigger(Trigger::MEASUREMENT_RECEIVED);
                 }
                 break;
 
@@ -538,6 +850,26 @@ void StateMachine::update() {
                     break;
                 }
 
+                // Both dice asked each other at once. Denying both would send them back to
+                // PURE to ask again in step, so the lower address accepts and the higher one
+                // waits for its confirm.
+                if (currentState.entanglementState == EntanglementState::ENTANGLE_REQUESTED
+                    && memcmp((void *)source, (void *)this->next_peer, 6) == 0) {
+                    if (memcmp((void *)this->own_address, (void *)source, 6) > 0) {
+                        debugln("Crossed entanglement requests - waiting for the confirm");
+                        break;
+                    }
+                    debugln("Crossed entanglement requests - confirming");
+                    memcpy((void *)this->current_peer, (void *)source, 6);
+                    memset((void *)this->next_peer, 0xFF, 6);
+                    sendEntanglementConfirm((uint8_t *)source);
+                    diceNumberSelf  = DiceNumbers::NONE;
+                    upSideSelf      = UpSide::NONE;
+                    measureAxisSelf = MeasuredAxises::UNDEFINED;
+                    postTrigger(Trigger::ENTANGLE_CONFIRM); // ENTANGLE_REQUESTED -> ENTANGLED
+                    break;
+                }
+
                 // Check if we're already waiting for confirmation - deny to prevent race condition
                 if (currentState.entanglementState == EntanglementState::ENTANGLE_REQUESTED) {
                     debugln(
@@ -546,6 +878,13 @@ void StateMachine::update() {
                     break;
                 }
 
+                // Our partner asks again: it is still waiting for our confirm
+                if (currentState.entanglementState == EntanglementState::ENTANGLED
+                    && memcmp((void *)source, (void *)this->current_peer, 6) == 0) {
+                    repeatEntanglementConfirm((uint8_t *)source);
+                    break;
+                }
+
                 // Check if we're already ENTANGLED - this means teleportation is being initiated
                 if (currentState.entanglementState == EntanglementState::ENTANGLED) {
                     debugln("Already ENTANGLED - initiating TELEPORTATION protocol");
@@ -574,7 +913,7 @@ void StateMachine::update() {
                     diceNumberSelf  = DiceNumbers::NONE;
                     upSideSelf      = UpSide::NONE;
                     measureAxisSelf = MeasuredAxises::UNDEFINED;
-                    changeState(Trigger::ENTANGLE_REQUEST); // PURE/POST_ENTANGLEMENT -> ENTANGLED
+                    postTrigger(Trigger::ENTANGLE_REQUEST); // PURE/POST_ENTANGLEMENT -> ENTANGLED
                 }
                 break;
 
@@ -602,7 +941,7 @@ void StateMachine::update() {
                     diceNumberSelf  = DiceNumbers::NONE;
                     upSideSelf      = UpSide::NONE;
                     measureAxisSelf = MeasuredAxises::UNDEFINED;
-                    changeState(Trigger::ENTANGLE_CONFIRM); // ENTANGLE_REQUESTED -> ENTANGLED
+                    postTrigger(Trigger::ENTANGLE_CONFIRM); // ENTANGLE_REQUESTED -> ENTANGLED
                 }
                 break;
 
@@ -615,7 +954,7 @@ void StateMachine::update() {
 
                 // If we're in ENTANGLE_REQUESTED state, go back to PURE
                 if (currentState.entanglementState == EntanglementState::ENTANGLE_REQUESTED) {
-                    changeState(
+                    postTrigger(
                       Trigger::ENTANGLE_STOP); // Use ENTANGLE_STOP trigger to return to PURE
                 }
                 break;
@@ -659,7 +998,7 @@ void StateMachine::update() {
                     lastRollBasis   = MeasuredAxises::UNDEFINED;
                     lastRollNumber  = DiceNumbers::NONE;
 
-                    changeState(Trigger::TELEPORT_INITIATED);
+                    postTrigger(Trigger::TELEPORT_INITIATED);
                 }
                 break;
 
@@ -679,7 +1018,7 @@ void StateMachine::update() {
                 lastRollBasis   = MeasuredAxises::UNDEFINED;
                 lastRollNumber  = DiceNumbers::NONE;
 
-                changeState(Trigger::TELEPORT_CONFIRMED);
+                postTrigger(Trigger::TELEPORT_CONFIRMED);
                 break;
 
             case message_type::MESSAGE_TYPE_TELEPORT_PAYLOAD:
@@ -740,7 +1079,7 @@ void StateMachine::update() {
                         // M was in PURE state - B also goes to PURE
                         debugln("Teleported state is PURE - B enters PURE state");
 
-                        changeState(
+                        postTrigger(
                           Trigger::TELEPORT_RECEIVED); // ENTANGLED/POST_ENTANGLEMENT -> PURE
                     }
                 }
@@ -767,6 +1106,10 @@ void StateMachine::update() {
                 }
                 break;
         }
+
+        // Each message is handled to completion before the next, so its handler sees the state
+        // that the previous message left behind
+        processTriggers();
     }
 
     _imuSensor->update();
@@ -784,15 +1127,6 @@ void StateMachine::update() {
         }
     }
 
-    // Periodically send watchdog to broadcast presence to nearby dice
-    if (currentState.mode != Mode::CLASSIC
-        && (currentTime - lastWatchdogTime >= 500)) { // Send every 500ms
-        // Not sending in CLASSIC mode ensures we don't get contacted about entanglement
-        // and reduces power consumption and network traffic
-        sendWatchDog();
-        lastWatchdogTime = currentTime;
-    }
-
     // State-independent: Handle color flash timeout
     if (flashColor && (currentTime - flashColorStartTime >= currentConfig.colorFlashTimeout)) {
         debugln("Color flash timeout - refreshing screens to show white");
@@ -806,14 +1140,16 @@ void StateMachine::update() {
         lastUpdateTime = currentTime;
 
         // Call whileInState function for current state
-        auto it = stateFunctions.find(currentState);
-        if (it != stateFunctions.end()) {
-            (this->*it->second.whileInState)();
-        } else {
-            errorf("ERROR: No state function found for state: %s\n", getStateName(currentState));
-        }
+        (this->*stateFunctions[stateId(currentState)].whileInState)();
+        processTriggers();
     }
 
+    // After the state changes of this tick, so a new state goes out at once
+    updateWatchDog(currentTime);
+
+    // Single commit point: render whatever the faces should show after this tick
+    commitScreens();
+
     checkTimeForDeepSleep(_imuSensor);
 }
 
@@ -833,7 +1169,6 @@ void StateMachine::enterClassicIdle() {
     upSideSelf      = UpSide::NONE;
     measureAxisSelf = MeasuredAxises::UNDEFINED;
 
-    sendWatchDog();
     refreshScreens();
 }
 
@@ -842,7 +1177,7 @@ void StateMachine::whileClassicIdle() {
     if (checkMinimumVoltage()) {
         currentState.entanglementState = EntanglementState::PURE; // Reset entanglement state
         currentState.throwState        = ThrowState::IDLE;   // Reset throw state
-        changeState(Trigger::LOW_BATTERY);
+        postTrigger(Trigger::LOW_BATTERY);
         return;
     }
 
@@ -850,7 +1185,7 @@ void StateMachine::whileClassicIdle() {
     if (longclicked) {
         longclicked = false;
         debugln("Button pressed - switching to QUANTUM mode");
-        changeState(Trigger::BUTTON_PRESSED);
+        postTrigger(Trigger::BUTTON_PRESSED);
     }
 }
 
@@ -870,7 +1205,6 @@ void StateMachine::enterQuantumIdle() {
     // Reset button flag
     longclicked = false;
 
-    sendWatchDog();
     refreshScreens();
 }
 
@@ -879,7 +1213,7 @@ void StateMachine::whileQuantumIdle() {
     if (checkMinimumVoltage()) {
         currentState.entanglementState = EntanglementState::PURE; // Reset entanglement state
         currentState.throwState        = ThrowState::IDLE;   // Reset throw state
-        changeState(Trigger::LOW_BATTERY);
+        postTrigger(Trigger::LOW_BATTERY);
         return;
     }
 
@@ -891,14 +1225,14 @@ void StateMachine::whileQuantumIdle() {
             || currentState.entanglementState == EntanglementState::TELEPORTED)) {
         longclicked = false;
         debugln("Button pressed - switching to CLASSIC mode");
-        changeState(Trigger::BUTTON_PRESSED);
+        postTrigger(Trigger::BUTTON_PRESSED);
         return;
     }
 
     // Check if dice is being thrown
     if (_imuSensor->tumbled()) {
         debugln("Tumble detected - starting throw");
-        changeState(Trigger::START_ROLLING);
+        postTrigger(Trigger::START_ROLLING);
         return;
     }
 
@@ -919,7 +1253,7 @@ void StateMachine::whileQuantumIdle() {
                        this->next_peer[3], this->next_peer[4], this->next_peer[5]);
                 sendEntangleRequest((uint8_t *)last_source);
                 last_rssi = INT32_MIN;
-                changeState(Trigger::CLOSE_BY); // PURE/TELEPORTED -> ENTANGLE_REQUESTED
+                postTrigger(Trigger::CLOSE_BY); // PURE/TELEPORTED -> ENTANGLE_REQUESTED
                 return;
             }
             break;
@@ -952,9 +1286,13 @@ void StateMachine::whileQuantumIdle() {
             // This state just waits and can timeout
             if (millis() - stateEntryTime > MAXENTANGLEDWAITTIME) {
                 debugln("Entanglement request timeout - returning to PURE state");
-                changeState(Trigger::TIMED);
+                postTrigger(Trigger::TIMED);
                 return;
             }
+            // The request or the confirm can still be lost after every retransmission
+            if (millis() - entangleRequestTime >= ENTANGLE_REQUEST_REPEAT) {
+                sendEntangleRequest((uint8_t *)this->next_peer);
+            }
             break;
     }
 }
@@ -967,7 +1305,6 @@ void StateMachine::enterThrowing() {
     stateSelf      = currentState;
 
     refreshScreens();
-    sendWatchDog();
 }
 
 void StateMachine::whileThrowing() {
@@ -975,7 +1312,7 @@ void StateMachine::whileThrowing() {
     if (checkMinimumVoltage()) {
         currentState.entanglementState = EntanglementState::PURE; // Reset entanglement state
         currentState.throwState        = ThrowState::IDLE;   // Reset throw state
-        changeState(Trigger::LOW_BATTERY);
+        postTrigger(Trigger::LOW_BATTERY);
         return;
     }
 
@@ -987,14 +1324,14 @@ void StateMachine::whileThrowing() {
             || currentState.entanglementState == EntanglementState::TELEPORTED)) {
         longclicked = false;
         debugln("Button pressed - switching to CLASSIC mode");
-        changeState(Trigger::BUTTON_PRESSED);
+        postTrigger(Trigger::BUTTON_PRESSED);
         return;
     }
 
     // Check if dice has landed and is stable
     if (_imuSensor->stable() && _imuSensor->on_table()) {
         debugln("Dice stable and on table - moving to OBSERVED");
-        changeState(Trigger::STOP_ROLLING);
+        postTrigger(Trigger::STOP_ROLLING);
         return;
     }
 
@@ -1015,7 +1352,7 @@ void StateMachine::whileThrowing() {
                    this->next_peer[5]);
             sendEntangleRequest((uint8_t *)last_source);
             last_rssi = INT32_MIN;
-            changeState(Trigger::CLOSE_BY); // Will transition to IDLE + ENTANGLE_REQUESTED
+            postTrigger(Trigger::CLOSE_BY); // Will transition to IDLE + ENTANGLE_REQUESTED
             return;
         }
     }
@@ -1033,7 +1370,7 @@ void StateMachine::enterObserved() {
     // Check if dice is still moving (measurement failure)
     if (_imuSensor->moving()) {
         debugln("Dice still moving - measurement failed");
-        changeState(Trigger::MEASURE_FAIL);
+        postTrigger(Trigger::MEASURE_FAIL);
         return;
     }
 
@@ -1074,7 +1411,7 @@ void StateMachine::enterObserved() {
         case IMU_Orientation::ORIENTATION_TILTED:
         case IMU_Orientation::ORIENTATION_UNKNOWN:
             debugln("No clear axis - measurement failed");
-            changeState(Trigger::MEASURE_FAIL);
+            postTrigger(Trigger::MEASURE_FAIL);
             return;
     }
 
@@ -1179,7 +1516,6 @@ void StateMachine::enterObserved() {
     _imuSensor->resetTumbleDetection();
 
     refreshScreens();
-    sendWatchDog();
 }
 
 void StateMachine::whileObserved() {
@@ -1187,7 +1523,7 @@ void StateMachine::whileObserved() {
     if (checkMinimumVoltage()) {
         currentState.entanglementState = EntanglementState::PURE; // Reset entanglement state
         currentState.throwState        = ThrowState::IDLE;   // Reset throw state
-        changeState(Trigger::LOW_BATTERY);
+        postTrigger(Trigger::LOW_BATTERY);
         return;
     }
 
@@ -1199,14 +1535,14 @@ void StateMachine::whileObserved() {
             || currentState.entanglementState == EntanglementState::TELEPORTED)) {
         longclicked = false;
         debugln("Button pressed - switching to CLASSIC mode");
-        changeState(Trigger::BUTTON_PRESSED);
+        postTrigger(Trigger::BUTTON_PRESSED);
         return;
     }
 
     // Check if dice is being thrown again
     if (_imuSensor->tumbled()) {
         debugln("Tumble detected - starting new throw");
-        changeState(Trigger::START_ROLLING);
+        postTrigger(Trigger::START_ROLLING);
         return;
     }
 
@@ -1227,7 +1563,7 @@ void StateMachine::whileObserved() {
                    this->next_peer[5]);
             sendEntangleRequest((uint8_t *)last_source);
             last_rssi = INT32_MIN;
-            changeState(Trigger::CLOSE_BY); // Will transition to IDLE + ENTANGLE_REQUESTED
+            postTrigger(Trigger::CLOSE_BY); // Will transition to IDLE + ENTANGLE_REQUESTED
             return;
         }
     }
@@ -1247,11 +1583,11 @@ void StateMachine::enterLowBattery() {
     upSideSelf      = UpSide::NONE;
     measureAxisSelf = MeasuredAxises::UNDEFINED;
 
-    sendWatchDog();
     refreshScreens();
 }
 
 void StateMachine::whileLowBattery() {
-    // Display battery indicator
-    voltageIndicator(XX);
+    // The XX faces show the battery readout. It is part of their face key, so the commit only
+    // redraws them when the reading changes.
+    refreshScreens();
 }
@@ -2,10 +2,12 @@
 #define STATEMACHINE_H
 
 #include "IMUhelpers.hpp"
+#include "SendResult.hpp"
 
 #include <Arduino.h>
+#include <array>
+#include <cstddef>
 #include <cstdint>
-#include <map>
 #include <optional>
 
 #define FSM_UPDATE_INTERVAL 0  // Update interval in milliseconds
@@ -17,15 +19,31 @@ enum class MeasuredAxises : uint8_t;
 enum class UpSide : uint8_t;
 
 class StateMachine; // Forward declaration
+class MessageTransport;
+struct message;
 
 constexpr unsigned int IDLETIME         = 3000; // 5000 ms-en
 constexpr unsigned int SHOWNEWSTATETIME = 1000; // ms-en to show when new state is initated
 constexpr unsigned int MAXENTANGLEDWAITTIME
   = 120000; // ms-en wait for throw in entangled wait, befor return to intitSingle state
+// ms-en between entanglement requests while waiting for the confirm; longer than the transport
+// takes to give up on a frame
+constexpr unsigned int ENTANGLE_REQUEST_REPEAT = 1000;
 constexpr unsigned int STABTIME
   = 200; // ms-en to stabilize after measurement
          // #define WAITTOTHROW 1000            //minumum time it stays in wait to trow
 
+constexpr size_t TRIGGER_QUEUE_SIZE = 8; // Pending triggers, see StateMachine::postTrigger()
+
+// Sends waiting for a free transport buffer, see StateMachine::sendMessage(), and the ms-en one
+// may wait before it is dropped
+constexpr size_t        DEFERRED_SEND_SIZE    = 4;
+constexpr unsigned long DEFERRED_SEND_TIMEOUT = 1000;
+
+// Watchdog beacon interval in ms, see StateMachine::updateWatchDog()
+constexpr unsigned long WATCHDOG_MIN_INTERVAL = 500;
+constexpr unsigned long WATCHDOG_MAX_INTERVAL = 4000;
+
 enum class Mode : uint8_t {
     CLASSIC,
     QUANTUM,
@@ -55,7 +73,7 @@ struct State {
     ThrowState        throwState;
     EntanglementState entanglementState;
 
-    // Comparison operators needed for std::map
+    // Comparison operators
     auto operator<(const State &other) const -> bool {
         if (mode != other.mode) {
             return mode < other.mode;
@@ -96,6 +114,38 @@ enum class Trigger : uint8_t {
     LOW_BATTERY,
 };
 
+// Number of values of each state dimension and of the triggers, used to index dense tables
+constexpr size_t MODE_COUNT               = 3;
+constexpr size_t THROW_STATE_COUNT        = 3;
+constexpr size_t ENTANGLEMENT_STATE_COUNT = 5;
+constexpr size_t TRIGGER_COUNT            = 15;
+constexpr size_t STATE_COUNT = MODE_COUNT * THROW_STATE_COUNT * ENTANGLEMENT_STATE_COUNT;
+
+static_assert(static_cast<size_t>(Mode::LOW_BATTERY) + 1 == MODE_COUNT, "Update MODE_COUNT");
+static_assert(static_cast<size_t>(ThrowState::OBSERVED) + 1 == THROW_STATE_COUNT,
+              "Update THROW_STATE_COUNT");
+static_assert(static_cast<size_t>(EntanglementState::TELEPORTED) + 1 == ENTANGLEMENT_STATE_COUNT,
+              "Update ENTANGLEMENT_STATE_COUNT");
+static_assert(static_cast<size_t>(Trigger::LOW_BATTERY) + 1 == TRIGGER_COUNT,
+              "Update TRIGGER_COUNT");
+
+// Packs a state into 0 .. STATE_COUNT - 1
+constexpr auto stateId(State state) -> uint8_t {
+    return static_cast<uint8_t>(
+      (((static_cast<size_t>(state.mode) * THROW_STATE_COUNT)
+        + static_cast<size_t>(state.throwState))
+       * ENTANGLEMENT_STATE_COUNT)
+      + static_cast<size_t>(state.entanglementState));
+}
+
+// Inverse of stateId(), for ids below STATE_COUNT
+constexpr auto stateFromId(size_t id) -> State {
+    return State{
+      .mode       = static_cast<Mode>(id / (THROW_STATE_COUNT * ENTANGLEMENT_STATE_COUNT)),
+      .throwState = static_cast<ThrowState>((id / ENTANGLEMENT_STATE_COUNT) % THROW_STATE_COUNT),
+      .entanglementState = static_cast<EntanglementState>(id % ENTANGLEMENT_STATE_COUNT)};
+}
+
 struct StateTransition {
     // Dice Mode
     std::optional<Mode> currentMode;
@@ -120,21 +170,68 @@ class StateMachine {
   public:
     StateMachine();
     void begin(); // New function to initialize the state machine
-    void changeState(Trigger trigger);
     void update();
 
+    // Queue a trigger. Triggers are applied run-to-completion by update(): each transition and
+    // its entry function finish before the next trigger is taken, so entry functions can post
+    // triggers without re-entering the state machine. A trigger equal to the last pending one is
+    // merged into it. Only the last one: a repeat behind another trigger is a new event, as
+    // BUTTON_PRESSED, TIMED, BUTTON_PRESSED toggles the mode twice. When the queue is full the
+    // new trigger is dropped and counted.
+    void postTrigger(Trigger trigger);
+
     void setImuSensor(IMUSensor *imuSensor) {
         _imuSensor = imuSensor;
     }
 
+    void setTransport(MessageTransport *transport) {
+        _transport = transport;
+    }
+
     [[nodiscard]]
     auto getCurrentState() const -> State {
         return currentState;
     }
 
-    static auto getStateTransition(State currentState, Trigger trigger) -> StateTransition;
+    // Empty when the trigger does not apply to the state
+    static auto getStateTransition(State currentState, Trigger trigger)
+      -> std::optional<StateTransition>;
+
+    // Triggers that were ignored because no transition applies, per state and trigger. The counts
+    // saturate at UINT16_MAX.
+    [[nodiscard]]
+    auto getRejectedTriggers(State state, Trigger trigger) const -> uint16_t;
+    [[nodiscard]]
+    auto getRejectedTriggerTotal() const -> uint32_t;
+    void printRejectedTriggers() const;
+
+    struct TriggerQueueStats {
+        uint8_t  highWater; // Most triggers pending at once
+        uint16_t merged;    // Duplicates merged into the pending trigger
+        uint16_t dropped;   // Lost because the queue was full
+    };
+
+    [[nodiscard]]
+    auto getTriggerQueueStats() const -> TriggerQueueStats {
+        return triggerQueueStats;
+    }
+
+    struct SendStats {
+        uint16_t deferred; // Sends that found every transport buffer in use and waited
+        uint16_t expired;  // Deferred sends dropped after DEFERRED_SEND_TIMEOUT
+        uint16_t dropped;  // Lost because DEFERRED_SEND_SIZE sends were already waiting
+        uint16_t failed;   // Refused by the transport
+    };
+
+    [[nodiscard]]
+    auto getSendStats() const -> SendStats {
+        return sendStats;
+    }
 
   private:
+    void changeState(Trigger trigger);
+    void processTriggers();
+
     // State handlers for each mode/throwState/entanglementState combination
     void enterClassicIdle();
     void whileClassicIdle();
@@ -152,25 +249,38 @@ class StateMachine {
     void whileLowBattery();
 
     // Communication functions
-    static void sendWatchDog();
-    static void sendMeasurements(uint8_t *target, State state, DiceNumbers diceNumber,
-                                 UpSide upSide, MeasuredAxises measureAxis);
-    static void sendEntangleRequest(uint8_t *target);
-    void sendEntanglementConfirm(uint8_t *target); // non-static to access entanglement_color
-    static void sendEntangleDenied(uint8_t *target);
-    static void sendTeleportRequest(uint8_t *target_m, uint8_t *target_b);
-    static void sendTeleportConfirm(uint8_t *target);
-    static void sendTeleportPayload(uint8_t *target, State state, DiceNumbers diceNumber,
-                                    UpSide upSide, MeasuredAxises measureAxis,
-                                    uint8_t *entangled_peer, uint16_t color);
-    static void sendTeleportPartner(uint8_t *target_n, uint8_t *new_partner_b);
-
-    IMUSensor *_imuSensor;
-    State      currentState;
-    uint8_t    current_peer[MAC_ADDRESS_LENGTH];
-    uint8_t    next_peer[MAC_ADDRESS_LENGTH];
+    auto transmit(const message &data, uint8_t *target) -> SendResult;
+    void sendMessage(const message &data, uint8_t *target);
+    void retryDeferredSends();
+    void updateWatchDog(unsigned long currentTime);
+    auto sendWatchDog() -> bool;
+    void sendMeasurements(uint8_t *target, State state, DiceNumbers diceNumber, UpSide upSide,
+                          MeasuredAxises measureAxis);
+    void sendEntangleRequest(uint8_t *target);
+    void sendEntanglementConfirm(uint8_t *target);
+    void repeatEntanglementConfirm(uint8_t *target);
+    void sendEntangleDenied(uint8_t *target);
+    void sendTeleportRequest(uint8_t *target_m, uint8_t *target_b);
+    void sendTeleportConfirm(uint8_t *target);
+    void sendTeleportPayload(uint8_t *target, State state, DiceNumbers diceNumber, UpSide upSide,
+                             MeasuredAxises measureAxis, uint8_t *entangled_peer, uint16_t color);
+    void sendTeleportPartner(uint8_t *target_n, uint8_t *new_partner_b);
+
+    IMUSensor        *_imuSensor;
+    MessageTransport *_transport;
+    State             currentState;
+    uint8_t           current_peer[MAC_ADDRESS_LENGTH];
+    uint8_t           next_peer[MAC_ADDRESS_LENGTH];
+    uint8_t           own_address[MAC_ADDRESS_LENGTH];
 
     unsigned long stateEntryTime;
+    unsigned long entangleRequestTime = 0; // Last request sent to next_peer
+
+    // Last watchdog sent and the time until the next one
+    bool          watchDogSent     = false;
+    State         watchDogState    = INITIAL_STATE;
+    unsigned long watchDogTime     = 0;
+    unsigned long watchDogInterval = WATCHDOG_MIN_INTERVAL;
 
     // EntangStateMachine entangStateMachine;
 
@@ -179,8 +289,16 @@ class StateMachine {
         void (StateMachine::*whileInState)();
     };
 
-    static const std::map<State, StateFunction>  stateFunctions;
-    static const std::array<StateTransition, 37> stateTransitions;
+    using StateFunctionTable = std::array<StateFunction, STATE_COUNT>;
+
+    static constexpr State INITIAL_STATE
+      = {Mode::CLASSIC, ThrowState::IDLE, EntanglementState::PURE};
+
+    // Indexed by stateId(); states without handlers hold null pointers
+    static const StateFunctionTable stateFunctions;
+
+    static constexpr auto buildStateFunctions() -> StateFunctionTable;
+    static constexpr auto handlersCoverReachableStates() -> bool;
 
     // Partner's measurement info (for post-entanglement state)
     MeasuredAxises partnerMeasurementAxis;
@@ -196,6 +314,22 @@ class StateMachine {
     // Memoization for basis and roll results
     MeasuredAxises lastRollBasis;
     DiceNumbers    lastRollNumber;
+
+    // Indexed by stateId() * TRIGGER_COUNT + trigger
+    std::array<uint16_t, STATE_COUNT * TRIGGER_COUNT> rejectedTriggers = {};
+
+    struct PendingTrigger {
+        Trigger       trigger;
+        unsigned long postedAt; // millis()
+    };
+
+    // Ring buffer of triggers waiting for processTriggers()
+    std::array<PendingTrigger, TRIGGER_QUEUE_SIZE> pendingTriggers   = {};
+    uint8_t                                        pendingHead       = 0;
+    uint8_t                                        pendingCount      = 0;
+    TriggerQueueStats                              triggerQueueStats = {};
+
+    SendStats sendStats = {};
 };
 
 #endif // STATEMACHINE_H
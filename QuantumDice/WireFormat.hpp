@@ -0,0 +1,35 @@
+#ifndef WIREFORMAT_H_
+#define WIREFORMAT_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+/*
+   WireFormat - how EspNowSensor<T> turns a T into a frame and back
+
+   The default sends the raw bytes of T and only accepts frames of exactly sizeof(T). A message
+   type can specialise WireFormat with its own encoding; see WireFormat<message> in
+   MessageTransport.hpp.
+*/
+
+template <typename T> struct WireFormat {
+    static constexpr size_t MAX_SIZE = sizeof(T);
+
+    // Writes at most MAX_SIZE bytes, returns the frame length
+    static auto encode(const T &message, uint8_t *frame) -> size_t {
+        memcpy(frame, &message, sizeof(T));
+        return sizeof(T);
+    }
+
+    // Returns false for a frame that is not a valid T
+    static auto decode(const uint8_t *frame, size_t length, T &message) -> bool {
+        if (length != sizeof(T)) {
+            return false;
+        }
+        memcpy(&message, frame, sizeof(T));
+        return true;
+    }
+};
+
+#endif /* WIREFORMAT_H_ */
@@ -3,6 +3,10 @@
 
 #define VERSION "2.0.0"
 
+// Compile the images into the firmware as a fallback for the asset pack in the assets partition.
+// Set to 0 to shrink the app once the pack is flashed on every die.
+#define EMBED_IMAGES 1
+
 #define DEBUG 1
 #if DEBUG == 1
 
@@ -2,4 +2,8 @@
 set -e
 
 mkdir -p QuantumDice/build
+
+# Regenerate the image headers, report their flash usage and write the asset pack
+python3 scripts/image_assets.py --pack QuantumDice/build/assets.bin
+
 arduino-cli compile --jobs 0 --profile esp32s3_dev_module --build-path QuantumDice/build QuantumDice
\ No newline at end of file
@@ -12,7 +12,7 @@ fi
 # -------- Find files --------
 FILES=$(git ls-files \
   | grep -E '\.(cpp|cxx|cc|hpp|h|ino)$' \
-  | grep -v -E 'build/|ImageLibrary/')
+  | grep -v -E 'build/|ImageLibrary/|^test/')
 
 if [ -z "$FILES" ]; then
     echo "No C++ files found."
@@ -0,0 +1,650 @@
+#!/usr/bin/env python3
+
+import argparse
+import mmap
+import os
+import re
+import struct
+import sys
+import zlib
+from collections import Counter
+
+# Token layout of the run-length formats, see QuantumDice/ImageAsset.hpp
+TOKEN_LITERAL = 0x80
+TOKEN_COLOR_RUN = 0x40
+MAX_LITERAL = 128
+MAX_RUN = 64
+MAX_PALETTE = 256
+
+# 0x0000 is the transparent key, as in the images made with "ImageConverter 565 Online".
+TRANSPARENT = 0x0000
+IMAGE_SIZE = 240
+
+# ImageFormat in QuantumDice/ImageAsset.hpp, in enum order
+FORMATS = ['RAW', 'RLE_INDEXED', 'RLE_DIRECT', 'MASK_1BPP', 'MASK_2BPP', 'RLE_MASK']
+
+# Single-colour glyphs, stored as coverage masks and tinted when they are drawn
+MASK_IMAGES = {'entangled'}
+MASK_LEVELS = 4
+RGB565_ALPHA_ONE = 32
+RGB565_SWAR_MASK = 0x07E0F81F
+
+SOURCE_DIR = 'assets/images'
+OUTPUT_DIR = 'QuantumDice/ImageLibrary'
+LIBRARY_HEADER = 'ImageLibrary.hpp'
+
+PNG_SIGNATURE = b'\x89PNG\r\n\x1a\n'
+
+# Asset pack for the assets partition, see QuantumDice/AssetStore.hpp
+PACK_MAGIC = b'QDAP'
+PACK_VERSION = 2
+PACK_HEADER = struct.Struct('<4sHHII')
+PACK_ENTRY = struct.Struct('<24sHHBBHHHIII')
+PACK_ALIGNMENT = 4
+ASSET_PARTITION_OFFSET = 0xC20000
+ASSET_PARTITION_SIZE = 0x100000
+
+
+# ---------------------------------------------------------------------------------------------
+# PNG reading and writing (8-bit, non-interlaced), so no imaging library is needed
+
+def paeth(a, b, c):
+    p = a + b - c
+    pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+    if pa <= pb and pa <= pc:
+        return a
+    return b if pb <= pc else c
+
+
+def readPng(path):
+    with open(path, 'rb') as f:
+        blob = f.read()
+    if not blob.startswith(PNG_SIGNATURE):
+        raise ValueError('not a PNG file')
+
+    position = len(PNG_SIGNATURE)
+    compressed = b''
+    palette = []
+    alphas = b''
+    while position < len(blob):
+        length, kind = struct.unpack('>I4s', blob[position:position + 8])
+        chunk = blob[position + 8:position + 8 + length]
+        position += 12 + length
+        if kind == b'IHDR':
+            width, height, depth, colorType, _, _, interlace = struct.unpack('>IIBBBBB', chunk)
+        elif kind == b'PLTE':
+            palette = [tuple(chunk[i:i + 3]) for i in range(0, len(chunk), 3)]
+        elif kind == b'tRNS':
+            alphas = chunk
+        elif kind == b'IDAT':
+            compressed += chunk
+        elif kind == b'IEND':
+            break
+
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}.get(colorType)
+    if depth != 8 or interlace != 0 or channels is None:
+        raise ValueError('only 8-bit non-interlaced PNG files are supported')
+
+    raw = zlib.decompress(compressed)
+    stride = width * channels
+    previous = bytearray(stride)
+    pixels = []
+    for y in range(height):
+        start = y * (stride + 1)
+        kind = raw[start]
+        row = bytearray(raw[start + 1:start + 1 + stride])
+        for x in range(stride):
+            left = row[x - channels] if x >= channels else 0
+            up = previous[x]
+            upLeft = previous[x - channels] if x >= channels else 0
+            if kind == 1:
+                row[x] = (row[x] + left) & 0xFF
+            elif kind == 2:
+                row[x] = (row[x] + up) & 0xFF
+            elif kind == 3:
+                row[x] = (row[x] + ((left + up) >> 1)) & 0xFF
+            elif kind == 4:
+                row[x] = (row[x] + paeth(left, up, upLeft)) & 0xFF
+        for x in range(width):
+            value = row[x * channels:(x + 1) * channels]
+            if colorType == 0:
+                rgba = (value[0], value[0], value[0], 255)
+            elif colorType == 2:
+                rgba = (value[0], value[1], value[2], 255)
+            elif colorType == 3:
+                alpha = alphas[value[0]] if value[0] < len(alphas) else 255
+                rgba = palette[value[0]] + (alpha,)
+            elif colorType == 4:
+                rgba = (value[0], value[0], value[0], value[1])
+            else:
+                rgba = tuple(value)
+            pixels.append(rgba)
+        previous = row
+    return width, height, pixels
+
+
+def writePng(path, width, height, pixels):
+    def chunk(kind, data):
+        return (struct.pack('>I', len(data)) + kind + data
+                + struct.pack('>I', zlib.crc32(kind + data) & 0xFFFFFFFF))
+
+    raw = bytearray()
+    for y in range(height):
+        raw.append(0)
+        for rgba in pixels[y * width:(y + 1) * width]:
+            raw.extend(rgba)
+    header = struct.pack('>IIBBBBB', width, height, 8, 6, 0, 0, 0)
+    with open(path, 'wb') as f:
+        f.write(PNG_SIGNATURE + chunk(b'IHDR', header) + chunk(b'IDAT', zlib.compress(bytes(raw), 9))
+                + chunk(b'IEND', b''))
+
+
+def toRgb565(rgba):
+    red, green, blue, alpha = rgba
+    if alpha < 128:
+        return TRANSPARENT
+    return ((red >> 3) << 11) | ((green >> 2) << 5) | (blue >> 3)
+
+
+def fromRgb565(color):
+    if color == TRANSPARENT:
+        return (0, 0, 0, 0)
+    red, green, blue = (color >> 11) & 0x1F, (color >> 5) & 0x3F, color & 0x1F
+    # Replicate the high bits, so converting back gives the same RGB565 value
+    return ((red << 3) | (red >> 2), (green << 2) | (green >> 4), (blue << 3) | (blue >> 2), 255)
+
+
+def blendRgb565(foreground, background, alpha):
+    # Mirror of blendRgb565() in QuantumDice/Rgb565.hpp
+    def expand(color):
+        return (color | (color << 16)) & RGB565_SWAR_MASK
+
+    blended = ((expand(foreground) * alpha + expand(background) * (RGB565_ALPHA_ONE - alpha)) >> 5)
+    blended &= RGB565_SWAR_MASK
+    return (blended | (blended >> 16)) & 0xFFFF
+
+
+# ---------------------------------------------------------------------------------------------
+# Encoders for colour images, one per ImageFormat. Each returns (data, palette, foreground) or
+# None if the image does not fit.
+
+def encodeRuns(pixels, colorBytes):
+    data = bytearray()
+    literal = []
+
+    def flushLiteral():
+        while literal:
+            chunk = literal[:MAX_LITERAL]
+            del literal[:MAX_LITERAL]
+            data.append(TOKEN_LITERAL | (len(chunk) - 1))
+            for color in chunk:
+                data.extend(colorBytes(color))
+
+    i = 0
+    while i < len(pixels):
+        color = pixels[i]
+        end = i
+        while end < len(pixels) and pixels[end] == color:
+            end += 1
+        run = end - i
+
+        # Single coloured pixels are cheaper as part of a literal run.
+        if color != TRANSPARENT and run == 1:
+            literal.append(color)
+        else:
+            flushLiteral()
+            while run > 0:
+                chunk = min(run, MAX_RUN)
+                if color == TRANSPARENT:
+                    data.append(chunk - 1)
+                else:
+                    data.append(TOKEN_COLOR_RUN | (chunk - 1))
+                    data.extend(colorBytes(color))
+                run -= chunk
+        i = end
+
+    flushLiteral()
+    return bytes(data)
+
+
+def usedColors(pixels):
+    return sorted({color for color in pixels if color != TRANSPARENT})
+
+
+def encodeRaw(pixels):
+    return b''.join(struct.pack('<H', color) for color in pixels), [], TRANSPARENT
+
+
+def encodeRleIndexed(pixels):
+    colors = usedColors(pixels)
+    if len(colors) > MAX_PALETTE:
+        return None
+    indices = {color: index for index, color in enumerate(colors)}
+    return encodeRuns(pixels, lambda color: bytes([indices[color]])), colors, TRANSPARENT
+
+
+def encodeRleDirect(pixels):
+    return encodeRuns(pixels, lambda color: struct.pack('<H', color)), [], TRANSPARENT
+
+
+def encodeMask1Bpp(pixels):
+    colors = usedColors(pixels)
+    if len(colors) > 1:
+        return None
+    return packBits([int(color != TRANSPARENT) for color in pixels], 1), [], (colors or [0xFFFF])[0]
+
+
+ENCODERS = {
+    'RAW': encodeRaw,
+    'RLE_INDEXED': encodeRleIndexed,
+    'RLE_DIRECT': encodeRleDirect,
+    'MASK_1BPP': encodeMask1Bpp,
+}
+
+
+# ---------------------------------------------------------------------------------------------
+# Coverage masks. Each pixel is a level index; level 0 is no coverage and shows the background.
+
+def packBits(levels, bitsPerPixel):
+    perByte = 8 // bitsPerPixel
+    data = bytearray((len(levels) + perByte - 1) // perByte)
+    for i, level in enumerate(levels):
+        data[i // perByte] |= level << (8 - bitsPerPixel * (i % perByte + 1))
+    return bytes(data)
+
+
+def maskCoverage(rgba):
+    # The glyph colour is the most common of the brightest colours; the coverage of a pixel is its
+    # brightness relative to the glyph colour, as the glyphs are anti-aliased over black.
+    visible = Counter(value[:3] for value in rgba if value[3] >= 128 and max(value[:3]) > 0)
+    peak = max(max(color) for color in visible)
+    glyph = max((color for color in visible if 20 * max(color) >= 19 * peak), key=visible.get)
+    coverage = [min(RGB565_ALPHA_ONE, round(max(value[:3]) * RGB565_ALPHA_ONE / max(glyph)))
+                if value[3] >= 128 else 0 for value in rgba]
+    return toRgb565(glyph + (255,)), coverage
+
+
+def fitLevels(coverage):
+    # Pick the coverage levels besides 0 that minimise the squared error, weighted by pixel
+    # count. There are at most 32 distinct values, so every split into runs is tried: a prefix of
+    # faint values that becomes 0, and up to MASK_LEVELS - 1 groups drawn at their mean.
+    histogram = Counter(value for value in coverage if value > 0)
+    values = sorted(histogram)
+
+    def group(first, last):
+        count = sum(histogram[value] for value in values[first:last])
+        level = round(sum(value * histogram[value] for value in values[first:last]) / count)
+        error = sum(histogram[value] * (value - level) ** 2 for value in values[first:last])
+        return error, [level]
+
+    def split(first, groups):
+        if first == len(values):
+            return 0, []
+        if groups == 1:
+            return group(first, len(values))
+        best = group(first, len(values))
+        for last in range(first + 1, len(values)):
+            head, rest = group(first, last), split(last, groups - 1)
+            if head[0] + rest[0] < best[0]:
+                best = (head[0] + rest[0], head[1] + rest[1])
+        return best
+
+    best = None
+    for first in range(len(values) + 1):
+        faint = sum(histogram[value] * value ** 2 for value in values[:first])
+        error, levels = split(first, MASK_LEVELS - 1)
+        if best is None or faint + error < best[0]:
+            best = (faint + error, levels)
+
+    levels = [0] + best[1]
+    return levels, [min(range(len(levels)), key=lambda i: abs(levels[i] - value))
+                    for value in coverage]
+
+
+def compileMask(name, rgba):
+    foreground, coverage = maskCoverage(rgba)
+    levels, indices = fitLevels(coverage)
+    candidates = [
+        ('MASK_2BPP', packBits(indices, 2)),
+        ('RLE_MASK', encodeRuns(indices, lambda level: bytes([level]))),
+    ]
+    if levels == [0, RGB565_ALPHA_ONE]:
+        candidates.append(('MASK_1BPP', packBits(indices, 1)))
+
+    imageFormat, data = min(candidates, key=lambda candidate: len(candidate[1]))
+    tints = [blendRgb565(foreground, TRANSPARENT, level) for level in levels]
+    if imageFormat == 'MASK_1BPP':
+        levels = []
+    if decode(data, imageFormat, levels, len(rgba), foreground) != [tints[i] for i in indices]:
+        print(f"❌ Error: {name} does not survive the round trip.")
+        sys.exit(1)
+    return imageFormat, data, levels, len(data) + 2 * len(levels), foreground
+
+
+def decode(data, imageFormat, palette, pixelCount, foreground):
+    # Mirror of ImageDecoder in QuantumDice/ImageAsset.cpp; transparent pixels stay 0x0000 and
+    # masks are drawn in the foreground colour.
+    if imageFormat == 'RAW':
+        return list(struct.unpack(f'<{pixelCount}H', data[:2 * pixelCount]))
+
+    levels = [0, RGB565_ALPHA_ONE] if imageFormat == 'MASK_1BPP' else palette
+    tints = [blendRgb565(foreground, TRANSPARENT, min(levels[level], RGB565_ALPHA_ONE))
+             if level < len(levels) else TRANSPARENT for level in range(MASK_LEVELS)]
+    if imageFormat in ('MASK_1BPP', 'MASK_2BPP'):
+        bitsPerPixel = 1 if imageFormat == 'MASK_1BPP' else 2
+        perByte = 8 // bitsPerPixel
+        return [tints[(data[i // perByte] >> (8 - bitsPerPixel * (i % perByte + 1)))
+                      & ((1 << bitsPerPixel) - 1)] for i in range(pixelCount)]
+
+    position = 0
+
+    def readColor():
+        nonlocal position
+        if imageFormat == 'RLE_MASK':
+            color = tints[data[position]] if data[position] < MASK_LEVELS else TRANSPARENT
+            position += 1
+        elif imageFormat == 'RLE_INDEXED':
+            color = palette[data[position]]
+            position += 1
+        else:
+            color = data[position] | (data[position + 1] << 8)
+            position += 2
+        return color
+
+    pixels = []
+    while position < len(data):
+        token = data[position]
+        position += 1
+        if token & TOKEN_LITERAL:
+            pixels.extend(readColor() for _ in range((token & 0x7F) + 1))
+        elif token & TOKEN_COLOR_RUN:
+            color = readColor()
+            pixels.extend([color] * ((token & 0x3F) + 1))
+        else:
+            pixels.extend([TRANSPARENT] * ((token & 0x3F) + 1))
+    return pixels[:pixelCount]
+
+
+def compileImage(name, pixels):
+    # Pick the smallest format that fits and check that it decodes to exactly the same pixels.
+    best = None
+    for imageFormat, encoder in ENCODERS.items():
+        encoded = encoder(pixels)
+        if encoded is None:
+            continue
+        data, palette, foreground = encoded
+        size = len(data) + 2 * len(palette)
+        if best is None or size < best[3]:
+            best = (imageFormat, data, palette, size, foreground)
+
+    imageFormat, data, palette, size, foreground = best
+    if decode(data, imageFormat, palette, len(pixels), foreground) != pixels:
+        print(f"❌ Error: {name} does not survive the round trip.")
+        sys.exit(1)
+    return best
+
+
+# ---------------------------------------------------------------------------------------------
+# Header generation
+
+def formatArray(values, digits, perLine):
+    lines = []
+    for start in range(0, len(values), perLine):
+        chunk = values[start:start + perLine]
+        lines.append('  ' + ', '.join(f'0x{value:0{digits}X}' for value in chunk) + ',')
+    return lines
+
+
+def renderHeader(name, width, height, imageFormat, data, palette, size, foreground):
+    guard = f'IMAGELIBRARY_{name.upper()}_H_'
+    lines = [
+        f'// Generated by scripts/image_assets.py from {SOURCE_DIR}/{name}.png - do not edit',
+        f'// Image Size     : {width}x{height} pixels, {imageFormat}',
+        f'// Memory usage   : {size} bytes (raw {2 * width * height} bytes)',
+        '',
+        f'#ifndef {guard}',
+        f'#define {guard}',
+        '',
+        '#include "../ImageAsset.hpp"',
+        '',
+        '#include <Arduino.h>',
+        '',
+    ]
+    if palette:
+        lines += [f'static constexpr uint16_t {name}_palette[] PROGMEM = {{']
+        lines += formatArray(palette, 4, 12) + ['};', '']
+    lines += [f'static constexpr uint8_t {name}_data[] PROGMEM = {{']
+    lines += formatArray(list(data), 2, 16) + ['};', '']
+    paletteName = f'{name}_palette' if palette else 'nullptr'
+    lines += [
+        f'static constexpr ImageAsset {name} = {{',
+        f'  {width}, {height}, ImageFormat::{imageFormat}, 0x{TRANSPARENT:04X},',
+        f'  0x{foreground:04X}, {paletteName}, {len(palette)}, {name}_data,',
+        f'  sizeof({name}_data)}};',
+        '',
+        f'#endif /* {guard} */',
+        '',
+    ]
+    return '\r\n'.join(lines)
+
+
+def renderLibrary(names):
+    lines = [
+        '// Generated by scripts/image_assets.py - do not edit',
+        '// Add an image by dropping a PNG into ' + SOURCE_DIR + ' and running the script.',
+        '',
+        '#ifndef IMAGELIBRARY_H',
+        '#define IMAGELIBRARY_H',
+        '',
+    ]
+    lines += [f'#include "{name}.hpp"' for name in names]
+    lines += ['', '#endif', '']
+    return '\r\n'.join(lines)
+
+
+def writeIfChanged(path, content, check):
+    current = None
+    if os.path.exists(path):
+        with open(path, 'r', newline='') as f:
+            current = f.read()
+    if current == content:
+        return True
+    if check:
+        print(f"❌ Error: {path} is out of date, run scripts/image_assets.py.")
+        return False
+    with open(path, 'w', newline='') as f:
+        f.write(content)
+    return True
+
+
+# ---------------------------------------------------------------------------------------------
+# Asset pack
+
+def align(blob):
+    blob.extend(bytes(-len(blob) % PACK_ALIGNMENT))
+
+
+def buildPack(images):
+    # images: (name, width, height, imageFormat, data, palette, foreground) in directory order
+    blob = bytearray(PACK_HEADER.size + PACK_ENTRY.size * len(images))
+    entries = []
+    for name, width, height, imageFormat, data, palette, foreground in images:
+        paletteOffset = 0
+        if palette:
+            paletteOffset = len(blob)
+            blob.extend(struct.pack(f'<{len(palette)}H', *palette))
+            align(blob)
+        dataOffset = len(blob)
+        blob.extend(data)
+        align(blob)
+        entries.append(PACK_ENTRY.pack(name.encode(), width, height, FORMATS.index(imageFormat), 0,
+                                       TRANSPARENT, len(palette), foreground, paletteOffset,
+                                       dataOffset, len(data)))
+
+    PACK_HEADER.pack_into(blob, 0, PACK_MAGIC, PACK_VERSION, len(images), len(blob), 0)
+    for index, entry in enumerate(entries):
+        offset = PACK_HEADER.size + index * PACK_ENTRY.size
+        blob[offset:offset + PACK_ENTRY.size] = entry
+    return bytes(blob)
+
+
+def readPack(path):
+    # Host stand-in for the firmware's AssetStore: map a file-backed image of the partition (for
+    # example a pack from --pack, or a dump made with esptool read_flash) and decode every image
+    # straight from the mapping.
+    images = {}
+    with open(path, 'rb') as f, mmap.mmap(f.fileno(), 0, access=mmap.ACCESS_READ) as pack:
+        magic, version, count, size, _ = PACK_HEADER.unpack_from(pack, 0)
+        if magic != PACK_MAGIC or version != PACK_VERSION or size > len(pack):
+            raise ValueError('no valid asset pack')
+        for index in range(count):
+            entryOffset = PACK_HEADER.size + index * PACK_ENTRY.size
+            (name, width, height, formatIndex, _, _, paletteSize, foreground, paletteOffset,
+             dataOffset, dataSize) = PACK_ENTRY.unpack_from(pack, entryOffset)
+            if paletteOffset + 2 * paletteSize > size or dataOffset + dataSize > size:
+                raise ValueError(f'entry {index} points outside the pack')
+            palette = list(struct.unpack_from(f'<{paletteSize}H', pack, paletteOffset))
+            data = pack[dataOffset:dataOffset + dataSize]
+            images[name.rstrip(b'\0').decode()] = decode(data, FORMATS[formatIndex], palette,
+                                                         width * height, foreground)
+    return images
+
+
+def writePack(path, images, sources):
+    blob = buildPack(images)
+    if len(blob) > ASSET_PARTITION_SIZE:
+        print(f"❌ Error: the asset pack takes {len(blob)} bytes, the partition holds "
+              f"{ASSET_PARTITION_SIZE} bytes.")
+        sys.exit(1)
+    with open(path, 'wb') as f:
+        f.write(blob)
+    if readPack(path) != sources:
+        print(f"❌ Error: {path} does not decode to the source images.")
+        sys.exit(1)
+    print(f"✔ Wrote {path} ({len(blob)} bytes), flash it at 0x{ASSET_PARTITION_OFFSET:X}.")
+
+
+# ---------------------------------------------------------------------------------------------
+# Importing existing headers as PNG sources
+
+def readHeaderImage(text):
+    # "ImageConverter 565 Online": one raw RGB565 array.
+    match = re.search(r'const unsigned short\s+(\w+)\s*\[\s*(\d+)\s*\]', text)
+    if match is not None:
+        body = text[text.index('{', match.end()) + 1:text.rindex('}')]
+        body = re.sub(r'//[^\n]*', '', body)
+        return match.group(1), [int(value, 16) for value in re.findall(r'0x[0-9A-Fa-f]+', body)]
+
+    # Generated by this script.
+    match = re.search(r'ImageAsset\s+(\w+)\s*=\s*\{([^}]*)\}', text)
+    if match is None:
+        return None
+    name = match.group(1)
+    fields = [field.strip() for field in match.group(2).split(',')]
+    width, height, imageFormat = int(fields[0]), int(fields[1]), fields[2].split('::')[-1]
+    foreground = int(fields[4], 16) if len(fields) >= 9 else TRANSPARENT
+    palette = readArray(text, f'{name}_palette') if f'{name}_palette[]' in text else []
+    data = bytes(readArray(text, f'{name}_data'))
+    return name, decode(data, imageFormat, palette, width * height, foreground)
+
+
+def readArray(text, arrayName):
+    match = re.search(r'\b' + arrayName + r'\[\]\s*PROGMEM\s*=\s*\{([^}]*)\}', text)
+    if match is None:
+        print(f"❌ Error: array {arrayName} not found.")
+        sys.exit(1)
+    return [int(value, 16) for value in re.findall(r'0x[0-9A-Fa-f]+', match.group(1))]
+
+
+def importHeaders(paths):
+    os.makedirs(SOURCE_DIR, exist_ok=True)
+    for path in paths:
+        with open(path, 'r') as f:
+            image = readHeaderImage(f.read())
+        if image is None or len(image[1]) != IMAGE_SIZE * IMAGE_SIZE:
+            print(f"❌ Error: no {IMAGE_SIZE}x{IMAGE_SIZE} image found in {path}.")
+            sys.exit(1)
+        name, pixels = image
+        writePng(os.path.join(SOURCE_DIR, f'{name}.png'), IMAGE_SIZE, IMAGE_SIZE,
+                 [fromRgb565(color) for color in pixels])
+        print(f"✔ Imported {name} from {path}")
+
+
+# ---------------------------------------------------------------------------------------------
+
+def main():
+    parser = argparse.ArgumentParser(
+        description=f'Compile the PNG images in {SOURCE_DIR} into {OUTPUT_DIR} headers.')
+    parser.add_argument('--check', action='store_true',
+                        help='only check that the generated headers are up to date')
+    parser.add_argument('--budget', type=int,
+                        help='fail when the images take more than this many bytes of flash')
+    parser.add_argument('--import', dest='headers', nargs='+', metavar='HEADER',
+                        help='turn existing image headers into PNG sources')
+    parser.add_argument('--pack', metavar='FILE',
+                        help='also write the images into an asset pack for the assets partition')
+    parser.add_argument('--show-pack', metavar='FILE',
+                        help='map an asset pack (or a dump of the partition) and list its images')
+    arguments = parser.parse_args()
+
+    if arguments.headers:
+        importHeaders(arguments.headers)
+        return
+
+    if arguments.show_pack:
+        for name, pixels in readPack(arguments.show_pack).items():
+            print(f"{name:<28}{len(pixels):>8} pixels")
+        return
+
+    if not os.path.isdir(SOURCE_DIR):
+        print(f"❌ Error: directory {SOURCE_DIR} not found, run from the repository root.")
+        sys.exit(1)
+
+    names = []
+    packed = []
+    sources = {}
+    total = 0
+    upToDate = True
+    print(f"{'Image':<28}{'Format':<14}{'Bytes':>8}{'Raw':>9}")
+    for fileName in sorted(os.listdir(SOURCE_DIR), key=str.lower):
+        name, extension = os.path.splitext(fileName)
+        if extension.lower() != '.png':
+            continue
+        if not re.fullmatch(r'[A-Za-z_]\w*', name):
+            print(f"❌ Error: {fileName} is not a valid C++ identifier.")
+            sys.exit(1)
+
+        width, height, rgba = readPng(os.path.join(SOURCE_DIR, fileName))
+        if width != IMAGE_SIZE or height != IMAGE_SIZE:
+            print(f"❌ Error: {fileName} is {width}x{height}, expected {IMAGE_SIZE}x{IMAGE_SIZE}.")
+            sys.exit(1)
+        if name in MASK_IMAGES:
+            compiled = compileMask(name, rgba)
+        else:
+            compiled = compileImage(name, [toRgb565(value) for value in rgba])
+        imageFormat, data, palette, size, foreground = compiled
+        header = renderHeader(name, width, height, imageFormat, data, palette, size, foreground)
+        upToDate &= writeIfChanged(os.path.join(OUTPUT_DIR, f'{name}.hpp'), header,
+                                   arguments.check)
+        names.append(name)
+        packed.append((name, width, height, imageFormat, data, palette, foreground))
+        sources[name] = decode(data, imageFormat, palette, len(rgba), foreground)
+        total += size
+        print(f"{name:<28}{imageFormat:<14}{size:>8}{100 * size / (2 * len(rgba)):>8.1f}%")
+
+    upToDate &= writeIfChanged(os.path.join(OUTPUT_DIR, LIBRARY_HEADER), renderLibrary(names),
+                               arguments.check)
+    print(f"{'Total':<42}{total:>8}")
+
+    if not upToDate:
+        sys.exit(1)
+    if arguments.pack:
+        writePack(arguments.pack, packed, sources)
+    if arguments.budget is not None and total > arguments.budget:
+        print(f"❌ Error: images take {total} bytes, the budget is {arguments.budget} bytes.")
+        sys.exit(1)
+    print("✔ Done.")
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,130 @@
+#include "HostTest.hpp"
+#include "SimArduino.hpp"
+#include "SimBus.hpp"
+#include "SimFleet.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <vector>
+
+// The radio load of a room of dice, from 2 to SIM_FLEET_SIZE: frames and air time per die, idle
+// and in entangle churn. In churn, every CHURN_CYCLE_MS the dice are paired at random and each
+// pair is held together for CLOSE_MS, then all dice are thrown and land on a random side.
+constexpr int32_t       RSSI_CLOSE     = -30;
+constexpr int32_t       RSSI_APART     = -80;
+constexpr unsigned long TICK_MS        = 10;
+constexpr unsigned long SETTLE_MS      = 10000; // Long enough for the watchdog to back off fully
+constexpr unsigned long MEASURE_MS     = 60000;
+constexpr unsigned long CHURN_CYCLE_MS = 10000;
+constexpr unsigned long CLOSE_MS       = 5000;
+constexpr unsigned long LANDING_MS     = 200; // After the throw
+constexpr double        IDLE_RATE_MAX  = 0.3; // Frames/s per die; a watchdog per 4 s is 0.25
+constexpr double        CHURN_RATE_MAX = 2.0; // Frames/s per die
+
+static_assert(MEASURE_MS % CHURN_CYCLE_MS == 0, "A churn ends with the dice apart and landed");
+
+static const size_t DICE_COUNTS[] = {2, 5, 10, 15, 20, 25, 30};
+
+static const SimOrientation LANDINGS[] = {SimOrientation::Z_UP, SimOrientation::Z_DOWN,
+                                          SimOrientation::X_UP, SimOrientation::X_DOWN,
+                                          SimOrientation::Y_UP, SimOrientation::Y_DOWN};
+
+struct Load {
+    double framesPerSecond; // Per die
+    double airtimeShare;    // Per die, of the measured time
+};
+
+class Room {
+  public:
+    // Adds dice up to count, each switched to QUANTUM
+    void grow(size_t count) {
+        bus.setRssi(RSSI_APART);
+        while (dice.size() < count) {
+            order.push_back(dice.size());
+            dice.push_back(makeFleetDie(dice.size(), bus));
+            dice.back()->begin();
+            dice.back()->longClick();
+        }
+    }
+
+    // Runs for ms with the dice apart, or in churn
+    auto measure(unsigned long ms, bool churn) -> Load {
+        SimAirStats before = total();
+
+        for (unsigned long elapsed = 0; elapsed < ms; elapsed += TICK_MS) {
+            unsigned long cycle = elapsed % CHURN_CYCLE_MS;
+            if (churn && cycle == 0) {
+                std::shuffle(order.begin(), order.end(), generator);
+                setPairRssi(RSSI_CLOSE);
+            } else if (churn && cycle == CLOSE_MS) {
+                setPairRssi(RSSI_APART);
+                for (std::unique_ptr<SimDie> &die : dice) {
+                    die->throwDie();
+                }
+            } else if (churn && cycle == CLOSE_MS + LANDING_MS) {
+                for (std::unique_ptr<SimDie> &die : dice) {
+                    die->land(LANDINGS[generator() % std::size(LANDINGS)]);
+                }
+            }
+            advanceClock(TICK_MS * 1000);
+            for (std::unique_ptr<SimDie> &die : dice) {
+                die->update();
+            }
+        }
+
+        SimAirStats after   = total();
+        double      seconds = ms / 1000.0;
+        return {(after.frames - before.frames) / seconds / dice.size(),
+                (after.airtimeUs - before.airtimeUs) / (seconds * 1e6) / dice.size()};
+    }
+
+    // Lets the watchdogs of new dice, and of the states the churn left, back off
+    void settle() {
+        measure(SETTLE_MS, false);
+    }
+
+  private:
+    SimBus                               bus;
+    std::vector<std::unique_ptr<SimDie>> dice;
+    std::vector<size_t>                  order; // Dice indices, consecutive ones are a pair
+    std::mt19937                         generator{1};
+
+    void setPairRssi(int32_t rssi) {
+        for (size_t i = 0; i + 1 < order.size(); i += 2) {
+            bus.setRssi(dice[order[i]]->getMac(), dice[order[i + 1]]->getMac(), rssi);
+        }
+    }
+
+    auto total() const -> SimAirStats {
+        SimAirStats sum = {0, 0};
+        for (const std::unique_ptr<SimDie> &die : dice) {
+            SimAirStats air  = bus.getAirStats(die->getMac());
+            sum.frames      += air.frames;
+            sum.airtimeUs   += air.airtimeUs;
+        }
+        return sum;
+    }
+};
+
+int main() {
+    seedRandom(1);
+    CHECK(getFleetSize() >= DICE_COUNTS[std::size(DICE_COUNTS) - 1]);
+
+    Room room;
+    printf("dice  idle frames/s  idle air   churn frames/s  churn air  (per die)\n");
+    for (size_t count : DICE_COUNTS) {
+        room.grow(count);
+        room.settle();
+        Load idle  = room.measure(MEASURE_MS, false);
+        Load churn = room.measure(MEASURE_MS, true);
+        room.settle();
+
+        printf("%4zu  %13.2f  %7.3f%%  %14.2f  %8.3f%%\n", count, idle.framesPerSecond,
+               idle.airtimeShare * 100, churn.framesPerSecond, churn.airtimeShare * 100);
+        CHECK(idle.framesPerSecond <= IDLE_RATE_MAX);
+        CHECK(churn.framesPerSecond <= CHURN_RATE_MAX);
+    }
+    return hostTestResult();
+}
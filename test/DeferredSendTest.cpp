@@ -0,0 +1,143 @@
+// One simulated die in a namespace of its own, see sim/SimDieUnity.inc, so the test can read its
+// state machine's send statistics and encode messages for it
+#define SIM_DIE_NAMESPACE deferredSendTest
+#define SIM_DIE_FACTORY makeDeferredSendTestDie
+#include "SimDieUnity.inc"
+
+#include "HostTest.hpp"
+
+#include <set>
+
+namespace deferredSendTest {
+
+    // Link sequence numbers of the ENTANGLE_DENIED frames the prober heard, retransmissions
+    // included
+    static std::multiset<uint8_t> denials;
+
+    static void onProberSent(const wifi_tx_info_t *, esp_now_send_status_t) {}
+
+    static void onProberReceived(const esp_now_recv_info_t *, const uint8_t *frame, int length) {
+        message data;
+        if (length > 1 && WireFormat<message>::decode(frame + 1, length - 1, data)
+            && data.type == MESSAGE_TYPE_ENTANGLE_DENIED) {
+            denials.insert(frame[0]);
+        }
+    }
+
+    static auto distinctDenials() -> size_t {
+        return std::set<uint8_t>(denials.begin(), denials.end()).size();
+    }
+
+    // A second radio on the bus that asks the die to entangle. The die is in CLASSIC mode and
+    // denies each request. The bus loses every acknowledgement, so each denial keeps a send
+    // buffer through all its retransmissions.
+    class Prober {
+      public:
+        explicit Prober(SimBus &bus) : bus(bus), mac(bus.attach()) {
+            bus.enter(mac);
+            esp_now_register_send_cb(onProberSent);
+            esp_now_register_recv_cb(onProberReceived);
+        }
+
+        void request(const SimMac &target, size_t count) {
+            bus.enter(mac);
+            for (size_t i = 0; i < count; i++) {
+                message data;
+                data.type = MESSAGE_TYPE_ENTANGLE_REQUEST;
+                uint8_t frame[1 + WireFormat<message>::MAX_SIZE];
+                frame[0]      = sequence++;
+                size_t length = WireFormat<message>::encode(data, frame + 1);
+                esp_now_send(target.data(), frame, length + 1);
+            }
+        }
+
+        // Takes the frames the die sent
+        void listen() {
+            bus.enter(mac);
+        }
+
+      private:
+        SimBus &bus;
+        SimMac  mac;
+        uint8_t sequence = 1;
+    };
+
+    static void tick(SimDie &die, Prober &prober, unsigned long ms) {
+        advanceClock(ms * 1000);
+        die.update();
+        prober.listen();
+    }
+
+    static void run(SimDie &die, Prober &prober, unsigned long ms) {
+        for (unsigned long elapsed = 0; elapsed < ms; elapsed++) {
+            tick(die, prober, 1);
+        }
+    }
+
+    // Denials beyond the ESPNOW_SEND_POOL_SIZE buffers wait, and go out in turn as buffers free
+    static void defersWhenThePoolIsFull(SimDie &die, StateMachine &machine, Prober &prober) {
+        StateMachine::SendStats before = machine.getSendStats();
+        denials.clear();
+
+        prober.request(die.getMac(), ESPNOW_SEND_POOL_SIZE + DEFERRED_SEND_SIZE);
+        tick(die, prober, 1);
+        CHECK(machine.getSendStats().deferred == before.deferred + DEFERRED_SEND_SIZE);
+        CHECK(distinctDenials() == ESPNOW_SEND_POOL_SIZE);
+
+        run(die, prober, DEFERRED_SEND_TIMEOUT);
+        StateMachine::SendStats after = machine.getSendStats();
+        CHECK(distinctDenials() == ESPNOW_SEND_POOL_SIZE + DEFERRED_SEND_SIZE);
+        CHECK(after.expired == before.expired && after.dropped == before.dropped);
+        CHECK(after.failed == before.failed);
+        printf("%zu denials, %u deferred, %zu frames with retransmissions\n", distinctDenials(),
+               after.deferred - before.deferred, denials.size());
+    }
+
+    // Past DEFERRED_SEND_SIZE waiting sends, new ones are dropped
+    static void dropsWhenTheQueueIsFull(SimDie &die, StateMachine &machine, Prober &prober) {
+        StateMachine::SendStats before = machine.getSendStats();
+        denials.clear();
+
+        prober.request(die.getMac(), ESPNOW_SEND_POOL_SIZE + DEFERRED_SEND_SIZE + 2);
+        tick(die, prober, 1);
+        CHECK(machine.getSendStats().dropped == before.dropped + 2);
+
+        run(die, prober, DEFERRED_SEND_TIMEOUT);
+        CHECK(distinctDenials() == ESPNOW_SEND_POOL_SIZE + DEFERRED_SEND_SIZE);
+        CHECK(machine.getSendStats().expired == before.expired);
+    }
+
+    // A send that waited longer than DEFERRED_SEND_TIMEOUT is not sent at all
+    static void expiresStaleSends(SimDie &die, StateMachine &machine, Prober &prober) {
+        StateMachine::SendStats before = machine.getSendStats();
+        denials.clear();
+
+        prober.request(die.getMac(), ESPNOW_SEND_POOL_SIZE + DEFERRED_SEND_SIZE);
+        tick(die, prober, 1);
+        tick(die, prober, DEFERRED_SEND_TIMEOUT + 1);
+        CHECK(machine.getSendStats().expired == before.expired + DEFERRED_SEND_SIZE);
+
+        run(die, prober, DEFERRED_SEND_TIMEOUT);
+        CHECK(distinctDenials() == ESPNOW_SEND_POOL_SIZE);
+    }
+
+    static void run() {
+        SimBus                  bus;
+        std::unique_ptr<SimDie> made = makeDeferredSendTestDie(bus);
+        Prober                  prober(bus);
+        made->begin();
+        tick(*made, prober, 1);
+        bus.setChannel({0, 0, 100});
+
+        StateMachine &machine = static_cast<Die &>(*made).getStateMachine();
+        defersWhenThePoolIsFull(*made, machine, prober);
+        dropsWhenTheQueueIsFull(*made, machine, prober);
+        expiresStaleSends(*made, machine, prober);
+    }
+
+} // namespace deferredSendTest
+
+int main() {
+    deferredSendTest::run();
+    return hostTestResult();
+}
@@ -0,0 +1,225 @@
+#include "HostTest.hpp"
+#include "SimDisplay.hpp"
+#include "SimPanel.hpp"
+
+#include "DisplayCommit.hpp"
+#include "RenderTarget.hpp"
+#include "RoundDisplay.hpp"
+#include "Screenfunctions.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <vector>
+
+// The pushes of DisplayCommit.cpp through the fake SPI sink, with the display task on a thread of
+// its own. The sink takes real time for every transfer, so the bands are still on the bus when the
+// caller has queued the last one.
+
+extern Adafruit_GC9A01A tft;
+
+constexpr uint16_t BANDS = HEIGHT / BAND_ROWS;
+
+struct BusTotals {
+    uint32_t windows;
+    uint32_t pixels;
+    uint32_t bytes; // Address windows and pixels
+};
+
+static auto busTotals(const std::vector<SimSpiRecord> &log) -> BusTotals {
+    BusTotals totals = {0, 0, 0};
+    for (const SimSpiRecord &entry : log) {
+        if (entry.event == SimSpiEvent::ADDRESS_WINDOW) {
+            totals.windows++;
+            totals.bytes += SIM_WINDOW_BYTES;
+        } else if (entry.event == SimSpiEvent::PIXELS) {
+            totals.pixels += entry.pixels;
+            totals.bytes  += entry.pixels * SIM_BYTES_PER_PIXEL;
+        }
+    }
+    return totals;
+}
+
+// One window per scanline, each the visible chord of its row
+static auto windowsFollowChords(const std::vector<SimSpiRecord> &log) -> bool {
+    uint16_t row = 0;
+    for (const SimSpiRecord &entry : log) {
+        if (entry.event != SimSpiEvent::ADDRESS_WINDOW) {
+            continue;
+        }
+        if (row >= HEIGHT || entry.y != row || entry.height != 1
+            || entry.x != ROUND_CHORDS[row].start || entry.width != ROUND_CHORDS[row].width) {
+            return false;
+        }
+        row++;
+    }
+    return row == HEIGHT;
+}
+
+// The transactions of the log, in order, each as the index of its END_WRITE
+static auto transactionEnds(const std::vector<SimSpiRecord> &log) -> std::vector<size_t> {
+    std::vector<size_t> ends;
+    for (size_t i = 0; i < log.size(); i++) {
+        if (log[i].event == SimSpiEvent::END_WRITE) {
+            ends.push_back(i);
+        }
+    }
+    return ends;
+}
+
+// Address windows and pixels only inside a transaction, chip selects only outside
+static auto wellFormed(const std::vector<SimSpiRecord> &log) -> bool {
+    bool inTransaction = false;
+    for (const SimSpiRecord &entry : log) {
+        switch (entry.event) {
+            case SimSpiEvent::START_WRITE:
+                if (inTransaction) {
+                    return false;
+                }
+                inTransaction = true;
+                break;
+            case SimSpiEvent::END_WRITE:
+                if (!inTransaction) {
+                    return false;
+                }
+                inTransaction = false;
+                break;
+            case SimSpiEvent::ADDRESS_WINDOW:
+            case SimSpiEvent::PIXELS:
+                if (!inTransaction) {
+                    return false;
+                }
+                break;
+            case SimSpiEvent::PIN:
+                if (inTransaction) {
+                    return false;
+                }
+                break;
+        }
+    }
+    return !inTransaction;
+}
+
+// Queues a screen of BANDS bands on the selected faces, as displayImageWithBackground() does
+static void queueBands(uint16_t color) {
+    RenderTarget &target = renderTarget();
+    for (uint16_t top = 0; top < HEIGHT; top += BAND_ROWS) {
+        uint16_t *band = target.acquireRows();
+        std::fill_n(band, WIDTH * BAND_ROWS, color);
+        target.blitRows(band, top, BAND_ROWS);
+    }
+}
+
+// displayFence() returns once every queued band has been clocked out
+static void fenceWaitsForQueuedBands() {
+    selectScreens(XX);
+    clearSimSpiLog();
+
+    queueBands(GC9A01A_RED);
+    displayFence();
+    std::vector<SimSpiRecord> log = getSimSpiLog();
+    CHECK(transactionEnds(log).size() == BANDS);
+    CHECK(wellFormed(log));
+}
+
+// selectScreens() changes the chip selects only after the last queued band is on the panels
+static void chipSelectFollowsQueuedBands() {
+    selectScreens(XX);
+    clearSimSpiLog();
+
+    DisplayCommitStats before = getDisplayCommitStats();
+    queueBands(GC9A01A_WHITE);
+    selectScreens(ZZ);
+    DisplayCommitStats after = getDisplayCommitStats();
+
+    std::vector<SimSpiRecord> log  = getSimSpiLog();
+    std::vector<size_t>       ends = transactionEnds(log);
+    auto firstPin = std::find_if(log.begin(), log.end(), [](const SimSpiRecord &entry) {
+        return entry.event == SimSpiEvent::PIN;
+    });
+    CHECK(ends.size() == BANDS);
+    CHECK(firstPin != log.end() && !ends.empty()
+          && static_cast<size_t>(firstPin - log.begin()) > ends.back());
+    CHECK(firstPin != log.end() && !ends.empty() && firstPin->micros >= log[ends.back()].micros);
+    CHECK(wellFormed(log));
+    CHECK(after.bandsCommitted - before.bandsCommitted == BANDS);
+
+    printf("%u bands: %lu us on the bus, %lu us waiting for a band buffer or the fence\n",
+           (unsigned)BANDS, log[ends.back()].micros - log.front().micros,
+           (unsigned long)(after.fenceWaitMicros - before.fenceWaitMicros));
+}
+
+// A fence while a band is being composed does not wait for that band
+static void fenceWhileComposing() {
+    clearSimSpiLog();
+    RenderTarget &target = renderTarget();
+    uint16_t     *band   = target.acquireRows();
+    displayFence();
+    std::fill_n(band, WIDTH * BAND_ROWS, GC9A01A_BLACK);
+    target.blitRows(band, 0, BAND_ROWS);
+    displayFence();
+    CHECK(transactionEnds(getSimSpiLog()).size() == 1);
+}
+
+// A full frame goes out as the 45692 visible pixels of the circle in 240 address windows, where
+// the square would be 57600 pixels in one
+static void frameSkipsCorners() {
+    static uint16_t frame[WIDTH * HEIGHT];
+    std::fill_n(frame, WIDTH * HEIGHT, GC9A01A_RED);
+
+    selectScreens(XX);
+    displayFence();
+    clearSimSpiLog();
+    DisplayCommitStats before = getDisplayCommitStats();
+    commitFrame(frame);
+    displayFence();
+    DisplayCommitStats        after = getDisplayCommitStats();
+    std::vector<SimSpiRecord> round = getSimSpiLog();
+
+    clearSimSpiLog();
+    tft.startWrite();
+    tft.setAddrWindow(0, 0, WIDTH, HEIGHT);
+    tft.writePixels(frame, WIDTH * HEIGHT);
+    tft.endWrite();
+    std::vector<SimSpiRecord> square = getSimSpiLog();
+
+    BusTotals roundTotals  = busTotals(round);
+    BusTotals squareTotals = busTotals(square);
+    CHECK(roundTotals.windows == 240);
+    CHECK(roundTotals.pixels == 45692);
+    CHECK(windowsFollowChords(round));
+    CHECK(transactionEnds(round).size() == 1);
+    CHECK(squareTotals.windows == 1);
+    CHECK(squareTotals.pixels == 57600);
+    CHECK(after.bytesPushed - before.bytesPushed == 45692 * sizeof(uint16_t));
+    CHECK(after.bytesSkipped - before.bytesSkipped == (57600 - 45692) * sizeof(uint16_t));
+    CHECK(roundTotals.bytes < squareTotals.bytes);
+
+    printf("Frame: %lu bytes in %lu us clipped, %lu bytes in %lu us square\n",
+           (unsigned long)roundTotals.bytes, round.back().micros - round.front().micros,
+           (unsigned long)squareTotals.bytes, square.back().micros - square.front().micros);
+}
+
+// A fill is clipped the same way
+static void fillSkipsCorners() {
+    displayFence();
+    clearSimSpiLog();
+    commitFill(GC9A01A_BLACK);
+    displayFence();
+    std::vector<SimSpiRecord> log    = getSimSpiLog();
+    BusTotals                 totals = busTotals(log);
+    CHECK(totals.windows == 240);
+    CHECK(totals.pixels == ROUND_VISIBLE_PIXELS);
+    CHECK(windowsFollowChords(log));
+}
+
+int main() {
+    beginSimDisplay();
+    setSimPanelRealTime(true);
+
+    fenceWaitsForQueuedBands();
+    chipSelectFollowsQueuedBands();
+    fenceWhileComposing();
+    frameSkipsCorners();
+    fillSkipsCorners();
+    return hostTestResult();
+}
@@ -0,0 +1,228 @@
+#include "HostTest.hpp"
+#include "SimArduino.hpp"
+
+#include "EspNowSensor.hpp"
+
+#include <cstring>
+#include <deque>
+#include <random>
+#include <utility>
+#include <vector>
+
+// The radio loops every frame back into the sensor that sent it, as if peer had sent it. On the
+// way it drops frames, delivers some twice and delays each by a random time, so they arrive out
+// of order, and it loses acknowledgements, so the sensor retransmits frames that did arrive.
+
+struct Channel {
+    uint32_t dropPercent;
+    uint32_t duplicatePercent;
+    uint32_t ackLossPercent;
+    uint32_t maxDelayMs;
+};
+
+struct Delivery {
+    unsigned long        at;
+    std::vector<uint8_t> frame;
+};
+
+struct Report {
+    unsigned long         at;
+    esp_now_send_status_t status;
+};
+
+static std::mt19937          rng(1);
+static Channel               channel      = {};
+static std::vector<Delivery> deliveries;
+static std::deque<Report>    reports; // In the order of the sends, as ESP-NOW reports them
+static esp_now_send_cb_t     sendCallback = nullptr;
+static esp_now_recv_cb_t     recvCallback = nullptr;
+
+static uint8_t peer[6] = {0x02, 0x00, 0x00, 0x00, 0x00, 0x01};
+
+static auto chance(uint32_t percent) -> bool {
+    return rng() % 100 < percent;
+}
+
+auto esp_now_init() -> esp_err_t {
+    return ESP_OK;
+}
+
+auto esp_now_register_send_cb(esp_now_send_cb_t cb) -> esp_err_t {
+    sendCallback = cb;
+    return ESP_OK;
+}
+
+auto esp_now_register_recv_cb(esp_now_recv_cb_t cb) -> esp_err_t {
+    recvCallback = cb;
+    return ESP_OK;
+}
+
+auto esp_now_is_peer_exist(const uint8_t *) -> bool {
+    return true;
+}
+
+auto esp_now_add_peer(const esp_now_peer_info_t *) -> esp_err_t {
+    return ESP_OK;
+}
+
+auto esp_now_send(const uint8_t *, const uint8_t *data, size_t len) -> esp_err_t {
+    bool arrives = !chance(channel.dropPercent);
+    if (arrives) {
+        int copies = chance(channel.duplicatePercent) ? 2 : 1;
+        for (int i = 0; i < copies; i++) {
+            unsigned long delay = 1 + (rng() % channel.maxDelayMs);
+            deliveries.push_back({millis() + delay, std::vector<uint8_t>(data, data + len)});
+        }
+    }
+    bool acknowledged = arrives && !chance(channel.ackLossPercent);
+    reports.push_back({millis() + 1, acknowledged ? ESP_NOW_SEND_SUCCESS : ESP_NOW_SEND_FAIL});
+    return ESP_OK;
+}
+
+static void receive(const uint8_t *source, const uint8_t *frame, size_t length) {
+    wifi_pkt_rx_ctrl_t  control = {};
+    esp_now_recv_info_t info    = {const_cast<uint8_t *>(source), peer, &control};
+    control.rssi                = -40;
+    recvCallback(&info, frame, length);
+}
+
+struct Message {
+    uint32_t id;
+};
+
+using Sensor = EspNowSensor<Message>;
+
+// Hands one frame with the given link byte to the receive callback, and returns whether it made
+// it through to Poll()
+static auto arrives(const uint8_t *source, uint8_t sequence) -> bool {
+    uint8_t frame[1 + sizeof(Message)] = {sequence};
+    receive(source, frame, sizeof(frame));
+
+    Message message;
+    uint8_t from[6];
+    int32_t rssi;
+    bool    polled = Sensor::Poll(&message, from, &rssi);
+    CHECK(!Sensor::Poll(&message, from, &rssi));
+    return polled;
+}
+
+// A late frame is accepted once, wherever it falls behind the newest one in the window
+static void windowKeepsLateFramesAndDropsRepeats() {
+    uint8_t source[6] = {0x02, 0x00, 0x00, 0x00, 0x00, 0x02};
+
+    CHECK(arrives(source, 10));
+    CHECK(arrives(source, 11));
+    CHECK(arrives(source, 12));
+    CHECK(!arrives(source, 12));
+    CHECK(!arrives(source, 11));
+    CHECK(!arrives(source, 10));
+
+    // 13 to 15 are overtaken by 16
+    CHECK(arrives(source, 16));
+    CHECK(arrives(source, 14));
+    CHECK(!arrives(source, 14));
+    CHECK(arrives(source, 13));
+    CHECK(arrives(source, 15));
+    CHECK(!arrives(source, 13));
+    CHECK(!arrives(source, 16));
+    CHECK(!arrives(source, 11));
+
+    // Across the wrap from 255 to 1
+    CHECK(arrives(source, 254));
+    CHECK(arrives(source, 1));
+    CHECK(arrives(source, 255));
+    CHECK(!arrives(source, 254));
+    CHECK(!arrives(source, 255));
+    CHECK(!arrives(source, 1));
+
+    // A peer silent for longer than the timeout starts over
+    advanceClock((ESPNOW_DEDUP_TIMEOUT_MS + 1) * 1000);
+    CHECK(arrives(source, 1));
+    CHECK(!arrives(source, 1));
+}
+
+// Per message id: whether a copy reached the receiver, and how often Poll() returned it
+struct Tally {
+    std::vector<bool>     reached;
+    std::vector<uint32_t> received;
+};
+
+// Delivers the frames and send reports that are due, then empties the receive ring
+static void tick(Tally &tally) {
+    advanceClock(1000);
+    unsigned long now = millis();
+
+    for (size_t i = 0; i < deliveries.size();) {
+        if (deliveries[i].at > now) {
+            i++;
+            continue;
+        }
+        Message sent;
+        memcpy(&sent, deliveries[i].frame.data() + 1, sizeof(sent));
+        tally.reached[sent.id] = true;
+        receive(peer, deliveries[i].frame.data(), deliveries[i].frame.size());
+        deliveries[i] = std::move(deliveries.back());
+        deliveries.pop_back();
+    }
+    while (!reports.empty() && reports.front().at <= now) {
+        wifi_tx_info_t info = {};
+        sendCallback(&info, reports.front().status);
+        reports.pop_front();
+    }
+
+    Message message;
+    uint8_t source[6];
+    int32_t rssi;
+    while (Sensor::Poll(&message, source, &rssi)) {
+        tally.received[message.id]++;
+    }
+}
+
+// Bursts of unicast frames over a lossy channel. Each burst is settled before the next one, so
+// retransmissions stay within the duplicate window. A frame that reached the receiver is passed
+// on exactly once, however often and in whatever order its copies arrived.
+static void lossyLink(const Channel &lossy, uint32_t bursts) {
+    constexpr uint32_t BURST = 6;
+    static_assert(BURST <= ESPNOW_SEND_POOL_SIZE, "A burst must fit in the send pool");
+
+    channel                  = lossy;
+    uint32_t duplicatesStart = Sensor::GetReceiveDuplicates();
+    uint32_t count           = bursts * BURST;
+
+    Tally tally = {std::vector<bool>(count, false), std::vector<uint32_t>(count, 0)};
+    for (uint32_t burst = 0; burst < bursts; burst++) {
+        for (uint32_t i = 0; i < BURST; i++) {
+            CHECK(Sensor::Send({(burst * BURST) + i}, peer) == SendResult::SENT);
+        }
+        while (Sensor::GetSendPoolStats().inFlight > 0 || !deliveries.empty()) {
+            tick(tally);
+        }
+    }
+
+    uint32_t duplicated = 0;
+    uint32_t missed     = 0;
+    uint32_t lost       = 0;
+    for (uint32_t id = 0; id < count; id++) {
+        duplicated += tally.received[id] > 1 ? 1 : 0;
+        missed += tally.reached[id] && tally.received[id] == 0 ? 1 : 0;
+        lost += tally.reached[id] ? 0 : 1;
+    }
+    uint32_t duplicatesDropped = Sensor::GetReceiveDuplicates() - duplicatesStart;
+
+    CHECK(duplicated == 0);
+    CHECK(missed == 0);
+    CHECK(duplicatesDropped > 0);
+    CHECK(Sensor::GetReceiveDrops() == 0);
+    printf("drop %u%%, duplicate %u%%, ack loss %u%%: %u frames, %u lost on every attempt, %u "
+           "duplicates dropped\n",
+           lossy.dropPercent, lossy.duplicatePercent, lossy.ackLossPercent, count, lost,
+           duplicatesDropped);
+}
+
+int main() {
+    Sensor::Init();
+    windowKeepsLateFramesAndDropsRepeats();
+    lossyLink({10, 10, 10, 5}, 2000);
+    lossyLink({30, 30, 30, 20}, 2000);
+    return hostTestResult();
+}
@@ -0,0 +1,282 @@
+#include "HostTest.hpp"
+#include "SimArduino.hpp"
+
+#include "EspNowSensor.hpp"
+
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <vector>
+
+// Counts every heap allocation of the process, so a test can check that a code path makes none.
+// operator new is replaced to make sure it goes through malloc(), which glibc lets a program
+// replace.
+static uint64_t allocations = 0;
+
+#ifdef __GLIBC__
+extern "C" auto __libc_malloc(size_t size) -> void *;
+
+extern "C" auto malloc(size_t size) -> void * {
+    allocations++;
+    return __libc_malloc(size);
+}
+#endif
+
+auto operator new(size_t size) -> void * {
+    void *memory = std::malloc(size == 0 ? 1 : size);
+    if (memory == nullptr) {
+        std::abort(); // No exceptions in this build
+    }
+    return memory;
+}
+
+auto operator new[](size_t size) -> void * {
+    return operator new(size);
+}
+
+void operator delete(void *memory) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void *memory, size_t) noexcept {
+    std::free(memory);
+}
+
+void operator delete[](void *memory) noexcept {
+    std::free(memory);
+}
+
+void operator delete[](void *memory, size_t) noexcept {
+    std::free(memory);
+}
+
+// The radio: esp_now_send() queues each frame and the test decides when the send callback
+// reports on it, in the order the frames were sent, as ESP-NOW does. The frames are kept in a
+// vector, which stops allocating once it has grown to the most frames in flight.
+
+struct SentFrame {
+    uint8_t target[6];
+    uint8_t link; // Link byte, the sequence number of a unicast frame
+};
+
+static std::vector<SentFrame> sentFrames;
+static esp_now_send_cb_t      sendCallback = nullptr;
+static bool                   refuseSends  = false;
+
+auto esp_now_init() -> esp_err_t {
+    return ESP_OK;
+}
+
+auto esp_now_register_send_cb(esp_now_send_cb_t cb) -> esp_err_t {
+    sendCallback = cb;
+    return ESP_OK;
+}
+
+auto esp_now_register_recv_cb(esp_now_recv_cb_t) -> esp_err_t {
+    return ESP_OK;
+}
+
+auto esp_now_is_peer_exist(const uint8_t *) -> bool {
+    return true;
+}
+
+auto esp_now_add_peer(const esp_now_peer_info_t *) -> esp_err_t {
+    return ESP_OK;
+}
+
+auto esp_now_send(const uint8_t *peer_addr, const uint8_t *data, size_t) -> esp_err_t {
+    if (refuseSends) {
+        return ESP_FAIL;
+    }
+    SentFrame frame;
+    memcpy(frame.target, peer_addr, 6);
+    frame.link = data[0];
+    sentFrames.push_back(frame);
+    return ESP_OK;
+}
+
+// Reports on the oldest frames still waiting for their send callback
+static void report(size_t frames, esp_now_send_status_t status) {
+    for (size_t i = 0; i < frames && !sentFrames.empty(); i++) {
+        sentFrames.erase(sentFrames.begin());
+        wifi_tx_info_t info = {};
+        sendCallback(&info, status);
+    }
+}
+
+struct Message {
+    uint8_t value;
+};
+
+using Sensor = EspNowSensor<Message>;
+
+static uint8_t broadcast[6] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+static uint8_t peer[6]      = {0x02, 0x00, 0x00, 0x00, 0x00, 0x01};
+
+// Lets the sensor reclaim reports and retransmit, as the main loop does
+static void pollOnce() {
+    Message message;
+    uint8_t source[6];
+    int32_t rssi;
+    while (Sensor::Poll(&message, source, &rssi)) {
+    }
+}
+
+static void exhaustAndReclaim() {
+    SendPoolStats before = Sensor::GetSendPoolStats();
+
+    for (uint8_t i = 0; i < ESPNOW_SEND_POOL_SIZE; i++) {
+        CHECK(Sensor::Send({i}, broadcast) == SendResult::SENT);
+    }
+    // Nothing reported yet, so every slot is in flight
+    CHECK(Sensor::Send({0}, broadcast) == SendResult::WOULD_BLOCK);
+    CHECK(Sensor::Send({0}, broadcast) == SendResult::WOULD_BLOCK);
+
+    SendPoolStats full = Sensor::GetSendPoolStats();
+    CHECK(full.inFlight == ESPNOW_SEND_POOL_SIZE);
+    CHECK(full.highWater == ESPNOW_SEND_POOL_SIZE);
+    CHECK(full.wouldBlock == before.wouldBlock + 2);
+    CHECK(full.frames == before.frames + ESPNOW_SEND_POOL_SIZE);
+
+    // Three reports free three slots on the next send; a failed broadcast is not retried
+    report(2, ESP_NOW_SEND_SUCCESS);
+    report(1, ESP_NOW_SEND_FAIL);
+    CHECK(Sensor::Send({0}, broadcast) == SendResult::SENT);
+    SendPoolStats reclaimed = Sensor::GetSendPoolStats();
+    CHECK(reclaimed.inFlight == ESPNOW_SEND_POOL_SIZE - 2);
+    CHECK(reclaimed.delivered == before.delivered + 2);
+    CHECK(reclaimed.failed == before.failed + 1);
+
+    // Every report in, every slot free again and every send accounted for
+    report(sentFrames.size(), ESP_NOW_SEND_SUCCESS);
+    pollOnce();
+    SendPoolStats drained = Sensor::GetSendPoolStats();
+    CHECK(drained.inFlight == 0);
+    CHECK(drained.delivered + drained.failed - before.delivered - before.failed
+          == ESPNOW_SEND_POOL_SIZE + 1);
+    CHECK(sentFrames.empty());
+}
+
+// A send the radio refuses fails at once and keeps no slot
+static void refusedSendKeepsNoSlot() {
+    SendPoolStats before = Sensor::GetSendPoolStats();
+
+    refuseSends = true;
+    CHECK(Sensor::Send({1}, peer) == SendResult::FAILED);
+    refuseSends = false;
+
+    SendPoolStats after = Sensor::GetSendPoolStats();
+    CHECK(after.inFlight == 0);
+    CHECK(after.failed == before.failed + 1);
+    CHECK(after.frames == before.frames);
+    for (uint8_t i = 0; i < ESPNOW_SEND_POOL_SIZE; i++) {
+        CHECK(Sensor::Send({i}, peer) == SendResult::SENT);
+    }
+    report(sentFrames.size(), ESP_NOW_SEND_SUCCESS);
+    pollOnce();
+    CHECK(Sensor::GetSendPoolStats().inFlight == 0);
+}
+
+// A unicast frame reported as failed keeps its slot and goes out again with the same sequence
+// number, after ESPNOW_RETRY_BASE_MS and then twice as long, until ESPNOW_MAX_RETRIES
+static void failedUnicastIsRetried() {
+    SendPoolStats before = Sensor::GetSendPoolStats();
+
+    CHECK(Sensor::Send({2}, peer) == SendResult::SENT);
+    CHECK(sentFrames.size() == 1);
+    uint8_t sequence = sentFrames.front().link;
+    CHECK(sequence != ESPNOW_UNSEQUENCED);
+
+    unsigned long wait = ESPNOW_RETRY_BASE_MS;
+    for (uint8_t retry = 0; retry < ESPNOW_MAX_RETRIES; retry++) {
+        report(1, ESP_NOW_SEND_FAIL);
+        pollOnce();
+        CHECK(sentFrames.empty());
+        CHECK(Sensor::GetSendPoolStats().inFlight == 1);
+
+        advanceClock((wait - 1) * 1000);
+        pollOnce();
+        CHECK(sentFrames.empty());
+        advanceClock(1000);
+        pollOnce();
+        CHECK(sentFrames.size() == 1 && sentFrames.front().link == sequence);
+        wait *= 2;
+    }
+
+    // The last retry failing too gives up on the frame
+    report(1, ESP_NOW_SEND_FAIL);
+    pollOnce();
+    SendPoolStats after = Sensor::GetSendPoolStats();
+    CHECK(after.inFlight == 0);
+    CHECK(after.failed == before.failed + 1);
+    CHECK(after.retransmits == before.retransmits + ESPNOW_MAX_RETRIES);
+    CHECK(after.frames == before.frames + 1 + ESPNOW_MAX_RETRIES);
+}
+
+// A report that arrives with no frame in flight is not thrown away; it is matched with the next
+// frame sent
+static void unmatchedReportIsKept() {
+    SendPoolStats before = Sensor::GetSendPoolStats();
+
+    wifi_tx_info_t info = {};
+    sendCallback(&info, ESP_NOW_SEND_SUCCESS);
+    pollOnce();
+    CHECK(Sensor::GetSendPoolStats().delivered == before.delivered);
+
+    CHECK(Sensor::Send({3}, broadcast) == SendResult::SENT);
+    sentFrames.clear(); // Already reported on
+    pollOnce();
+    SendPoolStats after = Sensor::GetSendPoolStats();
+    CHECK(after.inFlight == 0);
+    CHECK(after.delivered == before.delivered + 1);
+}
+
+// A million sends, broadcast and unicast, every eighth unicast failing once and retransmitted,
+// make no heap allocation and leave the pool empty
+static void sendsDoNotAllocate() {
+    constexpr uint32_t CYCLES = 1000000;
+
+    auto cycle = [](uint32_t i) {
+        bool unicast = i % 2 == 0;
+        CHECK(Sensor::Send({static_cast<uint8_t>(i)}, unicast ? peer : broadcast)
+              == SendResult::SENT);
+        report(1, unicast && i % 16 == 0 ? ESP_NOW_SEND_FAIL : ESP_NOW_SEND_SUCCESS);
+        pollOnce();
+        if (Sensor::GetSendPoolStats().inFlight > 0) {
+            advanceClock(ESPNOW_RETRY_BASE_MS * 1000);
+            pollOnce();
+            report(1, ESP_NOW_SEND_SUCCESS);
+            pollOnce();
+        }
+    };
+
+    // Lets the radio's frame log grow to its size first
+    cycle(0);
+    cycle(1);
+
+    SendPoolStats before = Sensor::GetSendPoolStats();
+    uint64_t      start  = allocations;
+    for (uint32_t i = 0; i < CYCLES; i++) {
+        cycle(i);
+    }
+    uint64_t      made  = allocations - start;
+    SendPoolStats after = Sensor::GetSendPoolStats();
+
+    CHECK(made == 0);
+    CHECK(after.inFlight == 0);
+    CHECK(after.delivered - before.delivered == CYCLES);
+    CHECK(after.retransmits - before.retransmits == CYCLES / 16);
+    CHECK(sentFrames.empty());
+    printf("%u sends, %u retransmits: %llu heap allocations, high water %u\n", CYCLES,
+           after.retransmits - before.retransmits, (unsigned long long)made, after.highWater);
+}
+
+int main() {
+    Sensor::Init();
+    exhaustAndReclaim();
+    refusedSendKeepsNoSlot();
+    failedUnicastIsRetried();
+    unmatchedReportIsKept();
+    sendsDoNotAllocate();
+    return hostTestResult();
+}
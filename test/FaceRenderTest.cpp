@@ -0,0 +1,224 @@
+#include "HostTest.hpp"
+#include "SimDisplay.hpp"
+
+#include "FaceSprites.hpp"
+#include "RenderTarget.hpp"
+#include "RoundDisplay.hpp"
+#include "ScreenDeterminator.hpp"
+#include "ScreenStateDefs.hpp"
+#include "Screenfunctions.hpp"
+
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+// Every screen state drawn into a MemoryTarget and compared with the checksums of the faces this
+// tree draws. A change that is meant to alter a face updates its checksum, which
+// `FaceRenderTest --print` prints. The host fonts have no glyphs (see stubs/Adafruit_GFX.h), so
+// the text faces are checked for everything but their text.
+
+struct GoldenFace {
+    ScreenStates state;
+    const char  *name;
+    uint32_t     checksum; // FNV-1a over the frame, see checksum()
+};
+
+constexpr std::array<GoldenFace, 18> GOLDEN_FACES = {{
+  {ScreenStates::GODDICE, "GODDICE", 0x3B1BF8EE},
+  {ScreenStates::WELCOME, "WELCOME", 0xE89205C5},
+  {ScreenStates::QLAB_LOGO, "QLAB_LOGO", 0x186A5D6F},
+  {ScreenStates::QRCODE, "QRCODE", 0x23903E2D},
+  {ScreenStates::UT_LOGO, "UT_LOGO", 0x109DD422},
+  {ScreenStates::N1, "N1", 0x26CE736B},
+  {ScreenStates::N2, "N2", 0x8A006311},
+  {ScreenStates::N3, "N3", 0x61C85EB7},
+  {ScreenStates::N4, "N4", 0x05B0EC5D},
+  {ScreenStates::N5, "N5", 0x492D8E03},
+  {ScreenStates::N6, "N6", 0xC55A49A9},
+  {ScreenStates::MIX1TO6, "MIX1TO6", 0x2BFBF93C},
+  {ScreenStates::MIX1TO6_ENTANGLED, "MIX1TO6_ENTANGLED", 0x522B6426},
+  {ScreenStates::ENTANGLED, "ENTANGLED", 0x41E2673D},
+  {ScreenStates::LOWBATTERY, "LOWBATTERY", 0xE89205C5},
+  {ScreenStates::BLANC, "BLANC", 0xE89205C5},
+  {ScreenStates::DIAGNOSE, "DIAGNOSE", 0xE89205C5},
+  {ScreenStates::RESET, "RESET", 0x2D18B76F},
+}};
+
+// Draws of one face averaged for its time
+constexpr int TIMED_DRAWS = 20;
+
+// The frame of every golden face, once its checksum matched
+static std::array<std::vector<uint16_t>, GOLDEN_FACES.size()> goldenFrames;
+
+static auto checksum(const uint16_t *frame) -> uint32_t {
+    uint32_t hash = 2166136261U;
+    for (uint32_t i = 0; i < (uint32_t)WIDTH * HEIGHT; i++) {
+        hash = (hash ^ (frame[i] & 0xFF)) * 16777619U;
+        hash = (hash ^ (frame[i] >> 8)) * 16777619U;
+    }
+    return hash;
+}
+
+static auto goldenFrame(ScreenStates state) -> const std::vector<uint16_t> & {
+    static const std::vector<uint16_t> none;
+    for (size_t index = 0; index < GOLDEN_FACES.size(); index++) {
+        if (GOLDEN_FACES[index].state == state) {
+            return goldenFrames[index];
+        }
+    }
+    return none;
+}
+
+static auto sameFrame(const uint16_t *frame, const std::vector<uint16_t> &golden) -> bool {
+    return golden.size() == (size_t)WIDTH * HEIGHT
+           && memcmp(frame, golden.data(), golden.size() * sizeof(uint16_t)) == 0;
+}
+
+// Compares the visible circle only, which is all that MemoryTarget and the panels keep
+static auto sameVisiblePixels(const uint16_t *a, const uint16_t *b) -> bool {
+    for (uint16_t y = 0; y < HEIGHT; y++) {
+        const ScanlineChord &chord  = ROUND_CHORDS[y];
+        const uint32_t       offset = (y * WIDTH) + chord.start;
+        if (memcmp(a + offset, b + offset, chord.width * sizeof(uint16_t)) != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void showEverywhere(ScreenStates state) {
+    checkAndCallFunctions(state, state, state, state, state, state);
+}
+
+// Every face the same state, all six frames as checked in; then the wall time of redrawing X0
+// alone, which is what the state costs per face
+static void goldenFaces(const MemoryTarget &target, bool print) {
+    for (size_t index = 0; index < GOLDEN_FACES.size(); index++) {
+        const GoldenFace &golden = GOLDEN_FACES[index];
+        showEverywhere(golden.state);
+        uint32_t drawn = checksum(target.frame(0));
+        for (uint8_t face = 0; face < RENDER_FACES; face++) {
+            CHECK(checksum(target.frame(face)) == golden.checksum);
+        }
+        if (drawn == golden.checksum) {
+            goldenFrames[index].assign(target.frame(0), target.frame(0) + (WIDTH * HEIGHT));
+        }
+
+        ScreenStates other = golden.state == ScreenStates::BLANC ? ScreenStates::N1
+                                                                 : ScreenStates::BLANC;
+        std::chrono::nanoseconds elapsed(0);
+        for (int draw = 0; draw < TIMED_DRAWS; draw++) {
+            checkAndCallFunctions(other, golden.state, golden.state, golden.state, golden.state,
+                                  golden.state);
+            auto start = std::chrono::steady_clock::now();
+            showEverywhere(golden.state);
+            elapsed += std::chrono::steady_clock::now() - start;
+        }
+        CHECK(sameFrame(target.frame(0), goldenFrames[index]));
+
+        if (print) {
+            printf("  {ScreenStates::%s, \"%s\", 0x%08X},\n", golden.name, golden.name,
+                   (unsigned)drawn);
+        } else {
+            printf("%-18s %7.1f us per face\n", golden.name,
+                   elapsed.count() / 1000.0 / TIMED_DRAWS);
+        }
+    }
+}
+
+// commitScreens() for every state, number and up side draws on each face the golden face of what
+// determineScreens() asks for
+static void everyStateMatchesGolden(const MemoryTarget &target) {
+    FaceRedrawStats before = getFaceRedrawStats();
+    uint32_t        states = 0;
+    for (uint8_t mode = 0; mode <= static_cast<uint8_t>(Mode::LOW_BATTERY); mode++) {
+        for (uint8_t throwState = 0; throwState <= static_cast<uint8_t>(ThrowState::OBSERVED);
+             throwState++) {
+            for (uint8_t entanglement = 0;
+                 entanglement <= static_cast<uint8_t>(EntanglementState::TELEPORTED);
+                 entanglement++) {
+                for (uint8_t number = 0; number <= static_cast<uint8_t>(DiceNumbers::SIX);
+                     number++) {
+                    for (uint8_t upSide = 0; upSide <= static_cast<uint8_t>(UpSide::NA);
+                         upSide++) {
+                        stateSelf      = {static_cast<Mode>(mode),
+                                          static_cast<ThrowState>(throwState),
+                                          static_cast<EntanglementState>(entanglement)};
+                        diceNumberSelf = static_cast<DiceNumbers>(number);
+                        upSideSelf     = static_cast<UpSide>(upSide);
+                        refreshScreens();
+                        commitScreens();
+
+                        ScreenConfiguration config =
+                          determineScreens(stateSelf, diceNumberSelf, upSideSelf);
+                        std::array<ScreenStates, RENDER_FACES> expected = {
+                          config.x0, config.x1, config.y0, config.y1, config.z0, config.z1};
+                        for (uint8_t face = 0; face < RENDER_FACES; face++) {
+                            CHECK(sameFrame(target.frame(face), goldenFrame(expected[face])));
+                        }
+                        states++;
+                    }
+                }
+            }
+        }
+    }
+    FaceRedrawStats after = getFaceRedrawStats();
+    printf("%lu states: %lu faces drawn, %lu unchanged\n", (unsigned long)states,
+           (unsigned long)(after.performed - before.performed),
+           (unsigned long)(after.skipped - before.skipped));
+}
+
+// With the colours hidden, an entangled die shows the entanglement glyph in its colour while the
+// colour flashes, then the entangled superposition in white
+static void entanglementFlash(const MemoryTarget &target) {
+    showColors     = false;
+    flashColor     = true;
+    stateSelf      = {Mode::QUANTUM, ThrowState::IDLE, EntanglementState::ENTANGLED};
+    diceNumberSelf = DiceNumbers::NONE;
+    upSideSelf     = UpSide::NONE;
+    refreshScreens();
+    commitScreens();
+    for (uint8_t face = 0; face < RENDER_FACES; face++) {
+        CHECK(sameFrame(target.frame(face), goldenFrame(ScreenStates::ENTANGLED)));
+    }
+
+    flashColor = false;
+    refreshScreens();
+    commitScreens();
+    const uint16_t *white =
+      getFaceSprite(FaceSprite::MIX1TO6_ENTANGLED, GC9A01A_WHITE, GC9A01A_BLACK);
+    for (uint8_t face = 0; face < RENDER_FACES; face++) {
+        CHECK(white != nullptr && sameVisiblePixels(target.frame(face), white));
+    }
+    showColors = true;
+}
+
+// The cached sprites and the direct drawing used without PSRAM give the same faces
+static void spritesMatchDirectDrawing(MemoryTarget &target) {
+    for (uint8_t sprite = 0; sprite <= static_cast<uint8_t>(FaceSprite::MIX1TO6_ENTANGLED);
+         sprite++) {
+        target.select(X0);
+        drawFaceDirect(target, static_cast<FaceSprite>(sprite), entanglement_color_self,
+                       GC9A01A_BLACK);
+        const uint16_t *cached =
+          getFaceSprite(static_cast<FaceSprite>(sprite), entanglement_color_self, GC9A01A_BLACK);
+        CHECK(cached != nullptr && sameVisiblePixels(cached, target.frame(0)));
+    }
+}
+
+int main(int argc, char **argv) {
+    bool print = argc > 1 && strcmp(argv[1], "--print") == 0;
+
+    beginSimDisplay();
+    static MemoryTarget target;
+    CHECK(target.begin());
+    setRenderTarget(target);
+
+    goldenFaces(target, print);
+    everyStateMatchesGolden(target);
+    entanglementFlash(target);
+    spritesMatchDirectDrawing(target);
+    return hostTestResult();
+}
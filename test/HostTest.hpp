@@ -0,0 +1,34 @@
+#ifndef HOSTTEST_H_
+#define HOSTTEST_H_
+
+#include <cstdio>
+
+/*
+   HostTest - checks for the host tests in this directory
+
+   A failed CHECK() prints where it failed and the test carries on, so one run shows every
+   failure. main() returns hostTestResult().
+*/
+
+inline int hostTestFailures = 0;
+
+#define CHECK(condition)                                                                          \
+    do {                                                                                          \
+        if (!(condition)) {                                                                       \
+            hostTestFailures++;                                                                   \
+            if (hostTestFailures <= 20) {                                                         \
+                printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #condition);             \
+            }                                                                                     \
+        }                                                                                         \
+    } while (0)
+
+inline auto hostTestResult() -> int {
+    if (hostTestFailures != 0) {
+        printf("%d checks failed\n", hostTestFailures);
+        return 1;
+    }
+    printf("All checks passed\n");
+    return 0;
+}
+
+#endif /* HOSTTEST_H_ */
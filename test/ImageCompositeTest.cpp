@@ -0,0 +1,144 @@
+#include "HostTest.hpp"
+#include "SimDisplay.hpp"
+
+#include "ImageAsset.hpp"
+#include "ImageLibrary/ImageLibrary.hpp"
+#include "RenderTarget.hpp"
+#include "RoundDisplay.hpp"
+#include "Screenfunctions.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+// displayImageWithBackground() against the two-pass composite it replaced, for every built-in
+// image, with the wall time of a frame of each. The two-pass composite is kept unchanged below:
+// it drew the flash image into a 240x240 canvas pixel by pixel, then read that canvas back into a
+// second one over the background. Its input is the image decoded in advance, as the flash arrays
+// of that code were raw. The single pass streams bands through ImageDecoder into a MemoryTarget,
+// so its time includes the decoding.
+
+constexpr int TIMED_FRAMES = 50;
+
+// The part of GFXcanvas16 the two-pass composite used
+class Canvas16 : public Adafruit_GFX {
+  public:
+    Canvas16() : Adafruit_GFX(WIDTH, HEIGHT), buffer((size_t)WIDTH * HEIGHT) {}
+
+    void drawPixel(int16_t x, int16_t y, uint16_t color) override {
+        if (x < 0 || y < 0 || x >= _width || y >= _height) {
+            return;
+        }
+        buffer[x + (y * WIDTH)] = color;
+    }
+
+    void fillScreen(uint16_t color) override {
+        std::fill(buffer.begin(), buffer.end(), color);
+    }
+
+    auto getPixel(int16_t x, int16_t y) const -> uint16_t {
+        if (x < 0 || y < 0 || x >= _width || y >= _height) {
+            return 0;
+        }
+        return buffer[x + (y * WIDTH)];
+    }
+
+    auto pixels() const -> const uint16_t * {
+        return buffer.data();
+    }
+
+  private:
+    std::vector<uint16_t> buffer;
+};
+
+static Canvas16 imageCanvas;
+static Canvas16 backgroundCanvas;
+
+static void twoPassComposite(const uint16_t *image, uint16_t backgroundColor) {
+    backgroundCanvas.fillScreen(backgroundColor);
+    imageCanvas.fillScreen(0x0000); // Transparent black
+
+    for (int y = 0; y < HEIGHT; y++) {
+        for (int x = 0; x < WIDTH; x++) {
+            uint16_t pixelColor = image[(y * WIDTH) + x];
+            if (pixelColor != 0x0000) {
+                imageCanvas.drawPixel(x, y, pixelColor);
+            }
+        }
+    }
+
+    for (int y = 0; y < HEIGHT; y++) {
+        for (int x = 0; x < WIDTH; x++) {
+            uint16_t imagePixel = imageCanvas.getPixel(x, y);
+            if (imagePixel != 0x0000) {
+                backgroundCanvas.drawPixel(x, y, imagePixel);
+            }
+        }
+    }
+}
+
+// Compares the visible circle only, which is all that MemoryTarget and the panels keep
+static auto sameVisiblePixels(const uint16_t *a, const uint16_t *b) -> bool {
+    for (uint16_t y = 0; y < HEIGHT; y++) {
+        const ScanlineChord &chord  = ROUND_CHORDS[y];
+        const uint32_t       offset = (y * WIDTH) + chord.start;
+        if (memcmp(a + offset, b + offset, chord.width * sizeof(uint16_t)) != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename Draw>
+static auto microsPerFrame(Draw draw) -> double {
+    auto start = std::chrono::steady_clock::now();
+    for (int frame = 0; frame < TIMED_FRAMES; frame++) {
+        draw();
+    }
+    std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count() / TIMED_FRAMES;
+}
+
+static void compositeLibrary(MemoryTarget &target) {
+    struct NamedImage {
+        const char       *name;
+        const ImageAsset *image;
+    };
+    const NamedImage images[] = {{"entangled", &entangled},
+                                 {"God_does_not_play_dice", &God_does_not_play_dice},
+                                 {"low_battery", &low_battery},
+                                 {"new_die", &new_die},
+                                 {"quantum_labs_twente_RGB", &quantum_labs_twente_RGB},
+                                 {"UTwente_logo", &UTwente_logo}};
+
+    double twoPassTotal    = 0;
+    double singlePassTotal = 0;
+    for (const NamedImage &named : images) {
+        const ImageAsset     &image = *named.image;
+        std::vector<uint16_t> raw((size_t)WIDTH * HEIGHT);
+        ImageDecoder          decoder(image, 0x0000);
+        CHECK(decoder.decodeRows(raw.data(), HEIGHT));
+
+        double twoPass    = microsPerFrame([&] { twoPassComposite(raw.data(), 0x0000); });
+        double singlePass = microsPerFrame([&] { displayImageWithBackground(image, X0); });
+        CHECK(sameVisiblePixels(target.frame(0), backgroundCanvas.pixels()));
+
+        printf("%-24s %7.1f us two-pass, %7.1f us single pass\n", named.name, twoPass,
+               singlePass);
+        twoPassTotal    += twoPass;
+        singlePassTotal += singlePass;
+    }
+    printf("%-24s %7.1f us two-pass, %7.1f us single pass\n", "Total", twoPassTotal,
+           singlePassTotal);
+}
+
+int main() {
+    beginSimDisplay();
+    static MemoryTarget target;
+    CHECK(target.begin());
+    setRenderTarget(target);
+
+    compositeLibrary(target);
+    return hostTestResult();
+}
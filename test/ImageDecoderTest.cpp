@@ -0,0 +1,136 @@
+#include "HostTest.hpp"
+
+#include "ImageAsset.hpp"
+#include "ImageLibrary/ImageLibrary.hpp"
+#include "Rgb565.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+constexpr uint16_t BACKGROUND = 0xBBBB;
+constexpr uint16_t FOREGROUND = 0xF800;
+
+// Decodes a whole asset, rows at a time, and returns whether the data lasted
+static auto decode(const ImageAsset &asset, uint16_t rows, std::vector<uint16_t> &pixels,
+                   uint16_t foreground = FOREGROUND) -> bool {
+    ImageDecoder decoder(asset, BACKGROUND, foreground);
+    pixels.assign(asset.width * asset.height, 0);
+    bool complete = true;
+    for (uint16_t top = 0; top < asset.height; top += rows) {
+        complete = decoder.decodeRows(&pixels[top * asset.width], rows) && complete;
+    }
+    return complete;
+}
+
+static auto matches(const ImageAsset &asset, const std::vector<uint16_t> &expected) -> bool {
+    // One row at a time and the whole image at once, so runs cross the band boundaries
+    for (uint16_t rows : {static_cast<uint16_t>(1), asset.height}) {
+        std::vector<uint16_t> pixels;
+        if (!decode(asset, rows, pixels) || pixels != expected) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Transparent, single-colour and literal runs, crossing rows; a palette index past the end
+// shows the background
+static void runTokens() {
+    static const uint16_t palette[] = {0x1111, 0x2222};
+    static const uint8_t  data[]    = {
+      0x02,                   // 3 transparent
+      0x43, 0x01,             // 4 of palette[1]
+      0x82, 0x00, 0x01, 0x05, // 3 literal
+      0x01,                   // 2 transparent
+    };
+    ImageAsset asset = {4, 3, ImageFormat::RLE_INDEXED, 0, 0, palette, 2, data, sizeof(data)};
+
+    CHECK(matches(asset, {BACKGROUND, BACKGROUND, BACKGROUND, 0x2222, //
+                          0x2222, 0x2222, 0x2222, 0x1111,             //
+                          0x2222, BACKGROUND, BACKGROUND, BACKGROUND}));
+}
+
+// Little-endian RGB565 colours in place of palette indices
+static void directColors() {
+    static const uint8_t data[] = {
+      0x41, 0x34, 0x12,             // 2 of 0x1234
+      0x81, 0xCD, 0xAB, 0x00, 0xF8, // 2 literal
+    };
+    ImageAsset asset = {2, 2, ImageFormat::RLE_DIRECT, 0, 0, nullptr, 0, data, sizeof(data)};
+
+    CHECK(matches(asset, {0x1234, 0x1234, 0xABCD, 0xF800}));
+}
+
+// Pixels in the transparent key colour show the background
+static void rawPixels() {
+    static const uint8_t data[] = {0x34, 0x12, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00};
+    ImageAsset asset = {2, 2, ImageFormat::RAW, 0x0000, 0, nullptr, 0, data, sizeof(data)};
+
+    CHECK(matches(asset, {0x1234, BACKGROUND, 0xFFFF, BACKGROUND}));
+}
+
+// Mask pixels are the foreground blended over the background at their coverage level
+static void masks() {
+    static const uint8_t oneBit[] = {0b10010000};
+    ImageAsset mask1 = {4, 2, ImageFormat::MASK_1BPP, 0, 0xFFFF, nullptr, 0, oneBit, 1};
+    CHECK(matches(mask1, {FOREGROUND, BACKGROUND, BACKGROUND, FOREGROUND, //
+                          BACKGROUND, BACKGROUND, BACKGROUND, BACKGROUND}));
+
+    static const uint16_t levels[] = {0, 8, 16, RGB565_ALPHA_ONE};
+    uint16_t              quarter  = blendRgb565(FOREGROUND, BACKGROUND, 8);
+    uint16_t              half     = blendRgb565(FOREGROUND, BACKGROUND, 16);
+
+    static const uint8_t twoBits[] = {0b00011011};
+    ImageAsset mask2 = {2, 2, ImageFormat::MASK_2BPP, 0, 0xFFFF, levels, 4, twoBits, 1};
+    CHECK(matches(mask2, {BACKGROUND, quarter, half, FOREGROUND}));
+
+    static const uint8_t runs[] = {0x41, 0x02, 0x81, 0x03, 0x07};
+    ImageAsset rleMask = {2, 2, ImageFormat::RLE_MASK, 0, 0xFFFF, levels, 4, runs, sizeof(runs)};
+    CHECK(matches(rleMask, {half, half, FOREGROUND, BACKGROUND}));
+
+    // Without a colour from the caller the asset's own foreground is used
+    std::vector<uint16_t> pixels;
+    CHECK(decode(mask1, 2, pixels, mask1.foreground) && pixels[0] == 0xFFFF);
+}
+
+// Data that runs out early is reported, and the rest of the image is the background
+static void truncatedData() {
+    static const uint16_t palette[] = {0x1111};
+    static const uint8_t  data[]    = {0x42, 0x00, 0x81, 0x00};
+    ImageAsset asset = {3, 2, ImageFormat::RLE_INDEXED, 0, 0, palette, 1, data, sizeof(data)};
+
+    std::vector<uint16_t> pixels;
+    CHECK(!decode(asset, 2, pixels));
+    CHECK(pixels == std::vector<uint16_t>({0x1111, 0x1111, 0x1111, 0x1111, BACKGROUND,
+                                           BACKGROUND}));
+}
+
+// Every built-in image decodes to its full size in bands and row by row alike, and its data
+// ends exactly at the last pixel
+static void library() {
+    const ImageAsset *images[] = {&entangled, &God_does_not_play_dice, &low_battery,
+                                  &new_die,   &quantum_labs_twente_RGB, &UTwente_logo};
+    for (const ImageAsset *image : images) {
+        std::vector<uint16_t> banded;
+        std::vector<uint16_t> rowByRow;
+        CHECK(decode(*image, 16, banded)); // The band height of displayImageWithBackground()
+        CHECK(decode(*image, 1, rowByRow));
+        CHECK(banded == rowByRow);
+
+        ImageDecoder decoder(*image, BACKGROUND, FOREGROUND);
+        std::vector<uint16_t> pixels(image->width * image->height);
+        CHECK(decoder.decodeRows(pixels.data(), image->height));
+        CHECK(!decoder.decodeRows(pixels.data(), 1));
+    }
+}
+
+int main() {
+    runTokens();
+    directColors();
+    rawPixels();
+    masks();
+    truncatedData();
+    library();
+    return hostTestResult();
+}
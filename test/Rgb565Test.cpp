@@ -0,0 +1,97 @@
+#include "HostTest.hpp"
+#include "Rgb565.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+
+// The float blend that blendRgb565() replaced, truncating each channel
+static auto blendChannel(uint8_t foreground, uint8_t background, float alpha) -> uint8_t {
+    return (foreground * alpha) + (background * (1 - alpha));
+}
+
+static auto blendFloat(uint16_t foreground, uint16_t background, float alpha) -> uint16_t {
+    uint8_t r = blendChannel((foreground >> 11) & 0x1F, (background >> 11) & 0x1F, alpha);
+    uint8_t g = blendChannel((foreground >> 5) & 0x3F, (background >> 5) & 0x3F, alpha);
+    uint8_t b = blendChannel(foreground & 0x1F, background & 0x1F, alpha);
+    return ((r & 0x1F) << 11) | ((g & 0x3F) << 5) | (b & 0x1F);
+}
+
+// Largest difference of the three channels, in LSBs
+static auto channelDistance(uint16_t a, uint16_t b) -> int {
+    return std::max({std::abs((a >> 11) - (b >> 11)),
+                     std::abs(((a >> 5) & 0x3F) - ((b >> 5) & 0x3F)),
+                     std::abs((a & 0x1F) - (b & 0x1F))});
+}
+
+// A colour with the same value in every channel, cut to the width of red and blue
+static auto grey(uint8_t value) -> uint16_t {
+    return ((value & 0x1F) << 11) | ((value & 0x3F) << 5) | (value & 0x1F);
+}
+
+static_assert(blendRgb565(0xF800, 0x001F, RGB565_ALPHA_ONE) == 0xF800);
+static_assert(blendRgb565(0xF800, 0x001F, 0) == 0x001F);
+static_assert(blendRgb565(0xFFFF, 0x0000, 16) == blendRgb565Reference(0xFFFF, 0x0000, 16));
+static_assert(rgb565AlphaFromFloat(-1.0F) == 0 && rgb565AlphaFromFloat(2.0F) == RGB565_ALPHA_ONE);
+
+// The channels do not interact, so every pair of channel values at every alpha covers all inputs.
+// Green is 6 bits wide; cut to 5 bits, the same values give every red and blue pair.
+static void swarMatchesReference() {
+    for (uint8_t alpha = 0; alpha <= RGB565_ALPHA_ONE; alpha++) {
+        for (uint8_t f = 0; f < 64; f++) {
+            for (uint8_t b = 0; b < 64; b++) {
+                CHECK(blendRgb565(grey(f), grey(b), alpha)
+                      == blendRgb565Reference(grey(f), grey(b), alpha));
+            }
+        }
+    }
+}
+
+static void withinOneLsbOfFloat() {
+    for (int step = 0; step <= 1000; step++) {
+        float   alpha = step / 1000.0F;
+        uint8_t fixed = rgb565AlphaFromFloat(alpha);
+        for (uint8_t f = 0; f < 64; f++) {
+            for (uint8_t b = 0; b < 64; b++) {
+                CHECK(channelDistance(blendRgb565(grey(f), grey(b), fixed),
+                                      blendFloat(grey(f), grey(b), alpha))
+                      <= 1);
+            }
+        }
+    }
+}
+
+static void spansMatchSinglePixels() {
+    uint16_t pixels[256];
+    uint16_t expected[256];
+    uint8_t  alphas[256];
+    uint32_t seed = 1;
+    for (int round = 0; round < 200; round++) {
+        for (int i = 0; i < 256; i++) {
+            seed      = (seed * 1103515245) + 12345;
+            pixels[i] = seed >> 8;
+            alphas[i] = (seed >> 3) % (RGB565_ALPHA_ONE + 1);
+        }
+        uint16_t color = seed >> 16;
+
+        uint8_t alpha = round % (RGB565_ALPHA_ONE + 1);
+        std::copy(pixels, pixels + 256, expected);
+        blendRgb565Span(pixels, 256, color, alpha);
+        for (int i = 0; i < 256; i++) {
+            CHECK(pixels[i] == blendRgb565(color, expected[i], alpha));
+        }
+
+        std::copy(pixels, pixels + 256, expected);
+        blendRgb565Span(pixels, 256, color, alphas);
+        for (int i = 0; i < 256; i++) {
+            CHECK(pixels[i] == blendRgb565(color, expected[i], alphas[i]));
+        }
+    }
+}
+
+auto main() -> int {
+    swarMatchesReference();
+    withinOneLsbOfFloat();
+    spansMatchSinglePixels();
+    return hostTestResult();
+}
@@ -0,0 +1,246 @@
+#include "HostTest.hpp"
+#include "SimArduino.hpp"
+#include "SimBus.hpp"
+#include "SimDie.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <memory>
+#include <vector>
+
+// Two dice on a table: close together they hear each other above rssiLimit, apart below it
+constexpr int32_t       RSSI_CLOSE  = -30;
+constexpr int32_t       RSSI_APART  = -80;
+constexpr unsigned long TICK_MS     = 10;
+constexpr unsigned long SETTLE_MS   = 100;
+constexpr unsigned long ENTANGLE_MS = 10000;
+constexpr int           ROUNDS      = 2000;
+constexpr int           HANDSHAKES  = 500; // Per loss level
+
+// Each die namespace holds one die, so there is only ever one table
+struct Table {
+    SimBus                  bus;
+    std::unique_ptr<SimDie> a = makeSimDieA(bus);
+    std::unique_ptr<SimDie> b = makeSimDieB(bus);
+    unsigned long           now    = 0; // Simulated ms
+    unsigned long           tickMs = TICK_MS;
+
+    void tick() {
+        advanceClock(tickMs * 1000);
+        now += tickMs;
+        a->update();
+        b->update();
+    }
+
+    void run(unsigned long ms) {
+        for (unsigned long elapsed = 0; elapsed < ms; elapsed += tickMs) {
+            tick();
+        }
+    }
+
+    // Returns false when done() is still false after timeoutMs
+    auto runUntil(const std::function<bool()> &done, unsigned long timeoutMs) -> bool {
+        for (unsigned long elapsed = 0; elapsed < timeoutMs; elapsed += tickMs) {
+            if (done()) {
+                return true;
+            }
+            tick();
+        }
+        return done();
+    }
+
+    auto entangle() -> bool {
+        bus.setRssi(RSSI_CLOSE);
+        bool entangled = runUntil(
+          [this] {
+              return a->getState().entanglement == SimEntanglement::ENTANGLED
+                     && b->getState().entanglement == SimEntanglement::ENTANGLED;
+          },
+          ENTANGLE_MS);
+        bus.setRssi(RSSI_APART);
+        run(SETTLE_MS);
+        return entangled;
+    }
+
+    void roll(SimDie &die, SimOrientation orientation) {
+        die.throwDie();
+        run(SETTLE_MS);
+        die.land(orientation);
+        run(SETTLE_MS);
+    }
+};
+
+static auto isState(const SimDie &die, SimMode mode, SimThrowState throwState,
+                    SimEntanglement entanglement) -> bool {
+    SimState state = die.getState();
+    return state.mode == mode && state.throwState == throwState
+           && state.entanglement == entanglement;
+}
+
+// Every face shows the same screen in the same colour
+static auto showsEverywhere(const SimDie &die, const SimFaceContent &content) -> bool {
+    for (uint8_t face = 0; face < SIM_FACE_COUNT; face++) {
+        const SimFaceContent &shown = die.getFace(static_cast<SimFace>(face));
+        if (shown.screen != content.screen || shown.foreground != content.foreground) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Walks one pair of dice through entangling, a throw of each on the same axis and a re-entangle
+static void entangledPairRollsOpposite(Table &table) {
+    table.bus.setRssi(RSSI_APART);
+    table.a->begin();
+    table.b->begin();
+    table.run(SETTLE_MS);
+
+    CHECK(isState(*table.a, SimMode::CLASSIC, SimThrowState::IDLE, SimEntanglement::PURE));
+    CHECK(table.a->getFace(FACE_Z0).number == 6 && table.a->getFace(FACE_Z1).number == 1);
+
+    table.a->longClick();
+    table.b->longClick();
+    table.run(SETTLE_MS);
+    CHECK(isState(*table.a, SimMode::QUANTUM, SimThrowState::IDLE, SimEntanglement::PURE));
+    CHECK(isState(*table.b, SimMode::QUANTUM, SimThrowState::IDLE, SimEntanglement::PURE));
+    CHECK(table.a->getFace(FACE_Z0).number == 0);
+
+    // Apart, the dice ignore each other's watchdogs
+    table.run(ENTANGLE_MS);
+    CHECK(table.a->getState().entanglement == SimEntanglement::PURE);
+
+    CHECK(table.entangle());
+    // Both show the entangled superposition in the colour they agreed on
+    SimFaceContent entangledFace = table.a->getFace(FACE_X0);
+    CHECK(showsEverywhere(*table.a, entangledFace));
+    CHECK(showsEverywhere(*table.b, entangledFace));
+
+    table.a->throwDie();
+    table.run(SETTLE_MS);
+    CHECK(isState(*table.a, SimMode::QUANTUM, SimThrowState::THROWING,
+                  SimEntanglement::ENTANGLED));
+    table.a->land(SimOrientation::Z_UP);
+    table.run(SETTLE_MS);
+    CHECK(isState(*table.a, SimMode::QUANTUM, SimThrowState::OBSERVED, SimEntanglement::PURE));
+    CHECK(isState(*table.b, SimMode::QUANTUM, SimThrowState::IDLE,
+                  SimEntanglement::POST_ENTANGLEMENT));
+    uint8_t numberA = table.a->getFace(FACE_Z0).number;
+    CHECK(numberA >= 1 && numberA <= 6);
+
+    // Z_DOWN is the same basis, the bottom face shows the opposite number
+    table.roll(*table.b, SimOrientation::Z_DOWN);
+    CHECK(isState(*table.b, SimMode::QUANTUM, SimThrowState::OBSERVED, SimEntanglement::PURE));
+    CHECK(table.b->getFace(FACE_Z1).number == 7 - numberA);
+
+    // Observed dice entangle again when brought together
+    CHECK(table.entangle());
+}
+
+// Many rounds of entangle, separate and throw both; B lands on A's axis every other round
+static void manyRoundsFasterThanRealTime(Table &table) {
+    std::array<int, 7> seenA       = {};
+    int                entangled   = 0;
+    int                opposite    = 0;
+    int                throws      = 0;
+    unsigned long      startMillis = table.now;
+    auto               start       = std::chrono::steady_clock::now();
+
+    for (int round = 0; round < ROUNDS; round++) {
+        if (!table.entangle()) {
+            continue;
+        }
+        entangled++;
+
+        table.roll(*table.a, SimOrientation::Y_UP);
+        bool sameAxis = round % 2 == 0;
+        table.roll(*table.b, sameAxis ? SimOrientation::Y_DOWN : SimOrientation::X_UP);
+        throws += 2;
+
+        uint8_t numberA = table.a->getFace(FACE_Y0).number;
+        uint8_t numberB = table.b->getFace(sameAxis ? FACE_Y1 : FACE_X1).number;
+        CHECK(numberA >= 1 && numberA <= 6 && numberB >= 1 && numberB <= 6);
+        seenA[numberA % 7]++;
+        if (sameAxis) {
+            CHECK(numberA + numberB == 7);
+            opposite++;
+        }
+    }
+
+    double hostSeconds
+      = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    double simSeconds = (table.now - startMillis) / 1000.0;
+
+    CHECK(entangled == ROUNDS);
+    CHECK(opposite == ROUNDS / 2);
+    for (int number = 1; number <= 6; number++) {
+        CHECK(seenA[number] > ROUNDS / 12);
+    }
+    printf("%d throws, %.0f s simulated in %.3f s: %.0f throws/s, %.0fx real time, %u frames\n",
+           throws, simSeconds, hostSeconds, throws / hostSeconds, simSeconds / hostSeconds,
+           table.bus.getFramesSent());
+}
+
+// Entangles the pair over a channel that loses the given share of frames and of
+// acknowledgements, HANDSHAKES times, and prints how long the handshake took: from the first
+// update a die spends in ENTANGLE_REQUESTED until both are ENTANGLED. The dice are separated
+// and thrown over a clean channel in between, and the time is taken in 1 ms ticks.
+static void handshakeUnderLoss(Table &table) {
+    for (uint32_t loss : {0U, 10U, 20U, 30U}) {
+        std::vector<unsigned long> times;
+        for (int handshake = 0; handshake < HANDSHAKES; handshake++) {
+            table.bus.setChannel({loss, 0, loss});
+            table.bus.setRssi(RSSI_CLOSE);
+            table.tickMs = 1;
+
+            unsigned long start     = 0;
+            bool          requested = false;
+            bool          entangled = table.runUntil(
+              [&table, &start, &requested] {
+                  SimEntanglement a = table.a->getState().entanglement;
+                  SimEntanglement b = table.b->getState().entanglement;
+                  if (!requested
+                      && (a == SimEntanglement::ENTANGLE_REQUESTED
+                          || b == SimEntanglement::ENTANGLE_REQUESTED)) {
+                      requested = true;
+                      start     = table.now;
+                  }
+                  return a == SimEntanglement::ENTANGLED && b == SimEntanglement::ENTANGLED;
+              },
+              ENTANGLE_MS);
+            if (entangled && requested) {
+                times.push_back(table.now - start);
+            }
+
+            table.tickMs = TICK_MS;
+            table.bus.setChannel({0, 0, 0});
+            table.bus.setRssi(RSSI_APART);
+            table.run(SETTLE_MS);
+            table.roll(*table.a, SimOrientation::Z_UP);
+            table.roll(*table.b, SimOrientation::Z_UP);
+        }
+
+        std::sort(times.begin(), times.end());
+        unsigned long total = 0;
+        for (unsigned long time : times) {
+            total += time;
+        }
+        CHECK(times.size() == HANDSHAKES);
+        if (!times.empty()) {
+            printf("%2u%% loss: %zu/%d handshakes, mean %.1f ms, p99 %lu ms\n", loss,
+                   times.size(), HANDSHAKES, static_cast<double>(total) / times.size(),
+                   times[(times.size() * 99 + 99) / 100 - 1]);
+        }
+    }
+}
+
+int main() {
+    seedRandom(1);
+    Table table;
+    entangledPairRollsOpposite(table);
+    manyRoundsFasterThanRealTime(table);
+    handshakeUnderLoss(table);
+    return hostTestResult();
+}
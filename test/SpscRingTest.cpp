@@ -0,0 +1,147 @@
+#include "HostTest.hpp"
+#include "SpscRing.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+constexpr size_t   CAPACITY = 16;
+constexpr uint32_t MESSAGES = 1000000;
+
+// Large enough that a slot copied while the producer rewrites it would show up as a mismatch
+struct Record {
+    uint32_t sequence;
+    uint32_t check[7];
+};
+
+static auto makeRecord(uint32_t sequence) -> Record {
+    Record record = {sequence, {}};
+    for (uint32_t &word : record.check) {
+        word = sequence * 2654435761U;
+    }
+    return record;
+}
+
+static auto isIntact(const Record &record) -> bool {
+    for (uint32_t word : record.check) {
+        if (word != record.sequence * 2654435761U) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void fillsAndDropsNewest() {
+    SpscRing<uint32_t, CAPACITY> ring;
+    for (uint32_t i = 0; i < CAPACITY; i++) {
+        CHECK(ring.push(i));
+    }
+    CHECK(ring.size() == CAPACITY);
+    CHECK(!ring.push(CAPACITY));
+    CHECK(!ring.push(CAPACITY + 1));
+    CHECK(ring.drops() == 2);
+
+    // The queued items survive, the rejected ones never appear
+    uint32_t item = 0;
+    for (uint32_t i = 0; i < CAPACITY; i++) {
+        CHECK(ring.pop(item) && item == i);
+    }
+    CHECK(!ring.pop(item));
+    CHECK(ring.isEmpty());
+}
+
+// Many laps around the ring at every fill level
+static void wrapsAround() {
+    SpscRing<uint32_t, CAPACITY> ring;
+    uint32_t                     next     = 0;
+    uint32_t                     expected = 0;
+    for (uint32_t lap = 0; lap < 1000; lap++) {
+        size_t fill = lap % (CAPACITY + 1);
+        for (size_t i = 0; i < fill; i++) {
+            CHECK(ring.push(next++));
+        }
+        CHECK(ring.size() == fill);
+        uint32_t item = 0;
+        while (ring.pop(item)) {
+            CHECK(item == expected);
+            expected++;
+        }
+    }
+    CHECK(expected == next);
+    CHECK(ring.drops() == 0);
+}
+
+// One producer and one consumer thread. The producer retries most records until they fit, so
+// the ring keeps running full, and gives up on every eighth after one try. Every pushed record
+// arrives intact and in order, and every failed push is counted as a drop.
+static void twoThreads() {
+    static SpscRing<Record, CAPACITY> ring;
+    std::atomic<bool>                 producerDone = false;
+    uint32_t                          attempts     = 0;
+    uint32_t                          pushed       = 0;
+    uint32_t                          popped       = 0;
+    uint32_t                          damaged      = 0;
+    uint32_t                          outOfOrder   = 0;
+
+    std::thread producer([&] {
+        for (uint32_t sequence = 0; sequence < MESSAGES; sequence++) {
+            Record record = makeRecord(sequence);
+            bool   pushedRecord;
+            while (true) {
+                attempts++;
+                pushedRecord = ring.push(record);
+                if (pushedRecord || sequence % 8 == 0) {
+                    break;
+                }
+                std::this_thread::yield(); // Lets the consumer run on a single core
+            }
+            if (pushedRecord) {
+                pushed++;
+            }
+        }
+        producerDone.store(true, std::memory_order_release);
+    });
+
+    std::thread consumer([&] {
+        Record   record;
+        uint32_t last = 0;
+        while (true) {
+            // Read the flag first: once it is set, everything pushed is already visible
+            bool finished = producerDone.load(std::memory_order_acquire);
+            if (!ring.pop(record)) {
+                if (finished) {
+                    break;
+                }
+                std::this_thread::yield();
+                continue;
+            }
+            if (!isIntact(record)) {
+                damaged++;
+            }
+            if (popped > 0 && record.sequence <= last) {
+                outOfOrder++;
+            }
+            last = record.sequence;
+            popped++;
+        }
+    });
+
+    producer.join();
+    consumer.join();
+
+    CHECK(damaged == 0);
+    CHECK(outOfOrder == 0);
+    CHECK(popped == pushed);
+    CHECK(pushed + ring.drops() == attempts);
+    CHECK(pushed > MESSAGES * 7 / 8);
+    CHECK(ring.isEmpty());
+    printf("%u of %u records passed, %u pushes found the ring full\n", popped, MESSAGES,
+           ring.drops());
+}
+
+int main() {
+    fillsAndDropsNewest();
+    wrapsAround();
+    twoThreads();
+    return hostTestResult();
+}
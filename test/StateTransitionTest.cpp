@@ -0,0 +1,75 @@
+// The sketch's StateMachine.cpp in a simulator namespace of its own, see sim/SimDieUnity.inc.
+// That puts its static STATE_TRANSITIONS in this file.
+#define SIM_DIE_NAMESPACE stateTransitionTest
+#define SIM_DIE_FACTORY makeStateTransitionTestDie
+#include "SimDieUnity.inc"
+
+#include "HostTest.hpp"
+
+#include <optional>
+
+namespace stateTransitionTest {
+
+    // The loop that resolved transitions at run time before the dense table, kept as it was.
+    // Only its end differs: it threw when no entry matched, which the exception-free build
+    // cannot, so it returns nothing instead.
+    static auto baselineScan(State currentState, Trigger trigger)
+      -> std::optional<StateTransition> {
+        for (const StateTransition &transition : STATE_TRANSITIONS) {
+            bool modeMatch = !transition.currentMode.has_value()
+                             || transition.currentMode.value() == currentState.mode;
+            bool throwStateMatch
+              = !transition.currentThrowState.has_value()
+                || transition.currentThrowState.value() == currentState.throwState;
+            bool entanglementStateMatch
+              = !transition.currentEntanglementState.has_value()
+                || transition.currentEntanglementState.value() == currentState.entanglementState;
+
+            if (modeMatch && throwStateMatch && entanglementStateMatch
+                && transition.trigger == trigger) {
+                return transition;
+            }
+        }
+        return std::nullopt;
+    }
+
+    static auto sameTransition(const StateTransition &a, const StateTransition &b) -> bool {
+        return a.currentMode == b.currentMode && a.nextMode == b.nextMode
+               && a.currentThrowState == b.currentThrowState
+               && a.nextThrowState == b.nextThrowState
+               && a.currentEntanglementState == b.currentEntanglementState
+               && a.nextEntanglementState == b.nextEntanglementState && a.trigger == b.trigger;
+    }
+
+    // The dense table gives the same transition as the scan for every (state, trigger) pair
+    static void tableMatchesBaselineScan() {
+        uint32_t pairs       = 0;
+        uint32_t transitions = 0;
+        for (size_t id = 0; id < STATE_COUNT; id++) {
+            State state = stateFromId(id);
+            CHECK(stateId(state) == id);
+            for (size_t index = 0; index < TRIGGER_COUNT; index++) {
+                Trigger trigger = static_cast<Trigger>(index);
+                std::optional<StateTransition> expected = baselineScan(state, trigger);
+                std::optional<StateTransition> looked
+                  = StateMachine::getStateTransition(state, trigger);
+
+                CHECK(expected.has_value() == looked.has_value());
+                if (expected.has_value() && looked.has_value()) {
+                    CHECK(sameTransition(*expected, *looked));
+                    transitions++;
+                }
+                pairs++;
+            }
+        }
+        CHECK(pairs == STATE_COUNT * TRIGGER_COUNT);
+        printf("%u (state, trigger) pairs, %u with a transition, all as the scan\n", pairs,
+               transitions);
+    }
+
+} // namespace stateTransitionTest
+
+int main() {
+    stateTransitionTest::tableMatchesBaselineScan();
+    return hostTestResult();
+}
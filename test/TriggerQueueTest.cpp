@@ -0,0 +1,90 @@
+// One simulated die in a namespace of its own, see sim/SimDieUnity.inc, so the test can post
+// triggers straight to its state machine
+#define SIM_DIE_NAMESPACE triggerQueueTest
+#define SIM_DIE_FACTORY makeTriggerQueueTestDie
+#include "SimDieUnity.inc"
+
+#include "HostTest.hpp"
+
+namespace triggerQueueTest {
+
+    // Lets update() run the state functions and apply the queue
+    static void tick(SimDie &die) {
+        advanceClock(FSM_UPDATE_INTERVAL * 1000);
+        die.update();
+    }
+
+    static auto modeOf(SimDie &die) -> SimMode {
+        return die.getState().mode;
+    }
+
+    // A repeat of the last pending trigger is merged, a repeat behind another trigger is kept
+    static void mergesOnlyTheLastTrigger(SimDie &die, StateMachine &machine) {
+        CHECK(modeOf(die) == SimMode::CLASSIC);
+        uint16_t merged = machine.getTriggerQueueStats().merged;
+
+        machine.postTrigger(Trigger::BUTTON_PRESSED);
+        machine.postTrigger(Trigger::BUTTON_PRESSED);
+        CHECK(machine.getTriggerQueueStats().merged == merged + 1);
+        tick(die);
+        CHECK(modeOf(die) == SimMode::QUANTUM);
+
+        // There and back again; merging the second press into the first would stay in CLASSIC
+        machine.postTrigger(Trigger::BUTTON_PRESSED);
+        machine.postTrigger(Trigger::TIMED);
+        machine.postTrigger(Trigger::BUTTON_PRESSED);
+        CHECK(machine.getTriggerQueueStats().merged == merged + 1);
+        tick(die);
+        CHECK(modeOf(die) == SimMode::QUANTUM);
+
+        machine.postTrigger(Trigger::BUTTON_PRESSED);
+        tick(die);
+        CHECK(modeOf(die) == SimMode::CLASSIC);
+    }
+
+    // A full queue drops new triggers, but still merges a repeat of its last one, and applies
+    // the triggers it kept in order
+    static void overflowDropsTheNewest(SimDie &die, StateMachine &machine) {
+        StateMachine::TriggerQueueStats before = machine.getTriggerQueueStats();
+
+        // Presses alternating with a trigger that neither idle state applies
+        for (size_t i = 0; i < TRIGGER_QUEUE_SIZE; i++) {
+            machine.postTrigger(i % 2 == 0 ? Trigger::BUTTON_PRESSED : Trigger::TIMED);
+        }
+        machine.postTrigger(Trigger::TIMED);          // Merged into the last one
+        machine.postTrigger(Trigger::BUTTON_PRESSED); // Dropped
+        machine.postTrigger(Trigger::START_ROLLING);  // Dropped
+
+        StateMachine::TriggerQueueStats after = machine.getTriggerQueueStats();
+        CHECK(after.highWater == TRIGGER_QUEUE_SIZE);
+        CHECK(after.merged == before.merged + 1);
+        CHECK(after.dropped == before.dropped + 2);
+
+        // The four queued presses are applied and the dropped one is not: back in CLASSIC
+        tick(die);
+        CHECK(modeOf(die) == SimMode::CLASSIC);
+
+        // The queue is usable again
+        machine.postTrigger(Trigger::BUTTON_PRESSED);
+        tick(die);
+        CHECK(modeOf(die) == SimMode::QUANTUM);
+        CHECK(machine.getTriggerQueueStats().dropped == after.dropped);
+    }
+
+    static void run() {
+        SimBus                  bus;
+        std::unique_ptr<SimDie> made = makeTriggerQueueTestDie(bus);
+        made->begin();
+        tick(*made);
+
+        StateMachine &machine = static_cast<Die &>(*made).getStateMachine();
+        mergesOnlyTheLastTrigger(*made, machine);
+        overflowDropsTheNewest(*made, machine);
+    }
+
+} // namespace triggerQueueTest
+
+int main() {
+    triggerQueueTest::run();
+    return hostTestResult();
+}
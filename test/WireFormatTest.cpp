@@ -0,0 +1,185 @@
+#include "HostTest.hpp"
+
+#include "MessageTransport.hpp"
+
+#include <cstring>
+#include <random>
+
+using Wire = WireFormat<message>;
+
+constexpr uint8_t AXIS_COUNT    = static_cast<uint8_t>(MeasuredAxises::NA) + 1;
+constexpr uint8_t UP_SIDE_COUNT = static_cast<uint8_t>(UpSide::NA) + 1;
+constexpr uint8_t NUMBER_COUNT  = static_cast<uint8_t>(DiceNumbers::SIX) + 1;
+
+static std::mt19937 rng(1);
+
+static auto header(uint8_t version, uint8_t type) -> uint8_t {
+    return (version << 4) | type;
+}
+
+// A message of the given type with every field it carries set to a random valid value; the
+// rest stays zero, as decode() leaves it
+static auto randomMessage(message_type type) -> message {
+    message data;
+    memset(&data, 0, sizeof(data));
+    data.type = type;
+
+    State          state  = stateFromId(rng() % STATE_COUNT);
+    MeasuredAxises axis   = static_cast<MeasuredAxises>(rng() % AXIS_COUNT);
+    UpSide         upSide = static_cast<UpSide>(rng() % UP_SIDE_COUNT);
+    DiceNumbers    number = static_cast<DiceNumbers>(rng() % NUMBER_COUNT);
+    uint16_t       color  = rng();
+    uint8_t        mac[6];
+    for (uint8_t &byte : mac) {
+        byte = rng();
+    }
+
+    switch (type) {
+        case MESSAGE_TYPE_WATCH_DOG:
+            data.data.watchDog.state = state;
+            break;
+        case MESSAGE_TYPE_MEASUREMENT:
+            data.data.measurement = {state, axis, number, upSide};
+            break;
+        case MESSAGE_TYPE_ENTANGLE_CONFIRM:
+            data.data.entangleConfirm.color = color;
+            break;
+        case MESSAGE_TYPE_TELEPORT_REQUEST:
+            memcpy(data.data.teleportRequest.target_dice, mac, sizeof(mac));
+            break;
+        case MESSAGE_TYPE_TELEPORT_PAYLOAD:
+            data.data.teleportPayload.state       = state;
+            data.data.teleportPayload.measureAxis = axis;
+            data.data.teleportPayload.diceNumber  = number;
+            data.data.teleportPayload.upSide      = upSide;
+            data.data.teleportPayload.color       = color;
+            memcpy(data.data.teleportPayload.entangled_peer, mac, sizeof(mac));
+            break;
+        case MESSAGE_TYPE_TELEPORT_PARTNER:
+            memcpy(data.data.teleportPartner.new_partner, mac, sizeof(mac));
+            break;
+        case MESSAGE_TYPE_ENTANGLE_REQUEST:
+        case MESSAGE_TYPE_ENTANGLE_DENIED:
+        case MESSAGE_TYPE_TELEPORT_CONFIRM:
+            break;
+    }
+    return data;
+}
+
+// Every type encodes to its FRAME_SIZES length behind its header byte and decodes to the same
+// message
+static void roundTrip() {
+    for (uint32_t i = 0; i < 100000; i++) {
+        message_type type = static_cast<message_type>(i % MESSAGE_TYPE_COUNT);
+        message      sent = randomMessage(type);
+        uint8_t      frame[Wire::MAX_SIZE];
+        size_t       length = Wire::encode(sent, frame);
+        CHECK(length == Wire::FRAME_SIZES[type]);
+        CHECK(frame[0] == header(WIRE_VERSION, type));
+
+        message received;
+        CHECK(Wire::decode(frame, length, received));
+        CHECK(memcmp(&sent, &received, sizeof(message)) == 0);
+    }
+
+    message unknown;
+    memset(&unknown, 0, sizeof(unknown));
+    unknown.type = static_cast<message_type>(MESSAGE_TYPE_COUNT);
+    uint8_t frame[Wire::MAX_SIZE];
+    CHECK(Wire::encode(unknown, frame) == 0);
+}
+
+// Another version or an unknown type in the header byte is rejected at any length
+static void rejectsHeader() {
+    uint8_t frame[Wire::MAX_SIZE + 1] = {};
+    message data;
+    for (uint8_t version = 0; version < 16; version++) {
+        for (uint8_t type = 0; type < 16; type++) {
+            if (version == WIRE_VERSION && type < MESSAGE_TYPE_COUNT) {
+                continue;
+            }
+            frame[0] = header(version, type);
+            for (size_t length = 1; length <= sizeof(frame); length++) {
+                CHECK(!Wire::decode(frame, length, data));
+            }
+        }
+    }
+    CHECK(!Wire::decode(frame, 0, data));
+}
+
+// A frame one byte short, one byte long or any other length than FRAME_SIZES is rejected
+static void rejectsLength() {
+    for (uint8_t type = 0; type < MESSAGE_TYPE_COUNT; type++) {
+        message sent = randomMessage(static_cast<message_type>(type));
+        uint8_t frame[Wire::MAX_SIZE + 1];
+        size_t  length = Wire::encode(sent, frame);
+        frame[length]  = 0;
+
+        message data;
+        for (size_t other = 1; other <= sizeof(frame); other++) {
+            CHECK(Wire::decode(frame, other, data) == (other == length));
+        }
+    }
+}
+
+// Out-of-range state ids and observation values are rejected
+static void rejectsValues() {
+    message data;
+    uint8_t frame[Wire::MAX_SIZE] = {};
+
+    frame[0] = header(WIRE_VERSION, MESSAGE_TYPE_WATCH_DOG);
+    frame[1] = STATE_COUNT - 1;
+    CHECK(Wire::decode(frame, 2, data));
+    frame[1] = STATE_COUNT;
+    CHECK(!Wire::decode(frame, 2, data));
+
+    frame[0] = header(WIRE_VERSION, MESSAGE_TYPE_MEASUREMENT);
+    frame[1] = 0;
+    frame[2] = (AXIS_COUNT - 1) | ((UP_SIDE_COUNT - 1) << 4);
+    frame[3] = NUMBER_COUNT - 1;
+    CHECK(Wire::decode(frame, 4, data));
+    frame[2] = AXIS_COUNT;
+    CHECK(!Wire::decode(frame, 4, data));
+    frame[2] = UP_SIDE_COUNT << 4;
+    CHECK(!Wire::decode(frame, 4, data));
+    frame[2] = 0;
+    frame[3] = NUMBER_COUNT;
+    CHECK(!Wire::decode(frame, 4, data));
+}
+
+// Random bytes, half of them behind a valid header: a frame is only accepted at the length of
+// its type, and whatever is accepted encodes back to the same bytes
+static void fuzz() {
+    uint32_t accepted = 0;
+    for (uint32_t i = 0; i < 1000000; i++) {
+        uint8_t frame[Wire::MAX_SIZE + 2];
+        size_t  length = rng() % (sizeof(frame) + 1);
+        for (size_t k = 0; k < length; k++) {
+            frame[k] = rng();
+        }
+        if (length > 0 && rng() % 2 == 0) {
+            frame[0] = header(WIRE_VERSION, rng() % MESSAGE_TYPE_COUNT);
+        }
+
+        message data;
+        if (!Wire::decode(frame, length, data)) {
+            continue;
+        }
+        accepted++;
+        CHECK(length == Wire::FRAME_SIZES[frame[0] & 0x0F]);
+        uint8_t encoded[Wire::MAX_SIZE];
+        CHECK(Wire::encode(data, encoded) == length);
+        CHECK(memcmp(frame, encoded, length) == 0);
+    }
+    CHECK(accepted > 0);
+    printf("%u random frames accepted, all encoded back to the same bytes\n", accepted);
+}
+
+int main() {
+    roundTrip();
+    rejectsHeader();
+    rejectsLength();
+    rejectsValues();
+    fuzz();
+    return hostTestResult();
+}
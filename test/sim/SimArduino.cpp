@@ -0,0 +1,56 @@
+#include "SimArduino.hpp"
+
+#include <Arduino.h>
+#include <atomic>
+#include <random>
+
+HardwareSerial Serial;
+
+// Atomic, as the display task of the display tests moves it from a thread of its own
+static std::atomic<uint64_t> clockMicros = 0;
+static std::mt19937          generator;
+
+void advanceClock(unsigned long micros) {
+    clockMicros += micros;
+}
+
+void seedRandom(uint32_t seed) {
+    generator.seed(seed);
+}
+
+auto millis() -> unsigned long {
+    return clockMicros / 1000;
+}
+
+auto micros() -> unsigned long {
+    return clockMicros;
+}
+
+void delay(unsigned long ms) {
+    advanceClock(ms * 1000);
+}
+
+auto random(long howBig) -> long {
+    return random(0, howBig);
+}
+
+auto random(long howSmall, long howBig) -> long {
+    if (howSmall >= howBig) {
+        return howSmall;
+    }
+    return std::uniform_int_distribution<long>(howSmall, howBig - 1)(generator);
+}
+
+auto esp_random() -> uint32_t {
+    return generator();
+}
+
+auto dtostrf(double value, signed char width, unsigned char precision, char *buffer) -> char * {
+    sprintf(buffer, "%*.*f", width, precision, value);
+    return buffer;
+}
+
+// A full battery, 4.00 V behind the 1:2 divider
+auto analogReadMilliVolts(uint8_t) -> uint32_t {
+    return 2000;
+}
@@ -0,0 +1,16 @@
+#ifndef SIMARDUINO_H_
+#define SIMARDUINO_H_
+
+#include <cstdint>
+
+/*
+   SimArduino - the virtual clock and random source behind the Arduino stubs
+
+   millis() and micros() only move when advanceClock() is called, so a simulation runs as fast as
+   the host allows and every run with the same seed makes the same decisions.
+*/
+
+void advanceClock(unsigned long micros);
+void seedRandom(uint32_t seed);
+
+#endif /* SIMARDUINO_H_ */
@@ -0,0 +1,168 @@
+#include "SimBus.hpp"
+
+#include "EspNowSensor.hpp"
+
+#include <WiFi.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+static const SimMac BROADCAST = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+
+// The bus the ESP-NOW functions below talk to; there is one at a time
+static SimBus *activeBus = nullptr;
+
+SimBus::SimBus() {
+    assert(activeBus == nullptr);
+    activeBus = this;
+}
+
+SimBus::~SimBus() {
+    activeBus = nullptr;
+}
+
+auto SimBus::attach() -> SimMac {
+    // Locally administered addresses, one per die
+    SimMac mac = {0x02, 0x00, 0x00, 0x00, 0x00, static_cast<uint8_t>(nodes.size() + 1)};
+    nodes.push_back({mac, {}, {}, nullptr, nullptr, {0, 0}});
+    return mac;
+}
+
+void SimBus::enter(const SimMac &mac) {
+    Node *node = find(mac.data());
+    assert(node != nullptr);
+    current = node - nodes.data();
+    memcpy(WiFi.address, mac.data(), SIM_MAC_LENGTH);
+
+    // The callbacks may send, which can grow the queues of any node, so take one item at a time
+    while (!nodes[current].reports.empty()) {
+        esp_now_send_status_t status = nodes[current].reports.front();
+        nodes[current].reports.pop_front();
+        wifi_tx_info_t info = {};
+        nodes[current].sendCallback(&info, status);
+    }
+    while (!nodes[current].inbox.empty()) {
+        Frame frame = nodes[current].inbox.front();
+        nodes[current].inbox.pop_front();
+        wifi_pkt_rx_ctrl_t  control = {};
+        esp_now_recv_info_t info = {frame.source.data(), nodes[current].mac.data(), &control};
+        auto pair                = pairRssi.find(std::minmax(frame.sender, current));
+        control.rssi             = pair != pairRssi.end() ? pair->second : rssi;
+        nodes[current].recvCallback(&info, frame.bytes.data(), static_cast<int>(frame.length));
+    }
+}
+
+void SimBus::setRssi(int32_t rssi) {
+    this->rssi = rssi;
+}
+
+void SimBus::setRssi(const SimMac &a, const SimMac &b, int32_t rssi) {
+    Node *nodeA = find(a.data());
+    Node *nodeB = find(b.data());
+    assert(nodeA != nullptr && nodeB != nullptr);
+    size_t indexA = nodeA - nodes.data();
+    size_t indexB = nodeB - nodes.data();
+    pairRssi[std::minmax(indexA, indexB)] = rssi;
+}
+
+void SimBus::setChannel(const SimChannel &channel) {
+    this->channel = channel;
+}
+
+void SimBus::seed(uint32_t seed) {
+    generator.seed(seed);
+}
+
+auto SimBus::getAirStats(const SimMac &mac) const -> SimAirStats {
+    for (const Node &node : nodes) {
+        if (node.mac == mac) {
+            return node.air;
+        }
+    }
+    return {0, 0};
+}
+
+void SimBus::registerCallbacks(esp_now_send_cb_t send, esp_now_recv_cb_t recv) {
+    if (send != nullptr) {
+        nodes[current].sendCallback = send;
+    }
+    if (recv != nullptr) {
+        nodes[current].recvCallback = recv;
+    }
+}
+
+auto SimBus::send(const uint8_t *target, const uint8_t *frame, size_t length) -> bool {
+    if (length > SIM_FRAME_MAX) {
+        return false;
+    }
+    Frame sent = {current, nodes[current].mac, {}, length};
+    memcpy(sent.bytes.data(), frame, length);
+    framesSent++;
+    nodes[current].air.frames++;
+    nodes[current].air.airtimeUs += espNowAirtime(length);
+
+    bool broadcast = memcmp(target, BROADCAST.data(), SIM_MAC_LENGTH) == 0;
+    bool arrived   = false;
+    for (size_t i = 0; i < nodes.size(); i++) {
+        Node &node = nodes[i];
+        if (i == current || node.recvCallback == nullptr
+            || (!broadcast && memcmp(target, node.mac.data(), SIM_MAC_LENGTH) != 0)) {
+            continue;
+        }
+        if (chance(channel.dropPercent)) {
+            continue;
+        }
+        arrived = true;
+        node.inbox.push_back(sent);
+        if (chance(channel.duplicatePercent)) {
+            node.inbox.push_back(sent);
+        }
+    }
+
+    // ESP-NOW reports a broadcast as sent; a unicast only once the receiver acknowledged it
+    bool acknowledged = broadcast || (arrived && !chance(channel.ackLossPercent));
+    nodes[current].reports.push_back(acknowledged ? ESP_NOW_SEND_SUCCESS : ESP_NOW_SEND_FAIL);
+    return true;
+}
+
+auto SimBus::find(const uint8_t *mac) -> Node * {
+    for (Node &node : nodes) {
+        if (memcmp(mac, node.mac.data(), SIM_MAC_LENGTH) == 0) {
+            return &node;
+        }
+    }
+    return nullptr;
+}
+
+auto SimBus::chance(uint32_t percent) -> bool {
+    return percent > 0 && generator() % 100 < percent;
+}
+
+// ESP-NOW, as seen by the die the bus last entered
+
+auto esp_now_init() -> esp_err_t {
+    return ESP_OK;
+}
+
+auto esp_now_register_send_cb(esp_now_send_cb_t cb) -> esp_err_t {
+    activeBus->registerCallbacks(cb, nullptr);
+    return ESP_OK;
+}
+
+auto esp_now_register_recv_cb(esp_now_recv_cb_t cb) -> esp_err_t {
+    activeBus->registerCallbacks(nullptr, cb);
+    return ESP_OK;
+}
+
+auto esp_now_is_peer_exist(const uint8_t *) -> bool {
+    return true;
+}
+
+auto esp_now_add_peer(const esp_now_peer_info_t *) -> esp_err_t {
+    return ESP_OK;
+}
+
+auto esp_now_send(const uint8_t *peer_addr, const uint8_t *data, size_t len) -> esp_err_t {
+    return activeBus->send(peer_addr, data, len) ? ESP_OK : ESP_FAIL;
+}
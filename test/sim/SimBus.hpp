@@ -0,0 +1,108 @@
+#ifndef SIMBUS_H_
+#define SIMBUS_H_
+
+#include <esp_now.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <random>
+#include <utility>
+#include <vector>
+
+/*
+   SimBus - the radio between simulated dice
+
+   The bus plays ESP-NOW: the esp_now_*() functions of the stubs are defined in SimBus.cpp and act
+   for the die that was last entered with enter(), which also sets the address WiFi reports. Each
+   die runs the sketch's own EspNowSensor through EspNowTransport, so sequence numbers,
+   retransmission and duplicate filtering are the real ones.
+
+   A frame sent by a die waits in the inbox of each receiver until that die is entered again,
+   which then gets it through its receive callback, in the order it was sent. The send report
+   waits in the same way for the sender. All dice hear each other at the RSSI set with
+   setRssi(), unless it was set for the pair; the broadcast address reaches every other die.
+
+   setChannel() makes the bus lossy. Each receiver loses a frame on its own. A unicast frame that
+   arrives can still be reported as failed, as when its acknowledgement is lost, so the sender
+   retransmits a frame the receiver already has. The losses come from the bus' own random
+   generator, so a run with the same seed takes the same losses.
+*/
+
+constexpr size_t SIM_MAC_LENGTH = 6;
+constexpr size_t SIM_FRAME_MAX  = 250; // ESP-NOW payload limit
+
+using SimMac = std::array<uint8_t, SIM_MAC_LENGTH>;
+
+struct SimChannel {
+    uint32_t dropPercent;      // Frames that do not reach a receiver
+    uint32_t duplicatePercent; // Frames that reach a receiver twice
+    uint32_t ackLossPercent;   // Unicast frames that arrive but are reported as failed
+};
+
+// What one die put on the air
+struct SimAirStats {
+    uint32_t frames;
+    uint64_t airtimeUs; // espNowAirtime() of each frame
+};
+
+class SimBus {
+  public:
+    SimBus();
+    ~SimBus();
+
+    // Adds a die and returns its MAC address
+    auto attach() -> SimMac;
+
+    // The ESP-NOW functions act for this die until the next call. Hands it the frames and send
+    // reports that are waiting for it.
+    void enter(const SimMac &mac);
+
+    void setRssi(int32_t rssi);
+    // For two dice, in both directions, until it is set again for the pair
+    void setRssi(const SimMac &a, const SimMac &b, int32_t rssi);
+    void setChannel(const SimChannel &channel);
+    void seed(uint32_t seed);
+
+    auto getFramesSent() const -> uint32_t {
+        return framesSent;
+    }
+
+    auto getAirStats(const SimMac &mac) const -> SimAirStats;
+
+    // Called by the ESP-NOW functions
+    void registerCallbacks(esp_now_send_cb_t send, esp_now_recv_cb_t recv);
+    auto send(const uint8_t *target, const uint8_t *frame, size_t length) -> bool;
+
+  private:
+    struct Frame {
+        size_t                             sender; // Index in nodes
+        SimMac                             source;
+        std::array<uint8_t, SIM_FRAME_MAX> bytes;
+        size_t                             length;
+    };
+
+    struct Node {
+        SimMac                            mac;
+        std::deque<Frame>                 inbox;
+        std::deque<esp_now_send_status_t> reports;
+        esp_now_send_cb_t                 sendCallback;
+        esp_now_recv_cb_t                 recvCallback;
+        SimAirStats                       air;
+    };
+
+    std::vector<Node>                            nodes;
+    size_t                                       current    = 0;
+    int32_t                                      rssi       = -80;
+    std::map<std::pair<size_t, size_t>, int32_t> pairRssi; // Node indices, the lower one first
+    SimChannel                                   channel    = {0, 0, 0};
+    std::mt19937                                 generator;
+    uint32_t                                     framesSent = 0;
+
+    auto find(const uint8_t *mac) -> Node *;
+    auto chance(uint32_t percent) -> bool;
+};
+
+#endif /* SIMBUS_H_ */
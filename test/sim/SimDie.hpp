@@ -0,0 +1,144 @@
+#ifndef SIMDIE_H_
+#define SIMDIE_H_
+
+#include "SimBus.hpp"
+
+#include <array>
+#include <cstdint>
+#include <memory>
+
+/*
+   SimDie - one die of the host simulator
+
+   Each die runs the sketch's own StateMachine.cpp, ScreenStateDefs.cpp, MessageWire.cpp and
+   MessageTransport.cpp. The sketch keeps a die's state in globals, so every die is compiled into
+   its own namespace from SimDieUnity.inc; see SimDieA.cpp and SimDieB.cpp. Around the sketch
+   code a die has:
+
+     - the virtual clock of SimArduino.hpp
+     - a scripted IMUSensor that reports what imu holds
+     - the sketch's EspNowTransport, whose ESP-NOW calls go to a SimBus
+     - a face buffer recording what the display functions last drew on each face
+
+   The enums below mirror the sketch's, which exist once per die namespace; SimDieUnity.inc
+   checks that they match.
+*/
+
+enum class SimMode : uint8_t { CLASSIC, QUANTUM, LOW_BATTERY };
+
+enum class SimThrowState : uint8_t { IDLE, THROWING, OBSERVED };
+
+enum class SimEntanglement : uint8_t {
+    PURE,
+    ENTANGLE_REQUESTED,
+    ENTANGLED,
+    POST_ENTANGLEMENT,
+    TELEPORTED,
+};
+
+// IMU_Orientation
+enum class SimOrientation : uint8_t { UNKNOWN, Z_UP, Z_DOWN, X_UP, X_DOWN, Y_UP, Y_DOWN, TILTED };
+
+// Faces in screenselections order
+enum SimFace : uint8_t { FACE_X0, FACE_X1, FACE_Y0, FACE_Y1, FACE_Z0, FACE_Z1, SIM_FACE_COUNT };
+
+// Chip-select masks in screenselections order, one bit per face, for hwPins.screenAddress
+constexpr uint8_t SIM_MASK_X0 = 1 << FACE_X0;
+constexpr uint8_t SIM_MASK_X1 = 1 << FACE_X1;
+constexpr uint8_t SIM_MASK_Y0 = 1 << FACE_Y0;
+constexpr uint8_t SIM_MASK_Y1 = 1 << FACE_Y1;
+constexpr uint8_t SIM_MASK_Z0 = 1 << FACE_Z0;
+constexpr uint8_t SIM_MASK_Z1 = 1 << FACE_Z1;
+
+constexpr std::array<uint8_t, 16> SIM_SCREEN_ADDRESSES = {
+  SIM_MASK_X0,
+  SIM_MASK_X1,
+  SIM_MASK_Y0,
+  SIM_MASK_Y1,
+  SIM_MASK_Z0,
+  SIM_MASK_Z1,
+  SIM_MASK_X0 | SIM_MASK_X1,                             // XX
+  SIM_MASK_Y0 | SIM_MASK_Y1,                             // YY
+  SIM_MASK_Z0 | SIM_MASK_Z1,                             // ZZ
+  SIM_MASK_X0 | SIM_MASK_X1 | SIM_MASK_Y0 | SIM_MASK_Y1, // XXYY
+  SIM_MASK_X0 | SIM_MASK_X1 | SIM_MASK_Z0 | SIM_MASK_Z1, // XXZZ
+  SIM_MASK_Y0 | SIM_MASK_Y1 | SIM_MASK_Z0 | SIM_MASK_Z1, // YYZZ
+  SIM_MASK_X0 | SIM_MASK_Y0 | SIM_MASK_Z0,               // ODD
+  SIM_MASK_X1 | SIM_MASK_Y1 | SIM_MASK_Z1,               // EVEN
+  0x3F,                                                  // ALL
+  0};                                                    // NO_ONE
+
+struct SimState {
+    SimMode         mode;
+    SimThrowState   throwState;
+    SimEntanglement entanglement;
+};
+
+// What the IMU reports; tumbled is cleared by resetTumbleDetection()
+struct SimImu {
+    bool           moving      = false;
+    bool           stable      = true;
+    bool           onTable     = true;
+    bool           tumbled     = false;
+    SimOrientation orientation = SimOrientation::Z_UP;
+};
+
+struct SimFaceContent {
+    uint8_t  number;     // 1-6 for a die face, 0 for anything else
+    uint8_t  screen;     // ScreenStates
+    uint16_t foreground; // Dot/text colour
+};
+
+class SimDie {
+  public:
+    virtual ~SimDie() = default;
+
+    // StateMachine::begin() and StateMachine::update()
+    virtual void begin()  = 0;
+    virtual void update() = 0;
+
+    virtual auto getState() const -> SimState = 0;
+
+    // The button handlers of handyHelpers.cpp
+    virtual void click()     = 0;
+    virtual void longClick() = 0;
+
+    // Starts a throw: the die tumbles and keeps moving until land()
+    void throwDie() {
+        imu = {true, false, false, true, SimOrientation::UNKNOWN};
+    }
+
+    void land(SimOrientation orientation) {
+        imu = {false, true, true, imu.tumbled, orientation};
+    }
+
+    auto getFace(SimFace face) const -> const SimFaceContent & {
+        return faces[face];
+    }
+
+    // Face draws since start, counting a face drawn through a combined selection once
+    auto getFaceDraws() const -> uint32_t {
+        return faceDraws;
+    }
+
+    auto getMac() const -> const SimMac & {
+        return mac;
+    }
+
+    SimImu imu;
+
+  protected:
+    explicit SimDie(const SimMac &mac) : mac(mac) {}
+
+    std::array<SimFaceContent, SIM_FACE_COUNT> faces     = {};
+    uint32_t                                   faceDraws = 0;
+
+  private:
+    SimMac mac;
+};
+
+// One die per namespace: a second call to the same factory would share the first die's globals
+auto makeSimDieA(SimBus &bus) -> std::unique_ptr<SimDie>;
+auto makeSimDieB(SimBus &bus) -> std::unique_ptr<SimDie>;
+
+#endif /* SIMDIE_H_ */
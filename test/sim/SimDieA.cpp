@@ -0,0 +1,3 @@
+#define SIM_DIE_NAMESPACE simDieA
+#define SIM_DIE_FACTORY makeSimDieA
+#include "SimDieUnity.inc"
@@ -0,0 +1,3 @@
+#define SIM_DIE_NAMESPACE simDieB
+#define SIM_DIE_FACTORY makeSimDieB
+#include "SimDieUnity.inc"
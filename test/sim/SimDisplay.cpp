@@ -0,0 +1,47 @@
+#include "SimDisplay.hpp"
+
+#include "SimDie.hpp"
+
+#include "AssetStore.hpp"
+#include "DiceConfigManager.hpp"
+#include "handyHelpers.hpp"
+#include "ScreenStateDefs.hpp"
+#include "Screenfunctions.hpp"
+
+#include <cstring>
+
+// DEVKIT pins, see initHardwarePins()
+HardwarePins hwPins = {10, 48, 47, {4, 5, 6, 7, 15, 16}, {}, 2};
+DiceConfig   currentConfig;
+
+void beginSimDisplay() {
+    memcpy(hwPins.screenAddress, SIM_SCREEN_ADDRESSES.data(), SIM_SCREEN_ADDRESSES.size());
+
+    currentConfig.diceId              = "SIM";
+    currentConfig.x_background        = 0x0000;
+    currentConfig.y_background        = 0x0000;
+    currentConfig.z_background        = 0x0000;
+    currentConfig.qrUrl               = DEFAULT_QR_URL;
+    currentConfig.entang_colors       = {0xFFE0, 0x07E0, 0x07FF, 0xF81F};
+    currentConfig.entang_colors_count = 4;
+
+    initDisplays();
+}
+
+auto initAssetStore() -> bool {
+    return false;
+}
+
+auto findAsset(const char *, ImageAsset &) -> bool {
+    return false;
+}
+
+auto generateDiceRoll() -> uint8_t {
+    return (esp_random() % 6) + 1;
+}
+
+auto mapFloat(float x, float in_min, float in_max, float out_min, float out_max, bool clipOutput)
+  -> float {
+    float mapped = (x - in_min) * (out_max - out_min) / (in_max - in_min) + out_min;
+    return clipOutput ? std::max(out_min, std::min(mapped, out_max)) : mapped;
+}
@@ -0,0 +1,19 @@
+#ifndef SIMDISPLAY_H_
+#define SIMDISPLAY_H_
+
+/*
+   SimDisplay - the sketch's display code on the host
+
+   The display tests link the sketch's own Screenfunctions.cpp, ScreenStateDefs.cpp,
+   RenderTarget.cpp, FaceSprites.cpp, DisplayCommit.cpp, ImageAsset.cpp and QrEncoder.cpp. The
+   panels are the fake SPI sink of SimPanel.hpp and the display task is a host thread
+   (sim/SimRtos.cpp). SimDisplay.cpp holds the rest of the sketch that this code reads: the pins,
+   the config with the defaults of DiceConfigManager::initDefaultConfig(), the dice roll, and an
+   asset store without a pack, so the built-in images are drawn.
+*/
+
+// Sets the pins and config as setup() would, then runs initDisplays(), which starts the display
+// task. Call it once.
+void beginSimDisplay();
+
+#endif /* SIMDISPLAY_H_ */
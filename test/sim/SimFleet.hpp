@@ -0,0 +1,23 @@
+#ifndef SIMFLEET_H_
+#define SIMFLEET_H_
+
+#include "SimBus.hpp"
+#include "SimDie.hpp"
+
+#include <cstddef>
+#include <memory>
+
+/*
+   SimFleet - many simulated dice
+
+   Each die of the fleet is a namespace of its own, like SimDieA.cpp and SimDieB.cpp. CMake
+   generates their sources from SimFleetDie.cpp.in, SIM_FLEET_SIZE of them, and this list from
+   SimFleet.cpp.in.
+*/
+
+auto getFleetSize() -> size_t;
+
+// Each index once: a second die with the same index would share the first one's globals
+auto makeFleetDie(size_t index, SimBus &bus) -> std::unique_ptr<SimDie>;
+
+#endif /* SIMFLEET_H_ */
@@ -0,0 +1,113 @@
+#include "SimPanel.hpp"
+
+#include "SimArduino.hpp"
+
+#include <Adafruit_GC9A01A.h>
+#include <Arduino.h>
+
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+#include <thread>
+
+static std::mutex                logLock;
+static std::vector<SimSpiRecord> spiLog;
+static uint64_t                  busBits     = 0; // Clocked out since the start, for the clock
+static bool                      realTimeBus = false;
+
+auto getSimSpiLog() -> std::vector<SimSpiRecord> {
+    std::lock_guard<std::mutex> held(logLock);
+    return spiLog;
+}
+
+void clearSimSpiLog() {
+    std::lock_guard<std::mutex> held(logLock);
+    spiLog.clear();
+}
+
+void setSimPanelRealTime(bool realTime) {
+    std::lock_guard<std::mutex> held(logLock);
+    realTimeBus = realTime;
+}
+
+// Appends a record once the given bytes have gone over the bus
+static void record(SimSpiRecord entry, uint32_t bytes) {
+    unsigned long transferMicros = 0;
+    bool          waitReal       = false;
+    {
+        std::lock_guard<std::mutex> held(logLock);
+        uint64_t before  = busBits * 1000000 / SIM_SPI_HZ;
+        busBits         += (uint64_t)bytes * 8;
+        transferMicros   = busBits * 1000000 / SIM_SPI_HZ - before;
+        advanceClock(transferMicros);
+        entry.micros = micros();
+        spiLog.push_back(entry);
+        waitReal = realTimeBus;
+    }
+    if (waitReal && transferMicros > 0) {
+        std::this_thread::sleep_for(std::chrono::microseconds(transferMicros));
+    }
+}
+
+static void record(SimSpiEvent event) {
+    record({event, 0, 0, 0, 0, 0, 0, 0, 0}, 0);
+}
+
+void pinMode(uint8_t, uint8_t) {}
+
+void digitalWrite(uint8_t pin, uint8_t value) {
+    record({SimSpiEvent::PIN, 0, 0, 0, 0, 0, pin, value, 0}, 0);
+}
+
+Adafruit_GC9A01A::Adafruit_GC9A01A(int8_t, int8_t, int8_t)
+    : Adafruit_GFX(GC9A01A_TFTWIDTH, GC9A01A_TFTHEIGHT) {}
+
+void Adafruit_GC9A01A::begin(uint32_t) {}
+
+void Adafruit_GC9A01A::setRotation(uint8_t r) {
+    Adafruit_GFX::setRotation(r);
+}
+
+void Adafruit_GC9A01A::startWrite() {
+    record(SimSpiEvent::START_WRITE);
+}
+
+void Adafruit_GC9A01A::endWrite() {
+    record(SimSpiEvent::END_WRITE);
+}
+
+void Adafruit_GC9A01A::setAddrWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+    record({SimSpiEvent::ADDRESS_WINDOW, x, y, w, h, 0, 0, 0, 0}, SIM_WINDOW_BYTES);
+}
+
+void Adafruit_GC9A01A::writePixels(uint16_t *, uint32_t len, bool, bool) {
+    record({SimSpiEvent::PIXELS, 0, 0, 0, 0, len, 0, 0, 0}, len * SIM_BYTES_PER_PIXEL);
+}
+
+void Adafruit_GC9A01A::writeColor(uint16_t, uint32_t len) {
+    record({SimSpiEvent::PIXELS, 0, 0, 0, 0, len, 0, 0, 0}, len * SIM_BYTES_PER_PIXEL);
+}
+
+void Adafruit_GC9A01A::drawPixel(int16_t x, int16_t y, uint16_t color) {
+    startWrite();
+    writePixel(x, y, color);
+    endWrite();
+}
+
+void Adafruit_GC9A01A::writePixel(int16_t x, int16_t y, uint16_t color) {
+    writeFillRect(x, y, 1, 1, color);
+}
+
+// Clipped to the panel, then one address window and one run of the colour
+void Adafruit_GC9A01A::writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                                     uint16_t color) {
+    int16_t left   = std::max<int16_t>(x, 0);
+    int16_t top    = std::max<int16_t>(y, 0);
+    int16_t right  = std::min<int16_t>(x + w, _width);
+    int16_t bottom = std::min<int16_t>(y + h, _height);
+    if (left >= right || top >= bottom) {
+        return;
+    }
+    setAddrWindow(left, top, right - left, bottom - top);
+    writeColor(color, (uint32_t)(right - left) * (bottom - top));
+}
@@ -0,0 +1,48 @@
+#ifndef SIMPANEL_H_
+#define SIMPANEL_H_
+
+#include <cstdint>
+#include <vector>
+
+/*
+   SimPanel - a fake SPI sink in place of the GC9A01A panels
+
+   The Adafruit_GC9A01A methods of the stubs are defined in SimPanel.cpp. Instead of clocking
+   pixels out they append to a log: transaction boundaries, address windows, pixel runs and, from
+   digitalWrite(), the chip-select lines. Every transfer moves the virtual clock on by the time
+   it takes at SIM_SPI_HZ, and each record holds the time at which it ended.
+
+   The display task writes from a thread of its own, so the log is guarded and read as a copy.
+   With setSimPanelRealTime() every transfer also takes its time on the host clock, so the
+   display task lags behind the code that queues the pushes as it does on the device.
+*/
+
+constexpr uint32_t SIM_SPI_HZ          = 40000000;
+constexpr uint32_t SIM_WINDOW_BYTES    = 11; // CASET, RASET and RAMWR with their parameters
+constexpr uint32_t SIM_BYTES_PER_PIXEL = 2;
+
+enum class SimSpiEvent : uint8_t {
+    START_WRITE,
+    END_WRITE,
+    ADDRESS_WINDOW,
+    PIXELS,
+    PIN
+};
+
+struct SimSpiRecord {
+    SimSpiEvent   event;
+    uint16_t      x;      // ADDRESS_WINDOW
+    uint16_t      y;      // ADDRESS_WINDOW
+    uint16_t      width;  // ADDRESS_WINDOW
+    uint16_t      height; // ADDRESS_WINDOW
+    uint32_t      pixels; // PIXELS
+    uint8_t       pin;    // PIN
+    uint8_t       level;  // PIN
+    unsigned long micros;
+};
+
+auto getSimSpiLog() -> std::vector<SimSpiRecord>;
+void clearSimSpiLog();
+void setSimPanelRealTime(bool realTime);
+
+#endif /* SIMPANEL_H_ */
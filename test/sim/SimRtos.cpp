@@ -0,0 +1,91 @@
+// The FreeRTOS queues, semaphores and tasks of the stubs, on host threads. Queues and tasks live
+// as long as the program, as they do on the device.
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+struct QueueDefinition {
+    std::mutex                        lock;
+    std::condition_variable           changed;
+    std::deque<std::vector<uint8_t>> items;
+    UBaseType_t                       length;
+    UBaseType_t                       itemSize;
+};
+
+// Waits until ready() holds, for at most ticksToWait milliseconds
+template <typename Ready>
+static auto waitFor(QueueDefinition &queue, std::unique_lock<std::mutex> &held,
+                    TickType_t ticksToWait, Ready ready) -> bool {
+    if (ticksToWait == portMAX_DELAY) {
+        queue.changed.wait(held, ready);
+        return true;
+    }
+    return queue.changed.wait_for(held, std::chrono::milliseconds(ticksToWait), ready);
+}
+
+auto xQueueCreate(UBaseType_t length, UBaseType_t itemSize) -> QueueHandle_t {
+    QueueHandle_t queue = new QueueDefinition();
+    queue->length       = length;
+    queue->itemSize     = itemSize;
+    return queue;
+}
+
+auto xQueueSend(QueueHandle_t queue, const void *item, TickType_t ticksToWait) -> BaseType_t {
+    std::unique_lock<std::mutex> held(queue->lock);
+    if (!waitFor(*queue, held, ticksToWait,
+                 [queue] { return queue->items.size() < queue->length; })) {
+        return pdFALSE;
+    }
+    const auto *bytes = static_cast<const uint8_t *>(item);
+    queue->items.emplace_back(bytes, bytes + queue->itemSize);
+    queue->changed.notify_all();
+    return pdTRUE;
+}
+
+auto xQueueReceive(QueueHandle_t queue, void *buffer, TickType_t ticksToWait) -> BaseType_t {
+    std::unique_lock<std::mutex> held(queue->lock);
+    if (!waitFor(*queue, held, ticksToWait, [queue] { return !queue->items.empty(); })) {
+        return pdFALSE;
+    }
+    if (queue->itemSize != 0) {
+        memcpy(buffer, queue->items.front().data(), queue->itemSize);
+    }
+    queue->items.pop_front();
+    queue->changed.notify_all();
+    return pdTRUE;
+}
+
+auto xSemaphoreCreateCounting(UBaseType_t maxCount, UBaseType_t initialCount)
+  -> SemaphoreHandle_t {
+    SemaphoreHandle_t semaphore = xQueueCreate(maxCount, 0);
+    semaphore->items.resize(initialCount);
+    return semaphore;
+}
+
+auto xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticksToWait) -> BaseType_t {
+    return xQueueReceive(semaphore, nullptr, ticksToWait);
+}
+
+auto xSemaphoreGive(SemaphoreHandle_t semaphore) -> BaseType_t {
+    // Giving a full semaphore fails at once
+    return xQueueSend(semaphore, nullptr, 0);
+}
+
+auto xTaskCreatePinnedToCore(TaskFunction_t function, const char *, uint32_t, void *parameter,
+                             UBaseType_t, TaskHandle_t *createdTask, BaseType_t) -> BaseType_t {
+    std::thread(function, parameter).detach();
+    if (createdTask != nullptr) {
+        *createdTask = nullptr;
+    }
+    return pdPASS;
+}
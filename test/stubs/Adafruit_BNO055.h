@@ -0,0 +1,10 @@
+#ifndef ADAFRUIT_BNO055_H_
+#define ADAFRUIT_BNO055_H_
+
+#include <Arduino.h>
+#include <utility/imumaths.h>
+
+// Only a member of BNO055IMUSensor, which the host builds replace with a scripted IMUSensor
+class Adafruit_BNO055 {};
+
+#endif /* ADAFRUIT_BNO055_H_ */
@@ -0,0 +1,39 @@
+#ifndef ADAFRUIT_GC9A01A_H_
+#define ADAFRUIT_GC9A01A_H_
+
+#include <Adafruit_GFX.h>
+
+/*
+   Adafruit_GC9A01A.h - the GC9A01A driver calls the sketch makes
+
+   The methods are defined by sim/SimPanel.cpp, which records what would go over SPI instead of
+   driving a panel. As in the library, every shape ends in an address window and a run of one
+   colour.
+*/
+
+#define GC9A01A_BLACK 0x0000
+#define GC9A01A_RED 0xF800
+#define GC9A01A_WHITE 0xFFFF
+
+#define GC9A01A_TFTWIDTH 240
+#define GC9A01A_TFTHEIGHT 240
+
+class Adafruit_GC9A01A : public Adafruit_GFX {
+  public:
+    Adafruit_GC9A01A(int8_t cs, int8_t dc, int8_t rst);
+
+    void begin(uint32_t freq = 0);
+    void setRotation(uint8_t r) override;
+
+    void startWrite() override;
+    void endWrite() override;
+    void setAddrWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+    void writePixels(uint16_t *colors, uint32_t len, bool block = true, bool bigEndian = false);
+    void writeColor(uint16_t color, uint32_t len);
+
+    void drawPixel(int16_t x, int16_t y, uint16_t color) override;
+    void writePixel(int16_t x, int16_t y, uint16_t color) override;
+    void writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override;
+};
+
+#endif /* ADAFRUIT_GC9A01A_H_ */
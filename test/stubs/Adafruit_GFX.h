@@ -0,0 +1,181 @@
+#ifndef ADAFRUIT_GFX_H_
+#define ADAFRUIT_GFX_H_
+
+#include <Arduino.h>
+
+/*
+   Adafruit_GFX.h - the part of Adafruit GFX that the sketch draws with
+
+   Shapes are drawn as in the library: fillCircle() uses the same vertical lines, and every line
+   or rectangle ends in writeFillRect(), which a display may override. The fonts in Fonts/ have
+   no glyphs, so text takes no space and draws nothing.
+*/
+
+struct GFXfont {};
+
+class Adafruit_GFX {
+  public:
+    Adafruit_GFX(int16_t w, int16_t h) : WIDTH(w), HEIGHT(h), _width(w), _height(h) {}
+    virtual ~Adafruit_GFX() = default;
+
+    virtual void drawPixel(int16_t x, int16_t y, uint16_t color) = 0;
+
+    virtual void startWrite() {}
+    virtual void endWrite() {}
+
+    virtual void writePixel(int16_t x, int16_t y, uint16_t color) {
+        drawPixel(x, y, color);
+    }
+
+    virtual void writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+        for (int16_t row = y; row < y + h; row++) {
+            for (int16_t column = x; column < x + w; column++) {
+                writePixel(column, row, color);
+            }
+        }
+    }
+
+    virtual void writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+        writeFillRect(x, y, 1, h, color);
+    }
+
+    virtual void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+        writeFillRect(x, y, w, 1, color);
+    }
+
+    virtual void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+        startWrite();
+        writeFastVLine(x, y, h, color);
+        endWrite();
+    }
+
+    virtual void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+        startWrite();
+        writeFastHLine(x, y, w, color);
+        endWrite();
+    }
+
+    virtual void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+        startWrite();
+        writeFillRect(x, y, w, h, color);
+        endWrite();
+    }
+
+    virtual void fillScreen(uint16_t color) {
+        fillRect(0, 0, _width, _height, color);
+    }
+
+    virtual void setRotation(uint8_t r) {
+        rotation = r & 3;
+        _width   = (rotation & 1) != 0 ? HEIGHT : WIDTH;
+        _height  = (rotation & 1) != 0 ? WIDTH : HEIGHT;
+    }
+
+    void fillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color) {
+        startWrite();
+        writeFastVLine(x0, y0 - r, (2 * r) + 1, color);
+        fillCircleHelper(x0, y0, r, 3, 0, color);
+        endWrite();
+    }
+
+    void fillCircleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t corners, int16_t delta,
+                          uint16_t color) {
+        int16_t f     = 1 - r;
+        int16_t ddF_x = 1;
+        int16_t ddF_y = -2 * r;
+        int16_t x     = 0;
+        int16_t y     = r;
+        int16_t px    = x;
+        int16_t py    = y;
+
+        delta++;
+        while (x < y) {
+            if (f >= 0) {
+                y--;
+                ddF_y += 2;
+                f += ddF_y;
+            }
+            x++;
+            ddF_x += 2;
+            f += ddF_x;
+            if (x < (y + 1)) {
+                if ((corners & 1) != 0) {
+                    writeFastVLine(x0 + x, y0 - y, (2 * y) + delta, color);
+                }
+                if ((corners & 2) != 0) {
+                    writeFastVLine(x0 - x, y0 - y, (2 * y) + delta, color);
+                }
+            }
+            if (y != py) {
+                if ((corners & 1) != 0) {
+                    writeFastVLine(x0 + py, y0 - px, (2 * px) + delta, color);
+                }
+                if ((corners & 2) != 0) {
+                    writeFastVLine(x0 - py, y0 - px, (2 * px) + delta, color);
+                }
+                py = y;
+            }
+            px = x;
+        }
+    }
+
+    void setFont(const GFXfont *f) {
+        font = f;
+    }
+
+    void setTextSize(uint8_t size) {
+        textSize = size;
+    }
+
+    void setTextColor(uint16_t color) {
+        textColor = color;
+    }
+
+    void setCursor(int16_t x, int16_t y) {
+        cursorX = x;
+        cursorY = y;
+    }
+
+    auto print(const char *text) -> size_t {
+        return strlen(text);
+    }
+
+    auto print(const String &text) -> size_t {
+        return text.length();
+    }
+
+    void getTextBounds(const char *, int16_t x, int16_t y, int16_t *x1, int16_t *y1, uint16_t *w,
+                       uint16_t *h) {
+        *x1 = x;
+        *y1 = y;
+        *w  = 0;
+        *h  = 0;
+    }
+
+    void getTextBounds(const String &text, int16_t x, int16_t y, int16_t *x1, int16_t *y1,
+                       uint16_t *w, uint16_t *h) {
+        getTextBounds(text.c_str(), x, y, x1, y1, w, h);
+    }
+
+    auto width() const -> int16_t {
+        return _width;
+    }
+
+    auto height() const -> int16_t {
+        return _height;
+    }
+
+  protected:
+    int16_t        WIDTH; // Before rotation
+    int16_t        HEIGHT;
+    int16_t        _width;
+    int16_t        _height;
+    uint8_t        rotation  = 0;
+    const GFXfont *font      = nullptr;
+    uint8_t        textSize  = 1;
+    uint16_t       textColor = 0xFFFF;
+    int16_t        cursorX   = 0;
+    int16_t        cursorY   = 0;
+};
+
+#endif /* ADAFRUIT_GFX_H_ */
@@ -0,0 +1,4 @@
+#ifndef ADAFRUIT_SENSOR_H_
+#define ADAFRUIT_SENSOR_H_
+
+#endif /* ADAFRUIT_SENSOR_H_ */
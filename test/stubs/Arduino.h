@@ -0,0 +1,89 @@
+#ifndef ARDUINO_H_
+#define ARDUINO_H_
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+/*
+   Arduino.h - the part of the Arduino core that the host builds of the sketch use
+
+   millis(), micros(), random(), esp_random(), dtostrf() and analogReadMilliVolts() are defined by
+   the program that links the sketch sources; see sim/SimArduino.cpp. Serial output is discarded.
+   pinMode() and digitalWrite() are defined by sim/SimPanel.cpp, which records the chip-select
+   lines of the displays.
+*/
+
+#define RTC_DATA_ATTR
+#define IRAM_ATTR
+#define PROGMEM
+#define pgm_read_byte(address) (*reinterpret_cast<const uint8_t *>(address))
+#define pgm_read_word(address) (*reinterpret_cast<const uint16_t *>(address))
+
+#define HEX 16
+#define DEC 10
+
+#define LOW 0x0
+#define HIGH 0x1
+#define OUTPUT 0x03
+
+class String {
+  public:
+    String(const char *text = "") : text(text) {}
+
+    auto c_str() const -> const char * {
+        return text.c_str();
+    }
+
+    auto length() const -> unsigned int {
+        return text.length();
+    }
+
+    auto operator==(const String &other) const -> bool {
+        return text == other.text;
+    }
+
+  private:
+    std::string text;
+};
+
+class HardwareSerial {
+  public:
+    void begin(unsigned long) {}
+
+    template <typename T> auto print(const T &, int = DEC) -> size_t {
+        return 0;
+    }
+
+    template <typename T> auto println(const T &, int = DEC) -> size_t {
+        return 0;
+    }
+
+    auto println() -> size_t {
+        return 0;
+    }
+
+    auto printf(const char *, ...) -> size_t {
+        return 0;
+    }
+};
+
+extern HardwareSerial Serial;
+
+auto millis() -> unsigned long;
+auto micros() -> unsigned long;
+void delay(unsigned long ms);
+auto random(long howBig) -> long;
+auto random(long howSmall, long howBig) -> long;
+auto esp_random() -> uint32_t;
+auto dtostrf(double value, signed char width, unsigned char precision, char *buffer) -> char *;
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+auto analogReadMilliVolts(uint8_t pin) -> uint32_t;
+
+#endif /* ARDUINO_H_ */
@@ -0,0 +1,9 @@
+#ifndef BUTTON2_H_
+#define BUTTON2_H_
+
+#include <Arduino.h>
+
+// Only declared by the sketch headers; the host builds read clicks from their own flags
+class Button2 {};
+
+#endif /* BUTTON2_H_ */
@@ -0,0 +1,8 @@
+#ifndef FREESANS18PT7B_H_
+#define FREESANS18PT7B_H_
+
+#include <Adafruit_GFX.h>
+
+const GFXfont FreeSans18pt7b = {};
+
+#endif /* FREESANS18PT7B_H_ */
@@ -0,0 +1,8 @@
+#ifndef FREESANSBOLD18PT7B_H_
+#define FREESANSBOLD18PT7B_H_
+
+#include <Adafruit_GFX.h>
+
+const GFXfont FreeSansBold18pt7b = {};
+
+#endif /* FREESANSBOLD18PT7B_H_ */
@@ -0,0 +1,8 @@
+#ifndef FREESANSOBLIQUE12PT7B_H_
+#define FREESANSOBLIQUE12PT7B_H_
+
+#include <Adafruit_GFX.h>
+
+const GFXfont FreeSansOblique12pt7b = {};
+
+#endif /* FREESANSOBLIQUE12PT7B_H_ */
@@ -0,0 +1,6 @@
+#ifndef SPI_H_
+#define SPI_H_
+
+#include <Arduino.h>
+
+#endif /* SPI_H_ */
@@ -0,0 +1,24 @@
+#ifndef WIFI_H_
+#define WIFI_H_
+
+#include <Arduino.h>
+
+#define WIFI_STA 1
+
+class WiFiClass {
+  public:
+    static auto mode(int) -> bool {
+        return true;
+    }
+
+    void macAddress(uint8_t *mac) {
+        memcpy(mac, address, 6);
+    }
+
+    // Set by the test that plays the radio
+    uint8_t address[6] = {};
+};
+
+inline WiFiClass WiFi;
+
+#endif /* WIFI_H_ */
@@ -0,0 +1,6 @@
+#ifndef WIRE_H_
+#define WIRE_H_
+
+#include <Arduino.h>
+
+#endif /* WIRE_H_ */
@@ -0,0 +1,26 @@
+#ifndef ESP_HEAP_CAPS_H_
+#define ESP_HEAP_CAPS_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+
+// The host has a single heap, which serves every capability
+#define MALLOC_CAP_DMA (1 << 3)
+#define MALLOC_CAP_8BIT (1 << 2)
+#define MALLOC_CAP_SPIRAM (1 << 10)
+#define MALLOC_CAP_INTERNAL (1 << 11)
+
+inline auto heap_caps_malloc(size_t size, uint32_t) -> void * {
+    return malloc(size);
+}
+
+inline auto heap_caps_calloc(size_t count, size_t size, uint32_t) -> void * {
+    return calloc(count, size);
+}
+
+inline void heap_caps_free(void *pointer) {
+    free(pointer);
+}
+
+#endif /* ESP_HEAP_CAPS_H_ */
@@ -0,0 +1,57 @@
+#ifndef ESP_NOW_H_
+#define ESP_NOW_H_
+
+#include <cstddef>
+#include <cstdint>
+
+/*
+   esp_now.h - the ESP-NOW declarations EspNowSensor uses
+
+   The functions are defined by the test that plays the radio, or by the simulator's SimBus.
+*/
+
+using esp_err_t = int;
+
+#define ESP_OK 0
+#define ESP_FAIL -1
+
+#define ESP_NOW_MAX_DATA_LEN 250
+
+enum esp_now_send_status_t {
+    ESP_NOW_SEND_SUCCESS = 0,
+    ESP_NOW_SEND_FAIL,
+};
+
+struct wifi_pkt_rx_ctrl_t {
+    signed rssi : 8;
+};
+
+struct esp_now_recv_info_t {
+    uint8_t            *src_addr;
+    uint8_t            *des_addr;
+    wifi_pkt_rx_ctrl_t *rx_ctrl;
+};
+
+struct wifi_tx_info_t {
+    const uint8_t *des_addr;
+    const uint8_t *src_addr;
+};
+
+struct esp_now_peer_info_t {
+    uint8_t peer_addr[6];
+    uint8_t channel;
+    bool    encrypt;
+};
+
+using esp_now_send_cb_t = void (*)(const wifi_tx_info_t *tx_info, esp_now_send_status_t status);
+using esp_now_recv_cb_t = void (*)(const esp_now_recv_info_t *info, const uint8_t *data,
+                                   int data_len);
+
+auto esp_now_init() -> esp_err_t;
+auto esp_now_register_send_cb(esp_now_send_cb_t cb) -> esp_err_t;
+auto esp_now_register_recv_cb(esp_now_recv_cb_t cb) -> esp_err_t;
+auto esp_now_is_peer_exist(const uint8_t *peer_addr) -> bool;
+auto esp_now_add_peer(const esp_now_peer_info_t *peer) -> esp_err_t;
+auto esp_now_send(const uint8_t *peer_addr, const uint8_t *data, size_t len) -> esp_err_t;
+
+#endif /* ESP_NOW_H_ */
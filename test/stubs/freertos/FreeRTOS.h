@@ -0,0 +1,39 @@
+#ifndef FREERTOS_H_
+#define FREERTOS_H_
+
+#include <atomic>
+#include <cstdint>
+
+/*
+   freertos/FreeRTOS.h - the FreeRTOS types and critical sections the sketch uses
+
+   Queues, semaphores and tasks are declared in queue.h, semphr.h and task.h and defined by
+   sim/SimRtos.cpp on top of host threads.
+*/
+
+using BaseType_t  = int;
+using UBaseType_t = unsigned int;
+using TickType_t  = uint32_t;
+
+#define portMAX_DELAY ((TickType_t)0xFFFFFFFF)
+#define pdFALSE ((BaseType_t)0)
+#define pdTRUE ((BaseType_t)1)
+#define pdPASS pdTRUE
+
+// A spinlock, as on the ESP32
+struct portMUX_TYPE {
+    std::atomic<bool> locked;
+};
+
+#define portMUX_INITIALIZER_UNLOCKED {false}
+
+inline void taskENTER_CRITICAL(portMUX_TYPE *mux) {
+    while (mux->locked.exchange(true, std::memory_order_acquire)) {
+    }
+}
+
+inline void taskEXIT_CRITICAL(portMUX_TYPE *mux) {
+    mux->locked.store(false, std::memory_order_release);
+}
+
+#endif /* FREERTOS_H_ */
@@ -0,0 +1,13 @@
+#ifndef FREERTOS_QUEUE_H_
+#define FREERTOS_QUEUE_H_
+
+#include <freertos/FreeRTOS.h>
+
+struct QueueDefinition;
+using QueueHandle_t = QueueDefinition *;
+
+auto xQueueCreate(UBaseType_t length, UBaseType_t itemSize) -> QueueHandle_t;
+auto xQueueSend(QueueHandle_t queue, const void *item, TickType_t ticksToWait) -> BaseType_t;
+auto xQueueReceive(QueueHandle_t queue, void *buffer, TickType_t ticksToWait) -> BaseType_t;
+
+#endif /* FREERTOS_QUEUE_H_ */
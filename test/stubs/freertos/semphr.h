@@ -0,0 +1,15 @@
+#ifndef FREERTOS_SEMPHR_H_
+#define FREERTOS_SEMPHR_H_
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+
+// A semaphore is a queue of items without data, as in FreeRTOS
+using SemaphoreHandle_t = QueueHandle_t;
+
+auto xSemaphoreCreateCounting(UBaseType_t maxCount, UBaseType_t initialCount)
+  -> SemaphoreHandle_t;
+auto xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticksToWait) -> BaseType_t;
+auto xSemaphoreGive(SemaphoreHandle_t semaphore) -> BaseType_t;
+
+#endif /* FREERTOS_SEMPHR_H_ */
@@ -0,0 +1,14 @@
+#ifndef FREERTOS_TASK_H_
+#define FREERTOS_TASK_H_
+
+#include <freertos/FreeRTOS.h>
+
+using TaskFunction_t = void (*)(void *parameter);
+using TaskHandle_t   = void *;
+
+// The task runs on a host thread of its own; the core and priority are not modelled
+auto xTaskCreatePinnedToCore(TaskFunction_t function, const char *name, uint32_t stackDepth,
+                             void *parameter, UBaseType_t priority, TaskHandle_t *createdTask,
+                             BaseType_t coreId) -> BaseType_t;
+
+#endif /* FREERTOS_TASK_H_ */
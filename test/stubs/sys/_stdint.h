@@ -0,0 +1,6 @@
+#ifndef SYS__STDINT_H_
+#define SYS__STDINT_H_
+
+#include <cstdint>
+
+#endif /* SYS__STDINT_H_ */
@@ -0,0 +1,16 @@
+#ifndef IMUMATHS_H_
+#define IMUMATHS_H_
+
+namespace imu {
+    template <int N> class Vector {
+      public:
+        auto operator[](int index) const -> double {
+            return values[index];
+        }
+
+      private:
+        double values[N] = {};
+    };
+} // namespace imu
+
+#endif /* IMUMATHS_H_ */